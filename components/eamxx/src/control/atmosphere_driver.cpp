@@ -6,10 +6,12 @@
 
 #include "share/atm_process/atmosphere_process_group.hpp"
 #include "share/atm_process/atmosphere_process_dag.hpp"
+#include "share/atm_process/atmosphere_diagnostic.hpp"
 #include "share/field/field_utils.hpp"
 #include "share/util/scream_time_stamp.hpp"
 #include "share/util/scream_timing.hpp"
 #include "share/util/scream_utils.hpp"
+#include "share/util/scream_universal_constants.hpp"
 #include "share/io/scream_io_utils.hpp"
 #include "share/property_checks/mass_and_energy_column_conservation_check.hpp"
 
@@ -218,6 +220,7 @@ void AtmosphereDriver::create_atm_processes()
   auto& atm_proc_params = m_atm_params.sublist("atmosphere_processes");
   atm_proc_params.rename("EAMxx");
   atm_proc_params.set("Logger",m_atm_logger);
+  atm_proc_params.set("auto_bundle_groups",m_atm_params.sublist("driver_options").get("auto_bundle_groups",false));
   m_atm_process_group = std::make_shared<AtmosphereProcessGroup>(m_atm_comm,atm_proc_params);
 
   m_ad_status |= s_procs_created;
@@ -378,9 +381,9 @@ void AtmosphereDriver::reset_accumulated_fields ()
     }
 
     auto accum_group = fm->get_field_group("ACCUMULATED");
+    accum_group.deep_copy(zero);
     for (auto f_it : accum_group.m_fields) {
       auto& track = f_it.second->get_header().get_tracking();
-      f_it.second->deep_copy(zero);
       track.set_accum_start_time(m_current_ts);
     }
   }
@@ -496,6 +499,204 @@ void AtmosphereDriver::add_additional_column_data_to_property_checks () {
   }
 }
 
+namespace {
+// Gather the atm procs in the tree rooted at group in execution order.
+// For each subcycled group, also store the range of gathered procs it contains.
+void gather_atm_procs_in_run_order (const std::shared_ptr<AtmosphereProcessGroup>& group,
+                                    std::vector<std::shared_ptr<AtmosphereProcess>>& procs,
+                                    std::vector<std::pair<int,int>>& subcycled_ranges)
+{
+  const int first = procs.size();
+  for (int i=0; i<group->get_num_processes(); ++i) {
+    auto proc = group->get_process_nonconst(i);
+    if (proc->type()==AtmosphereProcessType::Group) {
+      auto sub_group = std::dynamic_pointer_cast<AtmosphereProcessGroup>(proc);
+      gather_atm_procs_in_run_order(sub_group,procs,subcycled_ranges);
+    } else {
+      procs.push_back(proc);
+    }
+  }
+  const int last = static_cast<int>(procs.size())-1;
+  if (group->get_num_subcycles()>1 and last>=first) {
+    subcycled_ranges.emplace_back(first,last);
+  }
+}
+
+// Add to names the fields of fm needed to write the output field oname: either oname
+// itself, or (recursively) the inputs of the output diagnostic that computes it.
+void gather_output_field_inputs (const std::string& oname,
+                                 const std::shared_ptr<FieldManager>& fm,
+                                 const std::shared_ptr<const GridsManager>& gm,
+                                 const ekat::Comm& comm,
+                                 std::set<std::string>& names)
+{
+  if (fm->has_field(oname)) {
+    names.insert(oname);
+    return;
+  }
+
+  ekat::ParameterList params;
+  std::string avg_cnt_suffix;
+  const auto fill_value = constants::DefaultFillValue<float>().value;
+  const auto diag_name = get_diagnostic_params(oname,fm->get_grid()->name(),fill_value,params,avg_cnt_suffix);
+  auto diag = AtmosphereDiagnosticFactory::instance().create(diag_name,comm,params);
+  diag->set_grids(gm);
+  for (const auto& req : diag->get_required_field_requests()) {
+    gather_output_field_inputs(req.fid.name(),fm,gm,comm,names);
+  }
+}
+} // anonymous namespace
+
+void AtmosphereDriver::set_transient_fields ()
+{
+  // A field is transient if, within the time step, it is computed by an atm proc before any
+  // atm proc requires it. Its value at the beginning of the time step is then irrelevant, and
+  // the field only needs to hold valid data from the first atm proc that computes it to the
+  // last atm proc that uses it. The "stages" of the live range are the atm procs indices
+  // in execution order.
+  std::vector<std::shared_ptr<AtmosphereProcess>> procs;
+  std::vector<std::pair<int,int>> subcycled_ranges;
+  gather_atm_procs_in_run_order(m_atm_process_group,procs,subcycled_ranges);
+
+  using key_t = std::pair<std::string,std::string>; // (grid name, field name)
+  std::map<key_t,std::pair<int,int>> live_ranges;
+  std::set<key_t> not_transient;
+  for (int i=0; i<static_cast<int>(procs.size()); ++i) {
+    // Process required fields first, so that updated fields are not transient,
+    // unless an atm proc before this one computed them.
+    for (const auto& req : procs[i]->get_required_field_requests()) {
+      const key_t key(req.fid.get_grid_name(),req.fid.name());
+      auto it = live_ranges.find(key);
+      if (it==live_ranges.end()) {
+        not_transient.insert(key);
+      } else {
+        it->second.second = i;
+      }
+    }
+    for (const auto& req : procs[i]->get_computed_field_requests()) {
+      const key_t key(req.fid.get_grid_name(),req.fid.name());
+      if (not_transient.count(key)==1) {
+        continue;
+      }
+      auto it = live_ranges.find(key);
+      if (it==live_ranges.end()) {
+        live_ranges[key] = std::make_pair(i,i);
+      } else {
+        it->second.second = i;
+      }
+    }
+  }
+
+  // Fields that some atm proc does not recompute every time it runs carry information
+  // across time steps, so they are not transient
+  for (const auto& p : procs) {
+    for (const auto& key : p->get_persistent_fields()) {
+      live_ranges.erase(key);
+    }
+  }
+
+  // A subcycled group runs its atm procs multiple times, so a field used within it
+  // must stay alive during the whole group
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    for (auto& it : live_ranges) {
+      auto& range = it.second;
+      for (const auto& sc : subcycled_ranges) {
+        const bool overlap = range.first<=sc.second and sc.first<=range.second;
+        if (overlap and (sc.first<range.first or sc.second>range.second)) {
+          range.first  = std::min(range.first,sc.first);
+          range.second = std::max(range.second,sc.second);
+          changed = true;
+        }
+      }
+    }
+  }
+
+  // Fields accessed outside of the atm procs must keep their own memory. These are the
+  // fields in the output streams (or used to compute output diagnostics), and the fields
+  // used by the property checks that the AD adds to the atm procs. Note: fields in
+  // the RESTART group are atm procs inputs, so they are not transient anyways.
+  using vos_t = std::vector<std::string>;
+  std::set<std::string> outside_names;
+  auto& driver_options_pl = m_atm_params.sublist("driver_options");
+  for (const auto& n : driver_options_pl.get<vos_t>("property_check_data_fields",{"NONE"})) {
+    outside_names.insert(n);
+  }
+  if (m_atm_process_group->are_column_conservation_checks_enabled()) {
+    for (const auto& n : {"pseudo_density","ps","phis","horiz_winds","T_mid","qv","qc","qr","qi",
+                          "vapor_flux","water_flux","ice_flux","heat_flux"}) {
+      outside_names.insert(n);
+    }
+  }
+
+  // For output diagnostics, build the diagnostic and ask it what fields it needs.
+  // The streams are set up as in OutputManager: if there is only one field manager,
+  // there is one stream, on its grid; otherwise, there is one stream for each grid
+  // listed in the 'Fields' sublist. Besides the output fields, the remappers of a
+  // stream read their inputs on the stream grid (e.g., p_mid/p_int for vertical remap).
+  auto get_stream_fields = [](const ekat::ParameterList& pl) {
+    vos_t names;
+    if (pl.isType<vos_t>("Field Names")) {
+      names = pl.get<vos_t>("Field Names");
+    } else if (pl.isType<std::string>("Field Names")) {
+      const auto& n = pl.get<std::string>("Field Names");
+      if (n!="NONE") {
+        names.push_back(n);
+      }
+    }
+    return names;
+  };
+  auto& io_params = m_atm_params.sublist("Scorpio");
+  for (const auto& fname : io_params.get<vos_t>("output_yaml_files",vos_t{})) {
+    ekat::ParameterList params;
+    ekat::parse_yaml_file(fname,params);
+
+    std::vector<std::pair<field_mgr_ptr,vos_t>> streams;
+    if (m_field_mgrs.size()==1) {
+      const auto& fm = m_field_mgrs.begin()->second;
+      if (params.isParameter("Field Names")) {
+        streams.emplace_back(fm,get_stream_fields(params));
+      } else if (params.isSublist("Fields")) {
+        const auto& fields_pl = params.sublist("Fields");
+        for (const auto& gname : fm->get_grid()->aliases()) {
+          if (fields_pl.isSublist(gname)) {
+            streams.emplace_back(fm,get_stream_fields(fields_pl.sublist(gname)));
+            break;
+          }
+        }
+      }
+    } else if (params.isSublist("Fields")) {
+      const auto& fields_pl = params.sublist("Fields");
+      for (auto it=fields_pl.sublists_names_cbegin(); it!=fields_pl.sublists_names_cend(); ++it) {
+        // If there's no field manager for this grid, OutputManager will error out
+        if (m_field_mgrs.count(*it)==1) {
+          streams.emplace_back(m_field_mgrs.at(*it),get_stream_fields(fields_pl.sublist(*it)));
+        }
+      }
+    }
+
+    if (params.isParameter("vertical_remap_file")) {
+      outside_names.insert("p_mid");
+      outside_names.insert("p_int");
+    }
+    for (const auto& [fm,names] : streams) {
+      for (const auto& n : names) {
+        gather_output_field_inputs(n,fm,m_grids_manager,m_atm_comm,outside_names);
+      }
+    }
+  }
+
+  for (const auto& it : live_ranges) {
+    const auto& grid_name = it.first.first;
+    const auto& fname = it.first.second;
+    if (outside_names.count(fname)==1) {
+      continue;
+    }
+    m_field_mgrs.at(grid_name)->set_transient_field(fname,it.second.first,it.second.second);
+  }
+}
+
 void AtmosphereDriver::create_fields()
 {
   m_atm_logger->info("[EAMxx] create_fields ...");
@@ -505,11 +706,45 @@ void AtmosphereDriver::create_fields()
   // Must have grids and procs at this point
   check_ad_status (s_procs_created | s_grids_created);
 
+  // Atm procs that update their outputs every N>1 steps hold them in between. The atm procs
+  // requiring these outputs must then run every multiple of N steps, or they would use stale values.
+  {
+    std::vector<std::shared_ptr<AtmosphereProcess>> procs;
+    std::vector<std::pair<int,int>> subcycled_ranges;
+    gather_atm_procs_in_run_order(m_atm_process_group,procs,subcycled_ranges);
+
+    using key_t = std::pair<std::string,std::string>; // (grid name, field name)
+    std::map<key_t,std::shared_ptr<AtmosphereProcess>> producers;
+    for (const auto& p : procs) {
+      if (p->get_update_frequency()>1) {
+        for (const auto& req : p->get_computed_field_requests()) {
+          producers[key_t(req.fid.get_grid_name(),req.fid.name())] = p;
+        }
+      }
+    }
+    for (const auto& p : procs) {
+      for (const auto& req : p->get_required_field_requests()) {
+        auto it = producers.find(key_t(req.fid.get_grid_name(),req.fid.name()));
+        if (it==producers.end() or it->second==p or p->get_update_frequency()==0) {
+          continue;
+        }
+        const int freq = it->second->get_update_frequency();
+        EKAT_REQUIRE_MSG (p->get_update_frequency() % freq == 0,
+            "Error! Atm proc '" + p->name() + "' requires field '" + req.fid.name() + "',\n"
+            "  which atm proc '" + it->second->name() + "' updates only every " + std::to_string(freq) + " steps.\n"
+            "  The update frequency of '" + p->name() + "' (" + std::to_string(p->get_update_frequency()) + " steps)\n"
+            "  must be a multiple of it (e.g., mam4_optics_frequency must divide rad_frequency).\n");
+      }
+    }
+  }
+
   // By now, the processes should have fully built the ids of their
   // required/computed fields and groups. Let them register them in the FM
+  const bool auto_bundle = m_atm_params.sublist("driver_options").get("auto_bundle_groups",false);
   for (auto it : m_grids_manager->get_repo()) {
     auto grid = it.second;
     m_field_mgrs[grid->name()] = std::make_shared<field_mgr_type>(grid);
+    m_field_mgrs[grid->name()]->set_auto_bundle_groups(auto_bundle);
     m_field_mgrs[grid->name()]->registration_begins();
   }
 
@@ -586,11 +821,24 @@ void AtmosphereDriver::create_fields()
   process_imported_groups (m_atm_process_group->get_required_group_requests());
   process_imported_groups (m_atm_process_group->get_computed_group_requests());
 
+  // Let fields that are needed only within a portion of the time step share memory
+  auto& driver_options_pl = m_atm_params.sublist("driver_options");
+  const bool share_memory = driver_options_pl.get("share_transient_fields_memory",false);
+  if (share_memory) {
+    set_transient_fields ();
+  }
+
   // Close the FM's, allocate all fields
   for (auto it : m_grids_manager->get_repo()) {
     auto grid = it.second;
     auto fm = m_field_mgrs.at(grid->name());
     fm->registration_ends();
+    if (share_memory) {
+      const auto nfields = fm->get_shared_memory_fields().size();
+      const auto savings = fm->get_shared_memory_savings() / (1024.0*1024.0);
+      m_atm_logger->info("  [EAMxx] Grid " + grid->name() + ": " + std::to_string(nfields) +
+                         " transient fields share memory, saving " + std::to_string(savings) + " MB.");
+    }
   }
 
   // Set all the fields/groups in the processes. Input fields/groups will be handed
@@ -622,6 +870,21 @@ void AtmosphereDriver::create_fields()
     m_atm_process_group->set_required_field(fm->get_field(fid).get_const());
   }
 
+  // If requested, poison the transient fields that share memory at the beginning of
+  // the first atm proc of their live range, to catch atm procs that violate
+  // the assumptions of the liveness analysis (see set_transient_fields).
+  if (share_memory and driver_options_pl.get("poison_transient_fields",false)) {
+    std::vector<std::shared_ptr<AtmosphereProcess>> procs;
+    std::vector<std::pair<int,int>> subcycled_ranges;
+    gather_atm_procs_in_run_order(m_atm_process_group,procs,subcycled_ranges);
+    for (const auto& it : m_field_mgrs) {
+      const auto& fm = it.second;
+      for (const auto& f : fm->get_shared_memory_fields()) {
+        procs[f.second.first]->add_field_to_poison(fm->get_field(f.first));
+      }
+    }
+  }
+
   // Now that all processes have all the required/computed fields/groups, they
   // have also created any possible internal field (if needed). Notice that some
   // atm proc might have created internal fields already during the set_grids
@@ -1625,14 +1888,26 @@ void AtmosphereDriver::run (const int dt) {
     }
 
     auto rescale_group = fm->get_field_group("DIVIDE_BY_DT");
-    for (auto f_it : rescale_group.m_fields) {
-      f_it.second->scale(Real(1) / dt);
-    }
+    rescale_group.scale(Real(1) / dt);
   }
 
   // Update current time stamps
   m_current_ts += dt;
 
+  // Work still pending in the atm procs (e.g., an asynchronous computation) is not
+  // saved in the restart files, so complete it before writing them.
+  for (const auto& out_mgr : m_output_managers) {
+    if (out_mgr.is_model_restart_write_step(m_current_ts)) {
+      std::vector<std::shared_ptr<AtmosphereProcess>> procs;
+      std::vector<std::pair<int,int>> subcycled_ranges;
+      gather_atm_procs_in_run_order(m_atm_process_group,procs,subcycled_ranges);
+      for (const auto& proc : procs) {
+        proc->complete_pending_work();
+      }
+      break;
+    }
+  }
+
   // Update output streams
   m_atm_logger->debug("[EAMxx::run] running output managers...");
   for (auto& out_mgr : m_output_managers) {
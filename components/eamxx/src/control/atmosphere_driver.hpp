@@ -193,6 +193,10 @@ protected:
                               const util::TimeStamp& t0);
   void register_groups ();
 
+  // Declare as transient the fields that are needed only within a portion of the time step,
+  // so that the field managers can let them share memory (see FieldManager::set_transient_field)
+  void set_transient_fields ();
+
   std::map<std::string,field_mgr_ptr>       m_field_mgrs;
 
   std::shared_ptr<AtmosphereProcessGroup>   m_atm_process_group;
@@ -78,4 +78,69 @@ TEST_CASE ("ad_tests","[!throws]")
   dummy_atm_cleanup();
 }
 
+TEST_CASE ("transient_fields","[!throws]")
+{
+  // Load ad parameter list
+  std::string fname = "ad_transient_tests.yaml";
+  ekat::ParameterList ad_params("Atmosphere Driver");
+  parse_yaml_file(fname,ad_params);
+
+  // Create a comm
+  ekat::Comm atm_comm (MPI_COMM_WORLD);
+
+  // Setup the atm factories and grid manager
+  dummy_atm_init();
+
+  // Create the driver
+  control::AtmosphereDriver ad;
+
+  util::TimeStamp t0(2000,1,1,0,0,0);
+  ad.initialize(atm_comm,ad_params,t0);
+
+  // Live ranges (stages 0-3): X=[0,1], Y=[1,2], Z=[2,3]. A is an input of stage 0,
+  // and H is persistent, so neither is transient. X and Z share memory, while Y
+  // overlaps with both, and the only field with a live range disjoint from Y is H.
+  auto fm = ad.get_field_mgr("Point Grid");
+  const auto& shared = fm->get_shared_memory_fields();
+  REQUIRE (shared.size()==2);
+  REQUIRE (shared.count("X")==1);
+  REQUIRE (shared.count("Z")==1);
+  REQUIRE (shared.at("X")==std::make_pair(0,1));
+  REQUIRE (shared.at("Z")==std::make_pair(2,3));
+  const auto X = fm->get_field("X");
+  const auto Y = fm->get_field("Y");
+  const auto Z = fm->get_field("Z");
+  const auto H = fm->get_field("H");
+  REQUIRE (Z.get_internal_view_data<Real>()==X.get_internal_view_data<Real>());
+  REQUIRE (Y.get_internal_view_data<Real>()!=X.get_internal_view_data<Real>());
+  REQUIRE (H.get_internal_view_data<Real>()!=Y.get_internal_view_data<Real>());
+
+  // Each stage finds its computed field poisoned at the beginning of its run (Z would
+  // otherwise contain X), and the results are not affected by the memory sharing.
+  const auto& apg = ad.get_atm_processes();
+  auto stage3 = std::dynamic_pointer_cast<TransientProcess>(apg->get_process_nonconst(2));
+  REQUIRE (stage3!=nullptr);
+  const auto A = fm->get_field("A");
+  const int size = A.get_header().get_identifier().get_layout().size();
+  Real a = 1;
+  for (int n=0; n<3; ++n) {
+    ad.run(10);
+    REQUIRE (stage3->num_nans_at_start()==size);
+
+    a = 2*(a+1)+1;
+    REQUIRE (field_min<Real>(A)==a);
+    REQUIRE (field_max<Real>(A)==a);
+    REQUIRE (field_min<Real>(Z)==a);
+    REQUIRE (field_max<Real>(Z)==a);
+
+    // H is computed only at the first run, and must not be overwritten
+    REQUIRE (field_min<Real>(H)==7);
+    REQUIRE (field_max<Real>(H)==7);
+  }
+
+  // Cleanup
+  ad.finalize ();
+  dummy_atm_cleanup();
+}
+
 } // namespace scream
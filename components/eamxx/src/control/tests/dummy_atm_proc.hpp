@@ -4,6 +4,8 @@
 
 #include "ekat/ekat_pack.hpp"
 
+#include <cmath>
+
 namespace scream {
 
 // === A dummy atm process, on Physics grid === //
@@ -131,4 +133,109 @@ protected:
   DummyType     m_dummy_type; 
 };
 
+// === A chain of atm procs, to test transient fields sharing memory === //
+//  - stage 1: X = A+1
+//  - stage 2: Y = 2*X
+//  - stage 3: Z = Y+1
+//  - stage 4: A = Z, and H = 7 (only the first time it runs, so H is persistent)
+// X and Z have disjoint live ranges, and so do Y and H (if H was not persistent).
+
+class TransientProcess : public scream::AtmosphereProcess {
+public:
+  TransientProcess (const ekat::Comm& comm, const ekat::ParameterList& params)
+    : AtmosphereProcess(comm, params)
+  {
+    m_stage = m_params.get<int>("Stage");
+  }
+
+  AtmosphereProcessType type () const { return AtmosphereProcessType::Physics; }
+
+  std::string name () const { return "Transient Stage " + std::to_string(m_stage); }
+
+  void set_grids (const std::shared_ptr<const GridsManager> grids_manager) {
+    using namespace ShortFieldTagsNames;
+
+    m_grid = grids_manager->get_grid(m_params.get<std::string>("Grid Name"));
+
+    const auto num_cols = m_grid->get_num_local_dofs();
+    const auto num_levs = m_grid->get_num_vertical_levels();
+
+    FieldLayout layout ({COL,LEV},{num_cols,num_levs});
+    const auto& gn = m_grid->name();
+    const auto m = ekat::units::m;
+    switch (m_stage) {
+      case 1:
+        add_field<Required>("A",layout,m,gn);
+        add_field<Computed>("X",layout,m,gn);
+        break;
+      case 2:
+        add_field<Required>("X",layout,m,gn);
+        add_field<Computed>("Y",layout,m,gn);
+        break;
+      case 3:
+        add_field<Required>("Y",layout,m,gn);
+        add_field<Computed>("Z",layout,m,gn);
+        break;
+      case 4:
+        add_field<Required>("Z",layout,m,gn);
+        add_field<Computed>("A",layout,m,gn);
+        add_field<Computed>("H",layout,m,gn);
+        set_field_persistent("H",gn);
+        break;
+      default:
+        EKAT_ERROR_MSG ("Error! Invalid stage for TransientProcess.\n");
+    }
+  }
+
+  // Number of NaN entries found in the computed field at the beginning of the last run
+  int num_nans_at_start () const { return m_num_nans; }
+
+protected:
+
+  void initialize_impl (const RunType /* run_type */) {
+    // Do nothing
+  }
+
+  void run_impl (const double /* dt */) {
+    const std::string in  = m_stage==1 ? "A" : (m_stage==2 ? "X" : (m_stage==3 ? "Y" : "Z"));
+    const std::string out = m_stage==1 ? "X" : (m_stage==2 ? "Y" : (m_stage==3 ? "Z" : "A"));
+
+    auto f_in  = get_field_in(in);
+    auto f_out = get_field_out(out);
+    f_in.sync_to_host();
+    f_out.sync_to_host();
+    const auto v_in  = f_in.get_view<const Real**,Host>();
+    const auto v_out = f_out.get_view<Real**,Host>();
+
+    m_num_nans = 0;
+    for (int i=0; i<static_cast<int>(v_out.extent(0)); ++i) {
+      for (int k=0; k<static_cast<int>(v_out.extent(1)); ++k) {
+        m_num_nans += std::isnan(v_out(i,k)) ? 1 : 0;
+        switch (m_stage) {
+          case 1: v_out(i,k) = v_in(i,k)+1; break;
+          case 2: v_out(i,k) = 2*v_in(i,k); break;
+          default: v_out(i,k) = v_in(i,k) + (m_stage==3 ? 1 : 0);
+        }
+      }
+    }
+    f_out.sync_to_dev();
+
+    if (m_stage==4 and not m_h_computed) {
+      get_field_out("H").deep_copy(7.0);
+      m_h_computed = true;
+    }
+  }
+
+  void finalize_impl () {
+    // Do nothing
+  }
+
+  std::shared_ptr<const AbstractGrid>   m_grid;
+
+  int   m_stage;
+  int   m_num_nans = 0;
+  bool  m_h_computed = false;
+};
+
+
 } // namespace scream
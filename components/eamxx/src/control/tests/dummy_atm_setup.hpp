@@ -16,6 +16,7 @@ inline void dummy_atm_init () {
   // While we're at it, check that the case insensitive key of the factory works.
   auto& proc_factory = AtmosphereProcessFactory::instance();
   proc_factory.register_product("Dummy",&create_atmosphere_process<DummyProcess>);
+  proc_factory.register_product("Transient",&create_atmosphere_process<TransientProcess>);
 
   // Need to register grids managers before we create the driver
   auto& gm_factory = GridsManagerFactory::instance();
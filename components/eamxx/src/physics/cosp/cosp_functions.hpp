@@ -1,6 +1,9 @@
 #ifndef SCREAM_COSP_FUNCTIONS_HPP
 #define SCREAM_COSP_FUNCTIONS_HPP
 #include "share/scream_types.hpp"
+
+#include <vector>
+
 using scream::Real;
 extern "C" void cosp_c2f_init(int ncol, int nsubcol, int nlay);
 extern "C" void cosp_c2f_final();
@@ -94,6 +97,87 @@ namespace scream {
                 }
             }
         }
+
+        // Host copies of the COSP inputs/outputs on a subset of the columns (e.g., the
+        // sunlit ones), already permuted for the F90 bridge. Since it holds its own copy
+        // of the inputs, COSP can run on it while the atm state keeps being updated.
+        struct ColumnSubset {
+            Int ncol = 0;
+            view_1d<Int> cols;  // Index of each entry in the full set of columns
+            lview_host_1d sunlit, skt, isccp_cldtot;
+            lview_host_2d T_mid, p_mid, p_int, z_mid, qv, qc, qi, cldfrac,
+                          reff_qc, reff_qi, dtau067, dtau105;
+            lview_host_3d isccp_ctptau, modis_ctptau, misr_cthtau;
+        };
+
+        inline ColumnSubset gather_columns(
+                const Int nlay, const Int ntau, const Int nctp, const Int ncth, const std::vector<Int>& cols,
+                const view_1d<const Real>& sunlit , const view_1d<const Real>& skt,
+                const view_2d<const Real>& T_mid  , const view_2d<const Real>& p_mid  , const view_2d<const Real>& p_int,
+                const view_2d<const Real>& z_mid  , const view_2d<const Real>& qv     , const view_2d<const Real>& qc,
+                const view_2d<const Real>& qi     , const view_2d<const Real>& cldfrac,
+                const view_2d<const Real>& reff_qc, const view_2d<const Real>& reff_qi,
+                const view_2d<const Real>& dtau067, const view_2d<const Real>& dtau105) {
+            const Int ncol = cols.size();
+            ColumnSubset s;
+            s.ncol = ncol;
+            s.cols = view_1d<Int>("cols", ncol);
+            s.sunlit = lview_host_1d("sunlit_h", ncol);
+            s.skt = lview_host_1d("skt_h", ncol);
+            s.isccp_cldtot = lview_host_1d("isccp_cldtot_h", ncol);
+            s.T_mid = lview_host_2d("T_mid_h", ncol, nlay);
+            s.p_mid = lview_host_2d("p_mid_h", ncol, nlay);
+            s.p_int = lview_host_2d("p_int_h", ncol, nlay+1);
+            s.z_mid = lview_host_2d("z_mid_h", ncol, nlay);
+            s.qv = lview_host_2d("qv_h", ncol, nlay);
+            s.qc = lview_host_2d("qc_h", ncol, nlay);
+            s.qi = lview_host_2d("qi_h", ncol, nlay);
+            s.cldfrac = lview_host_2d("cldfrac_h", ncol, nlay);
+            s.reff_qc = lview_host_2d("reff_qc_h", ncol, nlay);
+            s.reff_qi = lview_host_2d("reff_qi_h", ncol, nlay);
+            s.dtau067 = lview_host_2d("dtau067_h", ncol, nlay);
+            s.dtau105 = lview_host_2d("dtau105_h", ncol, nlay);
+            s.isccp_ctptau = lview_host_3d("isccp_ctptau_h", ncol, ntau, nctp);
+            s.modis_ctptau = lview_host_3d("modis_ctptau_h", ncol, ntau, nctp);
+            s.misr_cthtau  = lview_host_3d("misr_cthtau_h", ncol, ntau, ncth);
+
+            // Copy the selected columns to layoutLeft host views
+            for (int ic = 0; ic < ncol; ic++) {
+                const int i = cols[ic];
+                s.cols(ic) = i;
+                s.sunlit(ic) = sunlit(i);
+                s.skt(ic) = skt(i);
+                for (int j = 0; j < nlay; j++) {
+                    s.T_mid(ic,j) = T_mid(i,j);
+                    s.p_mid(ic,j) = p_mid(i,j);
+                    s.z_mid(ic,j) = z_mid(i,j);
+                    s.qv(ic,j) = qv(i,j);
+                    s.qc(ic,j) = qc(i,j);
+                    s.qi(ic,j) = qi(i,j);
+                    s.cldfrac(ic,j) = cldfrac(i,j);
+                    s.reff_qc(ic,j) = reff_qc(i,j);
+                    s.reff_qi(ic,j) = reff_qi(i,j);
+                    s.dtau067(ic,j) = dtau067(i,j);
+                    s.dtau105(ic,j) = dtau105(i,j);
+                }
+                for (int j = 0; j < nlay+1; j++) {
+                    s.p_int(ic,j) = p_int(i,j);
+                }
+            }
+            return s;
+        }
+
+        // NOTE: this does not call any Kokkos function, so it is safe to call it
+        //       from a thread that is not managed by Kokkos
+        inline void main(
+                const Int nsubcol, const Int nlay, const Int ntau, const Int nctp, const Int ncth,
+                const Real emsfc_lw, ColumnSubset& s) {
+            cosp_c2f_run(s.ncol, nsubcol, nlay, ntau, nctp, ncth,
+                    emsfc_lw, s.sunlit.data(), s.skt.data(), s.T_mid.data(), s.p_mid.data(), s.p_int.data(),
+                    s.z_mid.data(), s.qv.data(), s.qc.data(), s.qi.data(),
+                    s.cldfrac.data(), s.reff_qc.data(), s.reff_qi.data(), s.dtau067.data(), s.dtau105.data(),
+                    s.isccp_cldtot.data(), s.isccp_ctptau.data(), s.modis_ctptau.data(), s.misr_cthtau.data());
+        }
     }
 }
 #endif  /* SCREAM_COSP_FUNCTIONS_HPP */
@@ -7,10 +7,27 @@
 
 #include "share/field/field_utils.hpp"
 
+#include <algorithm>
 #include <array>
 
 namespace scream
 {
+
+namespace {
+// Entry point of the COSP thread. Exceptions cannot cross the thread boundary,
+// so we store them, and rethrow them when the thread is joined.
+void* run_cosp_job (void* arg)
+{
+  auto job = static_cast<Cosp::AsyncJob*>(arg);
+  try {
+    job->task();
+  } catch (...) {
+    job->error = std::current_exception();
+  }
+  return nullptr;
+}
+} // anonymous namespace
+
 // =========================================================================================
 Cosp::Cosp (const ekat::Comm& comm, const ekat::ParameterList& params)
   : AtmosphereProcess(comm, params)
@@ -25,6 +42,9 @@ Cosp::Cosp (const ekat::Comm& comm, const ekat::ParameterList& params)
 
   // How many subcolumns to use for COSP
   m_num_subcols = m_params.get<Int>("cosp_subcolumns", 10);
+
+  // Whether to run COSP on a host thread, overlapped with the next atm step
+  m_run_async = m_params.get<bool>("cosp_async", false);
 }
 
 // =========================================================================================
@@ -93,6 +113,11 @@ void Cosp::set_grids(const std::shared_ptr<const GridsManager> grids_manager)
   add_field<Computed>("modis_ctptau", scalar4d_ctptau, percent, grid_name, 1);
   add_field<Computed>("misr_cthtau", scalar4d_cthtau, percent, grid_name, 1);
   add_field<Computed>("cosp_sunlit", scalar2d, nondim, grid_name);
+
+  // If COSP does not run every step (or its outputs lag one step), its outputs are held
+  if (m_run_async or m_cosp_frequency_units!="steps" or m_cosp_frequency>1) {
+    set_computed_fields_persistent();
+  }
 }
 
 // =========================================================================================
@@ -134,6 +159,11 @@ void Cosp::run_impl (const double dt)
   auto ts = timestamp();
   auto update_cosp = cosp_do(cosp_freq_in_steps, ts.get_num_steps());
 
+  if (m_run_async) {
+    run_async(update_cosp);
+    return;
+  }
+
   // Get fields from field manager; note that we get host views because this
   // interface serves primarily as a wrapper to a c++ to f90 bridge for the COSP
   // all then need to be copied to layoutLeft views to permute the indices for
@@ -164,8 +194,6 @@ void Cosp::run_impl (const double dt)
   auto T_mid   = get_field_in("T_mid").get_view<const Real**, Host>();
   auto p_mid   = get_field_in("p_mid").get_view<const Real**, Host>();
   auto p_int   = get_field_in("p_int").get_view<const Real**, Host>();
-  auto phis    = get_field_in("phis").get_view<const Real*, Host>();
-  auto pseudo_density = get_field_in("pseudo_density").get_view<const Real**, Host>();
   auto cldfrac = get_field_in("cldfrac_rad").get_view<const Real**, Host>();
   auto reff_qc = get_field_in("eff_radius_qc").get_view<const Real**, Host>();
   auto reff_qi = get_field_in("eff_radius_qi").get_view<const Real**, Host>();
@@ -178,31 +206,7 @@ void Cosp::run_impl (const double dt)
   auto cosp_sunlit  = get_field_out("cosp_sunlit").get_view<Real*, Host>();  // Copy of sunlit flag with COSP frequency for proper averaging
 
   // Compute heights
-  const auto z_mid = CospFunc::view_2d<Real>("z_mid", m_num_cols, m_num_levs);
-  const auto z_int = CospFunc::view_2d<Real>("z_int", m_num_cols, m_num_levs+1);
-  const auto dz = z_mid;  // reuse tmp memory for dz
-  const auto ncol = m_num_cols;
-  const auto nlev = m_num_levs;
-  // calculate_z_int contains a team-level parallel_scan, which requires a special policy
-  // TODO: do this on device?
-  const auto scan_policy = ekat::ExeSpaceUtils<KTH::ExeSpace>::get_thread_range_parallel_scan_team_policy(ncol, nlev);
-  Kokkos::parallel_for(scan_policy, KOKKOS_LAMBDA (const KTH::MemberType& team) {
-      const int i = team.league_rank();
-      const auto dz_s    = ekat::subview(dz,    i);
-      const auto p_mid_s = ekat::subview(p_mid, i);
-      const auto T_mid_s = ekat::subview(T_mid, i);
-      const auto qv_s = ekat::subview(qv, i);
-      const auto z_int_s = ekat::subview(z_int, i);
-      const auto z_mid_s = ekat::subview(z_mid, i);
-      const Real z_surf  = phis(i) / 9.81;
-      const auto pseudo_density_s = ekat::subview(pseudo_density, i);
-      PF::calculate_dz(team, pseudo_density_s, p_mid_s, T_mid_s, qv_s, dz_s);
-      team.team_barrier();
-      PF::calculate_z_int(team,nlev,dz_s,z_surf,z_int_s);
-      team.team_barrier();
-      PF::calculate_z_mid(team,nlev,z_int_s,z_mid_s);
-      team.team_barrier();
-  });
+  const auto z_mid = compute_z_mid();
 
   // Call COSP wrapper routines
   if (update_cosp) {
@@ -254,9 +258,199 @@ void Cosp::run_impl (const double dt)
   get_field_out("cosp_sunlit").sync_to_dev();
 }
 
+// =========================================================================================
+CospFunc::view_2d<Real> Cosp::compute_z_mid () const
+{
+  auto qv      = get_field_in("qv").get_view<const Real**, Host>();
+  auto T_mid   = get_field_in("T_mid").get_view<const Real**, Host>();
+  auto p_mid   = get_field_in("p_mid").get_view<const Real**, Host>();
+  auto phis    = get_field_in("phis").get_view<const Real*, Host>();
+  auto pseudo_density = get_field_in("pseudo_density").get_view<const Real**, Host>();
+
+  const auto z_mid = CospFunc::view_2d<Real>("z_mid", m_num_cols, m_num_levs);
+  const auto z_int = CospFunc::view_2d<Real>("z_int", m_num_cols, m_num_levs+1);
+  const auto dz = z_mid;  // reuse tmp memory for dz
+  const auto ncol = m_num_cols;
+  const auto nlev = m_num_levs;
+  // calculate_z_int contains a team-level parallel_scan, which requires a special policy
+  // TODO: do this on device?
+  const auto scan_policy = ekat::ExeSpaceUtils<KTH::ExeSpace>::get_thread_range_parallel_scan_team_policy(ncol, nlev);
+  Kokkos::parallel_for(scan_policy, KOKKOS_LAMBDA (const KTH::MemberType& team) {
+      const int i = team.league_rank();
+      const auto dz_s    = ekat::subview(dz,    i);
+      const auto p_mid_s = ekat::subview(p_mid, i);
+      const auto T_mid_s = ekat::subview(T_mid, i);
+      const auto qv_s = ekat::subview(qv, i);
+      const auto z_int_s = ekat::subview(z_int, i);
+      const auto z_mid_s = ekat::subview(z_mid, i);
+      const Real z_surf  = phis(i) / 9.81;
+      const auto pseudo_density_s = ekat::subview(pseudo_density, i);
+      PF::calculate_dz(team, pseudo_density_s, p_mid_s, T_mid_s, qv_s, dz_s);
+      team.team_barrier();
+      PF::calculate_z_int(team,nlev,dz_s,z_surf,z_int_s);
+      team.team_barrier();
+      PF::calculate_z_mid(team,nlev,z_int_s,z_mid_s);
+      team.team_barrier();
+  });
+  Kokkos::fence();
+  return z_mid;
+}
+
+// =========================================================================================
+void Cosp::publish_async ()
+{
+  auto isccp_cldtot = get_field_out("isccp_cldtot").get_view<Real*, Host>();
+  auto isccp_ctptau = get_field_out("isccp_ctptau").get_view<Real***, Host>();
+  auto modis_ctptau = get_field_out("modis_ctptau").get_view<Real***, Host>();
+  auto misr_cthtau  = get_field_out("misr_cthtau").get_view<Real***, Host>();
+  auto cosp_sunlit  = get_field_out("cosp_sunlit").get_view<Real*, Host>();
+
+  // Night columns (and all columns, if no call is pending) get ZERO, as in the
+  // synchronous case (see run_impl for how to get the daytime means)
+  Kokkos::deep_copy(isccp_cldtot, 0.0);
+  Kokkos::deep_copy(isccp_ctptau, 0.0);
+  Kokkos::deep_copy(modis_ctptau, 0.0);
+  Kokkos::deep_copy(misr_cthtau, 0.0);
+  Kokkos::deep_copy(cosp_sunlit, 0.0);
+
+  if (m_async_pending) {
+    wait_async();
+    const auto& d = m_async_data;
+    for (int ic = 0; ic < d.ncol; ic++) {
+      const int i = d.cols(ic);
+      cosp_sunlit(i)  = d.sunlit(ic);
+      isccp_cldtot(i) = d.isccp_cldtot(ic);
+      for (int j = 0; j < m_num_tau; j++) {
+        for (int k = 0; k < m_num_ctp; k++) {
+          isccp_ctptau(i,j,k) = d.isccp_ctptau(ic,j,k);
+          modis_ctptau(i,j,k) = d.modis_ctptau(ic,j,k);
+        }
+        for (int k = 0; k < m_num_cth; k++) {
+          misr_cthtau(i,j,k) = d.misr_cthtau(ic,j,k);
+        }
+      }
+    }
+  }
+  get_field_out("isccp_cldtot").sync_to_dev();
+  get_field_out("isccp_ctptau").sync_to_dev();
+  get_field_out("modis_ctptau").sync_to_dev();
+  get_field_out("misr_cthtau").sync_to_dev();
+  get_field_out("cosp_sunlit").sync_to_dev();
+}
+
+// =========================================================================================
+void Cosp::complete_pending_work ()
+{
+  // A call is pending only right after a COSP step, and the synchronous path would
+  // have published its outputs at that step. Publishing them now makes the outputs
+  // (and the absence of pending work) the same as in a run restarted from here.
+  if (m_async_pending) {
+    publish_async();
+  }
+}
+
+// =========================================================================================
+void Cosp::run_async (const bool update_cosp)
+{
+  // Publish the outputs of the call launched at the previous COSP step
+  publish_async();
+
+  if (not update_cosp) {
+    return;
+  }
+
+  // Snapshot the inputs of the sunlit columns. Night columns are zeroed out anyway,
+  // so there is no need to run the simulators on them.
+  for (const auto& name : {"qv", "qc", "qi", "sunlit", "surf_radiative_T", "T_mid", "p_mid", "p_int",
+                           "cldfrac_rad", "eff_radius_qc", "eff_radius_qi", "dtau067", "dtau105",
+                           "phis", "pseudo_density"}) {
+    get_field_in(name).sync_to_host();
+  }
+  auto sunlit = get_field_in("sunlit").get_view<const Real*, Host>();
+  std::vector<Int> cols;
+  for (int i = 0; i < m_num_cols; i++) {
+    if (sunlit(i) != 0) {
+      cols.push_back(i);
+    }
+  }
+  if (cols.size()==0) {
+    return;
+  }
+  const CospFunc::view_2d<const Real> z_mid = compute_z_mid();
+  m_async_data = CospFunc::gather_columns(
+      m_num_levs, m_num_tau, m_num_ctp, m_num_cth, cols, sunlit,
+      get_field_in("surf_radiative_T").get_view<const Real*, Host>(),
+      get_field_in("T_mid").get_view<const Real**, Host>(),
+      get_field_in("p_mid").get_view<const Real**, Host>(),
+      get_field_in("p_int").get_view<const Real**, Host>(),
+      z_mid,
+      get_field_in("qv").get_view<const Real**, Host>(),
+      get_field_in("qc").get_view<const Real**, Host>(),
+      get_field_in("qi").get_view<const Real**, Host>(),
+      get_field_in("cldfrac_rad").get_view<const Real**, Host>(),
+      get_field_in("eff_radius_qc").get_view<const Real**, Host>(),
+      get_field_in("eff_radius_qi").get_view<const Real**, Host>(),
+      get_field_in("dtau067").get_view<const Real**, Host>(),
+      get_field_in("dtau105").get_view<const Real**, Host>());
+
+  // The thread only touches the snapshot, which is not modified (nor deallocated)
+  // until the call is waited on
+  auto data = &m_async_data;
+  const Int nsubcol = m_num_subcols, nlay = m_num_levs;
+  const Int ntau = m_num_tau, nctp = m_num_ctp, ncth = m_num_cth;
+  m_async_job.task = [=]() {
+    Real emsfc_lw = 0.99;
+    CospFunc::main(nsubcol, nlay, ntau, nctp, ncth, emsfc_lw, *data);
+  };
+  m_async_job.error = nullptr;
+
+  pthread_attr_t attr;
+  int err = pthread_attr_init(&attr);
+  EKAT_REQUIRE_MSG (err==0, "Error! Could not initialize the COSP thread attributes.\n");
+  err = pthread_attr_setstacksize(&attr, async_stack_size());
+  EKAT_REQUIRE_MSG (err==0,
+      "Error! Could not set the COSP thread stack size.\n"
+      "  - requested size (bytes): " + std::to_string(async_stack_size()) + "\n");
+  err = pthread_create(&m_async_thread, &attr, run_cosp_job, &m_async_job);
+  pthread_attr_destroy(&attr);
+  EKAT_REQUIRE_MSG (err==0, "Error! Could not launch the COSP thread.\n");
+  m_async_pending = true;
+}
+
+// =========================================================================================
+size_t Cosp::async_stack_size () const
+{
+  // The COSP driver (and the subcolumn generator it calls) keeps a few dozens of
+  // automatic arrays of size npoints*nlevels(+1), some of which also scale with
+  // the number of subcolumns. Pages are only committed when touched, so be generous.
+  const size_t min_size = size_t(64) << 20;
+  const size_t arrays_size = 32*sizeof(Real)*m_num_cols*(m_num_subcols+1)*(m_num_levs+1);
+  const size_t page = 4096;
+  return std::max(min_size, (arrays_size + page - 1) / page * page);
+}
+
+// =========================================================================================
+void Cosp::wait_async ()
+{
+  const int err = pthread_join(m_async_thread, nullptr);
+  m_async_pending = false;
+  EKAT_REQUIRE_MSG (err==0, "Error! Could not join the COSP thread.\n");
+
+  // Rethrow any exception thrown on the COSP thread
+  if (m_async_job.error) {
+    std::rethrow_exception(m_async_job.error);
+  }
+}
+
 // =========================================================================================
 void Cosp::finalize_impl()
 {
+  // The outputs of the last call (if still pending) would be published at the
+  // next step, which will not happen; we still need to wait for it to complete
+  if (m_async_pending) {
+    wait_async();
+  }
+
   // Finalize COSP wrappers
   CospFunc::finalize();
 }
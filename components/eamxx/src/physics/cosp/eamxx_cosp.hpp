@@ -3,8 +3,13 @@
 
 #include "share/atm_process/atmosphere_process.hpp"
 #include "share/util/scream_common_physics_functions.hpp"
+#include "cosp_functions.hpp"
 #include "ekat/ekat_parameter_list.hpp"
 
+#include <pthread.h>
+
+#include <exception>
+#include <functional>
 #include <string>
 
 namespace scream
@@ -24,6 +29,12 @@ public:
   using KT  = KokkosTypes<DefaultDevice>;
   using KTH = KokkosTypes<HostDevice>;
 
+  // A COSP call running on a host thread (see run_async)
+  struct AsyncJob {
+    std::function<void()> task;
+    std::exception_ptr    error;
+  };
+
   // Constructors
   Cosp (const ekat::Comm& comm, const ekat::ParameterList& params);
 
@@ -36,6 +47,9 @@ public:
   // Set the grid
   void set_grids (const std::shared_ptr<const GridsManager> grids_manager);
 
+  // Wait for the pending COSP call (if any), and publish its outputs
+  void complete_pending_work ();
+
   inline bool cosp_do(const int icosp, const int nstep) {
       // If icosp == 0, then never do cosp;
       // Otherwise, we always call cosp at the first step,
@@ -58,9 +72,26 @@ protected:
 public:
 #endif
   void run_impl        (const double dt);
+
+  // Compute z_mid on host from the (host) input fields
+  CospFunc::view_2d<Real> compute_z_mid () const;
+
+  // Publish the outputs of the pending COSP call (if any), and, if update_cosp=true,
+  // snapshot the inputs of the sunlit columns and launch COSP on a host thread
+  void run_async (const bool update_cosp);
+
+  // Set the outputs to zero, and to the outputs of the pending COSP call (if any)
+  // on its sunlit columns
+  void publish_async ();
 protected:
   void finalize_impl   ();
 
+  // Wait for the pending COSP call (if any) to complete
+  void wait_async ();
+
+  // Stack size (in bytes) of the COSP thread
+  size_t async_stack_size () const;
+
   // cosp frequency; positive is interpreted as number of steps, negative as number of hours
   int m_cosp_frequency;
   ekat::CaseInsensitiveString m_cosp_frequency_units;
@@ -75,6 +106,17 @@ protected:
 
   std::shared_ptr<const AbstractGrid> m_grid;
 
+  // If true, COSP runs on a host thread, overlapped with the next atm step,
+  // and its outputs are published at the following step
+  bool m_run_async;
+  // NOTE: we use a raw pthread (rather than std::async) so that we can set the
+  //       stack size: the COSP Fortran driver keeps O(npoints*nlevels*nsubcols)
+  //       automatic arrays, which overflow the default thread stack.
+  CospFunc::ColumnSubset m_async_data;
+  AsyncJob               m_async_job;
+  pthread_t              m_async_thread;
+  bool                   m_async_pending = false;
+
 }; // class Cosp
 
 } // namespace scream
@@ -65,6 +65,8 @@ void MAMMicrophysics::set_defaults_() {
   config_.amicphys.gaexch_h2so4_uptake_optaa = 2;
   config_.amicphys.newnuc_h2so4_conc_optaa = 2;
 
+  config_.split_chem_at_tropopause = false;
+
   //===========================================================
   // default data file locations (relative to SCREAM_DATA_DIR)
   //===========================================================
@@ -86,6 +88,8 @@ void MAMMicrophysics::set_defaults_() {
 void MAMMicrophysics::configure(const ekat::ParameterList& params) {
   set_defaults_();
   // FIXME: implement "namelist" parsing
+  config_.split_chem_at_tropopause =
+    params.get<bool>("mam4_split_chem_at_tropopause", config_.split_chem_at_tropopause);
 }
 
 void MAMMicrophysics::set_grids(const std::shared_ptr<const GridsManager> grids_manager) {
@@ -251,6 +255,11 @@ void MAMMicrophysics::initialize_impl(const RunType run_type) {
                                         config_.photolysis.rsf_file,
                                         config_.photolysis.xs_long_file);
 
+  // photolysis rates and external forcings are computed for each column
+  // FIXME: external forcings require file data, so they are zero for now
+  photo_rates_ = view_3d("photo_rates", ncol_, nlev_, mam4::mo_photo::phtcnt);
+  extfrc_      = view_3d("extfrc", ncol_, nlev_, mam4::gas_chemistry::extcnt);
+
   // FIXME: read relevant land use data from drydep surface file
 
   // set up our preprocess/postprocess functors
@@ -288,9 +297,10 @@ void MAMMicrophysics::run_impl(const double dt) {
   // NOTE: nothing depends on simulation time (yet), so we can just use zero for now
   double t = 0.0;
 
-  // here's where we store per-column photolysis rates
+  // here's where we store per-column photolysis rates and external forcings
   using View2D = haero::DeviceType::view_2d<Real>;
-  View2D photo_rates("photo_rates", nlev_, mam4::mo_photo::phtcnt);
+  const auto &photo_rates = photo_rates_;
+  const auto &extfrc      = extfrc_;
 
   // climatology data for linear stratospheric chemistry
   auto linoz_o3_clim      = buffer_.scratch[0]; // ozone (climatology) [vmr]
@@ -323,6 +333,7 @@ void MAMMicrophysics::run_impl(const double dt) {
     const int icol = team.league_rank(); // column index
 
     Real col_lat = col_latitudes(icol); // column latitude (degrees?)
+    Real rlats = col_lat * M_PI / 180.0; // convert column latitude to radians
 
     // fetch column-specific atmosphere state data
     auto atm = mam_coupling::atmosphere_for_column(dry_atm, icol);
@@ -342,6 +353,18 @@ void MAMMicrophysics::run_impl(const double dt) {
     auto o3_col_dens_i = ekat::subview(o3_col_dens, icol);
     impl::compute_o3_column_density(team, atm, progs, o3_col_dens_i);
 
+    // find the tropopause, using the same climatological tropopause pressure
+    // as physics/share/scream_trcmix.cpp: levels 0..ktrop are above it
+    int ktrop = -1;
+    if (config.split_chem_at_tropopause) {
+      const Real ptrop = 250.0e2 - 150.0e2*std::pow(std::cos(rlats), 2);
+      Kokkos::parallel_reduce(Kokkos::TeamVectorRange(team, nlev),
+                              [&](const int k, int& kmax) {
+        if (atm.pressure(k) < ptrop && k > kmax) kmax = k;
+      }, Kokkos::Max<int>(ktrop));
+      if (ktrop < 0) ktrop = -1;
+    }
+
     // set up photolysis work arrays for this column.
     mam4::mo_photo::PhotoTableWorkArrays photo_work_arrays;
     // FIXME: set views here
@@ -353,15 +376,17 @@ void MAMMicrophysics::run_impl(const double dt) {
     Real surf_albedo = 0.0; // FIXME: surface albedo
     Real esfact = 0.0; // FIXME: earth-sun distance factor
     mam4::ColumnView lwc; // FIXME: liquid water cloud content: where do we get this?
-    mam4::mo_photo::table_photo(photo_rates, atm.pressure, atm.hydrostatic_dp,
+    View2D photo_rates_icol = Kokkos::subview(photo_rates, icol, Kokkos::ALL(), Kokkos::ALL());
+    mam4::mo_photo::table_photo(photo_rates_icol, atm.pressure, atm.hydrostatic_dp,
       atm.temperature, o3_col_dens_i, zenith_angle, surf_albedo, lwc,
       atm.cloud_fraction, esfact, photo_table, photo_work_arrays);
 
     // compute external forcings at time t(n+1) [molecules/cm^3/s]
     constexpr int extcnt = mam4::gas_chemistry::extcnt;
-    view_2d extfrc; // FIXME: where to allocate? (nlev, extcnt)
+    View2D extfrc_icol = Kokkos::subview(extfrc, icol, Kokkos::ALL(), Kokkos::ALL());
     mam4::mo_setext::Forcing forcings[extcnt]; // FIXME: forcings seem to require file data
-    mam4::mo_setext::extfrc_set(forcings, extfrc);
+    mam4::mo_setext::extfrc_set(forcings, extfrc_icol);
+    team.team_barrier();
 
     // compute aerosol microphysics on each vertical level within this column
     Kokkos::parallel_for(Kokkos::TeamThreadRange(team, nlev), [&](const int k) {
@@ -370,6 +395,11 @@ void MAMMicrophysics::run_impl(const double dt) {
       constexpr int gas_pcnst = mam_coupling::gas_pcnst();
       constexpr int nqtendbb = mam_coupling::nqtendbb();
 
+      // with split chemistry, gas-phase/aqueous chemistry is only solved in
+      // the troposphere, and LINOZ only in the stratosphere
+      const bool do_trop_chem  = !config.split_chem_at_tropopause || k > ktrop;
+      const bool do_strat_chem = !config.split_chem_at_tropopause || k <= ktrop;
+
       // extract atm state variables (input)
       Real temp    = atm.temperature(k);
       Real pmid    = atm.pressure(k);
@@ -409,35 +439,37 @@ void MAMMicrophysics::run_impl(const double dt) {
       //---------------------
       // Gas Phase Chemistry
       //---------------------
-      Real photo_rates_k[mam4::mo_photo::phtcnt];
-      for (int i = 0; i < mam4::mo_photo::phtcnt; ++i) {
-        photo_rates_k[i] = photo_rates(k, i);
-      }
-      Real extfrc_k[extcnt];
-      for (int i = 0; i < extcnt; ++i) {
-        extfrc_k[i] = extfrc(k, i);
+      if (do_trop_chem) {
+        Real photo_rates_k[mam4::mo_photo::phtcnt];
+        for (int i = 0; i < mam4::mo_photo::phtcnt; ++i) {
+          photo_rates_k[i] = photo_rates_icol(k, i);
+        }
+        Real extfrc_k[extcnt];
+        for (int i = 0; i < extcnt; ++i) {
+          extfrc_k[i] = extfrc_icol(k, i);
+        }
+        constexpr int nfs = mam4::gas_chemistry::nfs; // number of "fixed species"
+        // NOTE: we compute invariants here and pass them out to use later with
+        // NOTE: setsox
+        Real invariants[nfs];
+        impl::gas_phase_chemistry(zm, zi, phis, temp, pmid, pdel, dt,
+                                  photo_rates_k, extfrc_k, vmr, invariants);
+
+        //----------------------
+        // Aerosol microphysics
+        //----------------------
+        // the logic below is taken from the aero_model_gasaerexch subroutine in
+        // eam/src/chemistry/modal_aero/aero_model.F90
+
+        // aqueous chemistry ...
+        const int loffset = 8; // offset of first tracer in work arrays
+                               // (taken from mam4xx setsox validation test)
+        const Real mbar = haero::Constants::molec_weight_dry_air;
+        constexpr int indexm = 0;  // FIXME: index of xhnm in invariants array (??)
+        Real cldnum = 0.0; // FIXME: droplet number concentration: where do we get this?
+        setsox_single_level(loffset, dt, pmid, pdel, temp, mbar, lwc(k),
+          cldfrac, cldnum, invariants[indexm], config.setsox, vmrcw, vmr);
       }
-      constexpr int nfs = mam4::gas_chemistry::nfs; // number of "fixed species"
-      // NOTE: we compute invariants here and pass them out to use later with
-      // NOTE: setsox
-      Real invariants[nfs];
-      impl::gas_phase_chemistry(zm, zi, phis, temp, pmid, pdel, dt,
-                                photo_rates_k, extfrc_k, vmr, invariants);
-
-      //----------------------
-      // Aerosol microphysics
-      //----------------------
-      // the logic below is taken from the aero_model_gasaerexch subroutine in
-      // eam/src/chemistry/modal_aero/aero_model.F90
-
-      // aqueous chemistry ...
-      const int loffset = 8; // offset of first tracer in work arrays
-                             // (taken from mam4xx setsox validation test)
-      const Real mbar = haero::Constants::molec_weight_dry_air;
-      constexpr int indexm = 0;  // FIXME: index of xhnm in invariants array (??)
-      Real cldnum = 0.0; // FIXME: droplet number concentration: where do we get this?
-      setsox_single_level(loffset, dt, pmid, pdel, temp, mbar, lwc(k),
-        cldfrac, cldnum, invariants[indexm], config.setsox, vmrcw, vmr);
 
       // calculate aerosol water content using water uptake treatment
       // * dry and wet diameters [m]
@@ -460,24 +492,25 @@ void MAMMicrophysics::run_impl(const double dt) {
       // LINOZ chemistry
       //-----------------
 
-      // the following things are diagnostics, which we're not
-      // including in the first rev
-      Real do3_linoz, do3_linoz_psc, ss_o3, o3col_du_diag, o3clim_linoz_diag,
-           zenith_angle_degrees;
-
-      // FIXME: Need to get chlorine loading data from file
-      Real chlorine_loading = 0.0;
-
-      Real rlats = col_lat * M_PI / 180.0; // convert column latitude to radians
       int o3_ndx = 0; // index of "O3" in solsym array (in EAM)
-      mam4::lin_strat_chem::lin_strat_chem_solve_kk(o3_col_dens_i(k), temp,
-        zenith_angle, pmid, dt, rlats,
-        linoz_o3_clim(icol, k), linoz_t_clim(icol, k), linoz_o3col_clim(icol, k),
-        linoz_PmL_clim(icol, k), linoz_dPmL_dO3(icol, k), linoz_dPmL_dT(icol, k),
-        linoz_dPmL_dO3col(icol, k), linoz_cariolle_psc(icol, k),
-        chlorine_loading, config.linoz.psc_T, vmr[o3_ndx],
-        do3_linoz, do3_linoz_psc, ss_o3,
-        o3col_du_diag, o3clim_linoz_diag, zenith_angle_degrees);
+      if (do_strat_chem) {
+        // the following things are diagnostics, which we're not
+        // including in the first rev
+        Real do3_linoz, do3_linoz_psc, ss_o3, o3col_du_diag, o3clim_linoz_diag,
+             zenith_angle_degrees;
+
+        // FIXME: Need to get chlorine loading data from file
+        Real chlorine_loading = 0.0;
+
+        mam4::lin_strat_chem::lin_strat_chem_solve_kk(o3_col_dens_i(k), temp,
+          zenith_angle, pmid, dt, rlats,
+          linoz_o3_clim(icol, k), linoz_t_clim(icol, k), linoz_o3col_clim(icol, k),
+          linoz_PmL_clim(icol, k), linoz_dPmL_dO3(icol, k), linoz_dPmL_dT(icol, k),
+          linoz_dPmL_dO3col(icol, k), linoz_cariolle_psc(icol, k),
+          chlorine_loading, config.linoz.psc_T, vmr[o3_ndx],
+          do3_linoz, do3_linoz_psc, ss_o3,
+          o3col_du_diag, o3clim_linoz_diag, zenith_angle_degrees);
+      }
 
       // update source terms above the ozone decay threshold
       if (k > nlev - config.linoz.o3_lbl - 1) {
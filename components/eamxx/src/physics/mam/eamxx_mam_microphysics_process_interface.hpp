@@ -34,6 +34,7 @@ class MAMMicrophysics final : public scream::AtmosphereProcess {
   using view_1d_int   = typename KT::template view_1d<int>;
   using view_1d       = typename KT::template view_1d<Real>;
   using view_2d       = typename KT::template view_2d<Real>;
+  using view_3d       = typename KT::template view_3d<Real>;
   using const_view_1d = typename KT::template view_1d<const Real>;
   using const_view_2d = typename KT::template view_2d<const Real>;
 
@@ -113,6 +114,11 @@ private_except_cuda:
     struct {
       char srf_file[MAX_FILENAME_LEN];
     } drydep;
+
+    // if true, gas-phase and aqueous chemistry are only solved below the
+    // tropopause, and LINOZ only above it (as in EAM). Otherwise, all
+    // chemistry is solved on all levels.
+    bool split_chem_at_tropopause;
   };
   Config config_;
 
@@ -207,6 +213,10 @@ private_except_cuda:
   // photolysis rate table (column-independent)
   mam4::mo_photo::PhotoTableData photo_table_;
 
+  // per-column photolysis rates (ncol, nlev, phtcnt) and external forcings
+  // (ncol, nlev, extcnt), with species contiguous for each level
+  view_3d photo_rates_, extfrc_;
+
   // column areas, latitudes, longitudes
   const_view_1d col_areas_, col_latitudes_, col_longitudes_;
 
@@ -11,7 +11,10 @@ namespace scream {
 
 MAMOptics::MAMOptics(const ekat::Comm &comm, const ekat::ParameterList &params)
     : AtmosphereProcess(comm, params), aero_config_() {
- }
+  optics_freq_ = m_params.get<int>("mam4_optics_frequency", 1);
+  EKAT_REQUIRE_MSG(optics_freq_ > 0,
+                   "Error! mam4_optics_frequency must be positive.\n");
+}
 
 AtmosphereProcessType MAMOptics::type() const {
   return AtmosphereProcessType::Physics;
@@ -115,6 +118,11 @@ void MAMOptics::set_grids(
     const char *gas_mmr_field_name = mam_coupling::gas_mmr_field_name(g);
     add_field<Updated>(gas_mmr_field_name, scalar3d_mid, kg/kg, grid_name, "tracers");
   }
+
+  // Between optics updates, the optics of the last update are held
+  if(optics_freq_ > 1) {
+    set_computed_fields_persistent();
+  }
 }
 
 size_t MAMOptics::requested_buffer_size_in_bytes() const {
@@ -355,6 +363,11 @@ void MAMOptics::initialize_impl(const RunType run_type) {
   Kokkos::deep_copy(get_idx_rrtmgp_from_rrtmg_swbands_,get_idx_rrtmgp_from_rrtmg_swbands_host);
 }
 void MAMOptics::run_impl(const double dt) {
+  // Optics are only needed on radiation steps; on the other steps the
+  // output fields keep the values computed at the last update.
+  if(not optics_do(optics_freq_, timestamp().get_num_steps())) {
+    return;
+  }
 
   constexpr Real zero=0.0;
   constexpr Real one=1.0;
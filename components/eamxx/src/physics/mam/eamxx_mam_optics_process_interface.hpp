@@ -62,6 +62,9 @@ class MAMOptics final : public scream::AtmosphereProcess {
   void run_impl(const double dt) override;
   void finalize_impl() override;
 
+  // optics are updated every mam4_optics_frequency steps
+  int get_update_frequency() const override { return optics_freq_; }
+
   private_except_cuda :
       // FIXME: duplicate code from microphysics: ask it can be moved to place
       // where other process can see it. Atmosphere processes often have a
@@ -155,6 +158,18 @@ class MAMOptics final : public scream::AtmosphereProcess {
   // number of shortwave and longwave radiation bands
   int nswbands_, nlwbands_;
 
+  // frequency (in steps) at which the optical properties are recomputed.
+  // In between, the output fields keep the values of the last update, so
+  // setting this to rad_frequency avoids computing optics that radiation
+  // would not use.
+  int optics_freq_;
+
+  bool optics_do(const int ioptics, const int nstep) const {
+    // Same logic as radiation_do: always compute at the first step, and
+    // afterwards only if the step is a multiple of ioptics
+    return ioptics > 0 && (nstep == 0 || nstep % ioptics == 0);
+  }
+
   // FIXME: move these values to mam_coupling
   mam_coupling::const_view_2d p_int_, p_del_;
 
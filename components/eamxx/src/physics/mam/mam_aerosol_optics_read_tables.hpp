@@ -150,11 +150,13 @@ inline void read_rrtmg_table(
   constexpr int refindex_im   = mam4::modal_aer_opt::refindex_im;
   constexpr int coef_number   = mam4::modal_aer_opt::coef_number;
 
-  using view_3d_host = typename KT::view_3d<Real>::HostMirror;
+  using view_4d_host = typename KT::view_ND<Real,4>::HostMirror;
 
-  // temp views:
-  view_3d_host temp_lw_3d_host("temp_absplw_host", coef_number, refindex_real,
-                               refindex_im);
+  // band-major staging view: (band, coef_number, refindex_real, refindex_im).
+  // Each band is a contiguous slab, so it is copied to device in one memcpy.
+  constexpr int max_nbands = nswbands > nlwbands ? nswbands : nlwbands;
+  view_4d_host temp_4d_host("temp_optics_table_host", max_nbands, coef_number,
+                            refindex_real, refindex_im);
 
   params.set("Filename", table_filename);
   AtmosphereInput rrtmg(params, grid, host_views_1d, layouts);
@@ -183,74 +185,39 @@ inline void read_rrtmg_table(
     Kokkos::deep_copy(aerosol_optics_device_data.refitablw[d1][d3], im_host_d3);
   }  // d3
 
-  // NOTE: we need to reorder dimensions in absplw
-  // netcfd : (lw_band, mode, refindex_im, refindex_real, coef_number)
-  // mam4xx : (mode, lw_band, coef_number, refindex_real, refindex_im )
+  // NOTE: we need to reorder dimensions in the tables
+  // netcfd : (band, mode, refindex_im, refindex_real, coef_number)
+  // mam4xx : (mode, band, coef_number, refindex_real, refindex_im )
   // e3sm : (ntot_amode,coef_number,refindex_real,refindex_im,nlwbands)
-
-  for(int d5 = 0; d5 < nlwbands; ++d5) {
-    // reshape data:
+  // All bands of a table are reshaped at once, then copied band by band.
+  auto reshape_and_copy = [&](const view_5d_host &table, const int nbands,
+                              const auto &device_views) {
     Kokkos::parallel_for(
-      "reshaping absplw",
-      Kokkos::MDRangePolicy<Kokkos::Rank<3>,Kokkos::DefaultHostExecutionSpace >({0, 0, 0},
-                                              {coef_number, refindex_real, refindex_im}),
-      [&](const int d2, const int d3, const int d4) {
-          temp_lw_3d_host(d2, d3, d4) =
-              aerosol_optics_host_data.absplw_host(d5, 0, d4, d3, d2);
+      "reshaping optics table",
+      Kokkos::MDRangePolicy<Kokkos::Rank<4>,Kokkos::DefaultHostExecutionSpace >({0, 0, 0, 0},
+                                              {nbands, coef_number, refindex_real, refindex_im}),
+      [&](const int d5, const int d2, const int d3, const int d4) {
+        temp_4d_host(d5, d2, d3, d4) = table(d5, 0, d4, d3, d2);
       });
     Kokkos::fence();
 
     // syn data to device
-    Kokkos::deep_copy(aerosol_optics_device_data.absplw[d1][d5],
-                      temp_lw_3d_host);
-  }  // d5
-  // asmpsw, abspsw, extpsw
-  // netcfd : (sw_band, mode, refindex_im, refindex_real, coef_number)
-  // mam4xx : (mode, sw_band, coef_number, refindex_real, refindex_im )
-
-  for(int d5 = 0; d5 < nswbands; ++d5) {
-    // reshape data
-    Kokkos::parallel_for(
-      "reshaping asmpsw",
-      Kokkos::MDRangePolicy<Kokkos::Rank<3>,Kokkos::DefaultHostExecutionSpace >({0, 0, 0},
-                                              {coef_number, refindex_real, refindex_im}),
-      [&](const int d2, const int d3, const int d4) {
-       temp_lw_3d_host(d2, d3, d4) =
-              aerosol_optics_host_data.asmpsw_host(d5, 0, d4, d3, d2);
-      });
-    Kokkos::fence();
-    // syn data to device
-    Kokkos::deep_copy(aerosol_optics_device_data.asmpsw[d1][d5],
-                      temp_lw_3d_host);
-    // reshape data
-    Kokkos::parallel_for(
-      "reshaping abspsw",
-      Kokkos::MDRangePolicy<Kokkos::Rank<3>,Kokkos::DefaultHostExecutionSpace >({0, 0, 0},
-                                              {coef_number, refindex_real, refindex_im}),
-      [&](const int d2, const int d3, const int d4) {
-       temp_lw_3d_host(d2, d3, d4) =
-              aerosol_optics_host_data.abspsw_host(d5, 0, d4, d3, d2);
-      });
-     Kokkos::fence();
-    // syn data to device
-    Kokkos::deep_copy(aerosol_optics_device_data.abspsw[d1][d5],
-                      temp_lw_3d_host);
-    // reshape data
-    Kokkos::parallel_for(
-      "reshaping extpsw",
-      Kokkos::MDRangePolicy<Kokkos::Rank<3>,Kokkos::DefaultHostExecutionSpace >({0, 0, 0},
-                                              {coef_number, refindex_real, refindex_im}),
-      [&](const int d2, const int d3, const int d4) {
-       temp_lw_3d_host(d2, d3, d4) =
-              aerosol_optics_host_data.extpsw_host(d5, 0, d4, d3, d2);
-      });
-
-    Kokkos::fence();
-    // syn data to device
-    Kokkos::deep_copy(aerosol_optics_device_data.extpsw[d1][d5],
-                      temp_lw_3d_host);
+    for(int d5 = 0; d5 < nbands; ++d5) {
+      Kokkos::deep_copy(device_views[d1][d5],
+                        Kokkos::subview(temp_4d_host, d5, Kokkos::ALL,
+                                        Kokkos::ALL, Kokkos::ALL));
+    }  // d5
+  };
 
-  }  // d5
+  reshape_and_copy(aerosol_optics_host_data.absplw_host, nlwbands,
+                   aerosol_optics_device_data.absplw);
+  // asmpsw, abspsw, extpsw
+  reshape_and_copy(aerosol_optics_host_data.asmpsw_host, nswbands,
+                   aerosol_optics_device_data.asmpsw);
+  reshape_and_copy(aerosol_optics_host_data.abspsw_host, nswbands,
+                   aerosol_optics_device_data.abspsw);
+  reshape_and_copy(aerosol_optics_host_data.extpsw_host, nswbands,
+                   aerosol_optics_device_data.extpsw);
 }
 
 inline void read_water_refindex(const std::string &table_filename,
@@ -6,7 +6,55 @@
 #include "share/property_checks/field_lower_bound_check.hpp"
 #include "share/property_checks/field_within_interval_check.hpp"
 
+#include <map>
+
 namespace scream {
+
+namespace {
+// Atm quantities that native models can use as inputs, or update with their outputs.
+// Names match the ones used by the python ML models (see ml_correction.py).
+enum NativeVar : int {
+  // Inputs
+  InTmid, InQv, InU, InV, InLat, InPhis, InCosZenith, InSfcAlbDifVis, InSwFluxDnToa,
+  // Outputs
+  OutDQ1, OutDQ2, OutDQu, OutDQv, OutSfcFluxSwNet, OutSfcFluxLwDn
+};
+
+const std::map<std::string,NativeVar>& native_input_vars () {
+  static const std::map<std::string,NativeVar> vars = {
+    {"T_mid",                InTmid},
+    {"qv",                   InQv},
+    {"U",                    InU},
+    {"V",                    InV},
+    {"lat",                  InLat},
+    {"surface_geopotential", InPhis},
+    {"cos_zenith_angle",     InCosZenith},
+    {"surface_diffused_shortwave_albedo", InSfcAlbDifVis},
+    {"total_sky_downward_shortwave_flux_at_top_of_atmosphere", InSwFluxDnToa}
+  };
+  return vars;
+}
+
+const std::map<std::string,NativeVar>& native_output_vars () {
+  static const std::map<std::string,NativeVar> vars = {
+    {"dQ1",     OutDQ1},
+    {"dQ2",     OutDQ2},
+    {"dQu",     OutDQu},
+    {"dQxwind", OutDQu},
+    {"dQv",     OutDQv},
+    {"dQywind", OutDQv},
+    {"net_shortwave_sfc_flux_via_transmissivity", OutSfcFluxSwNet},
+    {"override_for_time_adjusted_total_sky_downward_longwave_flux_at_surface", OutSfcFluxLwDn}
+  };
+  return vars;
+}
+
+bool is_column_var (const NativeVar v) {
+  return v==InTmid || v==InQv || v==InU || v==InV ||
+         v==OutDQ1 || v==OutDQ2 || v==OutDQu || v==OutDQv;
+}
+} // anonymous namespace
+
 // =========================================================================================
 MLCorrection::MLCorrection(const ekat::Comm &comm,
                            const ekat::ParameterList &params)
@@ -16,6 +64,10 @@ MLCorrection::MLCorrection(const ekat::Comm &comm,
   m_ML_model_path_sfc_fluxes = m_params.get<std::string>("ML_model_path_sfc_fluxes");
   m_fields_ml_output_variables = m_params.get<std::vector<std::string>>("ML_output_fields");
   m_ML_correction_unit_test = m_params.get<bool>("ML_correction_unit_test");
+  const auto backend = m_params.get<std::string>("ML_inference_backend","python");
+  EKAT_REQUIRE_MSG (backend=="python" or backend=="native",
+      "Error! Unsupported ML_inference_backend '" + backend + "'. Valid options: python, native.\n");
+  m_native_inference = backend=="native";
 }
 
 // =========================================================================================
@@ -72,18 +124,25 @@ void MLCorrection::set_grids(
 
 // =========================================================================================
 void MLCorrection::initialize_impl(const RunType /* run_type */) {
-  fpe_mask = ekat::get_enabled_fpes();
-  ekat::disable_all_fpes();  // required for importing numpy  
-  if ( Py_IsInitialized() == 0 ) {
-    pybind11::initialize_interpreter();
+  if (m_native_inference) {
+    // No need for python at all
+    m_native_tq         = load_native_model(m_ML_model_path_tq);
+    m_native_uv         = load_native_model(m_ML_model_path_uv);
+    m_native_sfc_fluxes = load_native_model(m_ML_model_path_sfc_fluxes);
+  } else {
+    fpe_mask = ekat::get_enabled_fpes();
+    ekat::disable_all_fpes();  // required for importing numpy
+    if ( Py_IsInitialized() == 0 ) {
+      pybind11::initialize_interpreter();
+    }
+    pybind11::module sys = pybind11::module::import("sys");
+    sys.attr("path").attr("insert")(1, ML_CORRECTION_CUSTOM_PATH);
+    py_correction = pybind11::module::import("ml_correction");
+    ML_model_tq = py_correction.attr("get_ML_model")(m_ML_model_path_tq);
+    ML_model_uv = py_correction.attr("get_ML_model")(m_ML_model_path_uv);
+    ML_model_sfc_fluxes = py_correction.attr("get_ML_model")(m_ML_model_path_sfc_fluxes);
+    ekat::enable_fpes(fpe_mask);
   }
-  pybind11::module sys = pybind11::module::import("sys");
-  sys.attr("path").attr("insert")(1, ML_CORRECTION_CUSTOM_PATH);
-  py_correction = pybind11::module::import("ml_correction");
-  ML_model_tq = py_correction.attr("get_ML_model")(m_ML_model_path_tq);
-  ML_model_uv = py_correction.attr("get_ML_model")(m_ML_model_path_uv);
-  ML_model_sfc_fluxes = py_correction.attr("get_ML_model")(m_ML_model_path_sfc_fluxes);
-  ekat::enable_fpes(fpe_mask);
 
   // Enforce bounds on quantities adjusted by ML using Field Property Checks
   using LowerBound = FieldLowerBoundCheck;
@@ -98,27 +157,65 @@ void MLCorrection::initialize_impl(const RunType /* run_type */) {
 
 // =========================================================================================
 void MLCorrection::run_impl(const double dt) {
+  // For precipitation adjustment we need to track the change in column integrated 'qv'
+  // So we clone the original qv before ML changes the state so we can back out a qv_tend
+  // to use with precip adjustment.
+  auto qv_src = get_field_in("qv");
+  auto qv_in = qv_src.clone();
+
+  if (m_native_inference) {
+    // use model time to infer solar zenith angle for the ML prediction
+    const Real days = days_from_2000(timestamp());
+    for (const auto& m : {m_native_tq, m_native_uv, m_native_sfc_fluxes}) {
+      if (m.model) {
+        apply_native_model(m, dt, days);
+      }
+    }
+  } else {
+    run_python(dt);
+  }
+
+  // Now back out the qv change abd apply it to precipitation, only if Tq ML is turned on
+  const bool tq_on = m_native_inference ? m_native_tq.model!=nullptr
+                                        : m_ML_model_path_tq != "None";
+  if (tq_on) {
+    adjust_precipitation(qv_in);
+  }
+}
+
+// =========================================================================================
+void MLCorrection::run_python(const double dt) {
   // use model time to infer solar zenith angle for the ML prediction
   auto current_ts = timestamp();
   std::string datetime_str = current_ts.get_date_string() + " " + current_ts.get_time_string();
 
+  // The python models work on host data
+  for (const auto& name : {"phis", "sfc_alb_dif_vis", "SW_flux_dn", "sfc_flux_sw_net",
+                           "sfc_flux_lw_dn", "T_mid", "qv", "horiz_winds"}) {
+    get_field_in(name).sync_to_host();
+  }
+
   const auto &phis            = get_field_in("phis").get_view<const Real *, Host>();
   const auto &sfc_alb_dif_vis = get_field_in("sfc_alb_dif_vis").get_view<const Real *, Host>();  
 
   const auto &qv              = get_field_out("qv").get_view<Real **, Host>();
   const auto &T_mid           = get_field_out("T_mid").get_view<Real **, Host>();
-  const auto &SW_flux_dn      = get_field_out("SW_flux_dn").get_view<Real **, Host>();
+  // The python models see the fields as (ncol,nlev) arrays, so the state fields must not be
+  // padded. SW_flux_dn (on interfaces) usually is, so pass an unpadded copy (it is only read)
+  for (const auto& name : {"T_mid", "qv", "horiz_winds"}) {
+    EKAT_REQUIRE_MSG (get_field_in(name).get_header().get_alloc_properties().get_padding()==0,
+        "Error! The python ML_inference_backend requires unpadded fields, that is, the number\n"
+        "  of levels must be a multiple of the pack size. Use ML_inference_backend=native.\n"
+        "  - field: " + std::string(name) + "\n");
+  }
+  const auto &SW_flux_dn_padded = get_field_out("SW_flux_dn").get_view<const Real **, Host>();
+  Kokkos::View<Real**,Kokkos::LayoutRight,Kokkos::HostSpace> SW_flux_dn("SW_flux_dn",m_num_cols,m_num_levs+1);
+  Kokkos::deep_copy(SW_flux_dn,Kokkos::subview(SW_flux_dn_padded,Kokkos::ALL,Kokkos::make_pair(0,m_num_levs+1)));
   const auto &sfc_flux_sw_net = get_field_out("sfc_flux_sw_net").get_view<Real *, Host>();
   const auto &sfc_flux_lw_dn  = get_field_out("sfc_flux_lw_dn").get_view<Real *, Host>();
   const auto &u               = get_field_out("horiz_winds").get_component(0).get_view<Real **, Host>();
   const auto &v               = get_field_out("horiz_winds").get_component(1).get_view<Real **, Host>();
 
-  // For precipitation adjustment we need to track the change in column integrated 'qv'
-  // So we clone the original qv before ML changes the state so we can back out a qv_tend
-  // to use with precip adjustment.
-  auto qv_src = get_field_in("qv");
-  auto qv_in = qv_src.clone();
-
   auto h_lat  = m_lat.get_view<const Real*,Host>();
   auto h_lon  = m_lon.get_view<const Real*,Host>();
 
@@ -159,8 +256,13 @@ void MLCorrection::run_impl(const double dt) {
   pybind11::gil_scoped_release no_gil;  
   ekat::enable_fpes(fpe_mask);   
 
-  // Now back out the qv change abd apply it to precipitation, only if Tq ML is turned on
-  if (m_ML_model_path_tq != "None") {
+  for (const auto& name : {"sfc_flux_sw_net", "sfc_flux_lw_dn", "T_mid", "qv", "horiz_winds"}) {
+    get_field_out(name).sync_to_dev();
+  }
+}
+
+// =========================================================================================
+void MLCorrection::adjust_precipitation(const Field& qv_in) {
     using PC  = scream::physics::Constants<Real>;
     using KT  = KokkosTypes<DefaultDevice>;
     using MT  = typename KT::MemberType;
@@ -168,6 +270,7 @@ void MLCorrection::run_impl(const double dt) {
     const auto &pseudo_density       = get_field_in("pseudo_density").get_view<const Real**>();
     const auto &precip_liq_surf_mass = get_field_out("precip_liq_surf_mass").get_view<Real *>();
     const auto &precip_ice_surf_mass = get_field_out("precip_ice_surf_mass").get_view<Real *>();
+    const auto &T_mid                = get_field_in("T_mid").get_view<const Real **>();
     constexpr Real g = PC::gravit;
     const auto num_levs = m_num_levs;
     const auto policy = ESU::get_default_team_policy(m_num_cols, m_num_levs);
@@ -224,7 +327,124 @@ void MLCorrection::run_impl(const double dt) {
       // We rely on the field property checker defined in the intialization function to repair
       // any instances of negative precipitation.
     });
+}
+
+// =========================================================================================
+MLCorrection::NativeModel
+MLCorrection::load_native_model(const std::string& path) const {
+  NativeModel m;
+  if (path=="NONE" or path=="None") {
+    return m;
   }
+  m.model = std::make_shared<NativeMLModel>(path,m_num_cols);
+  m.x = NativeMLModel::view_2d("ml_inputs", m_num_cols,m.model->num_inputs());
+  m.y = NativeMLModel::view_2d("ml_outputs",m_num_cols,m.model->num_outputs());
+
+  // For each entry of the input/output vectors, store the atm quantity and level
+  using view_1d_int = KokkosTypes<DefaultDevice>::view_1d<int>;
+  auto map_vars = [&](const std::vector<NativeMLModel::Variable>& vars,
+                      const std::map<std::string,NativeVar>& supported,
+                      const int size, const std::string& kind,
+                      view_1d_int& var, view_1d_int& lev) {
+    var = view_1d_int("var",size);
+    lev = view_1d_int("lev",size);
+    auto var_h = Kokkos::create_mirror_view(var);
+    auto lev_h = Kokkos::create_mirror_view(lev);
+    for (const auto& v : vars) {
+      EKAT_REQUIRE_MSG (supported.count(v.name)==1,
+          "Error! Unsupported " + kind + " '" + v.name + "' in ML model '" + path + "'.\n");
+      const auto code = supported.at(v.name);
+      const int nlevs = is_column_var(code) ? m_num_levs : 1;
+      EKAT_REQUIRE_MSG (v.size==nlevs,
+          "Error! Wrong size for " + kind + " '" + v.name + "' in ML model '" + path + "'.\n"
+          "  - expected: " + std::to_string(nlevs) + "\n"
+          "  - found   : " + std::to_string(v.size) + "\n");
+      // In unit test mode, only the atm state is available
+      EKAT_REQUIRE_MSG (is_column_var(code) or not m_ML_correction_unit_test,
+          "Error! ML model '" + path + "' uses '" + v.name + "', which is not available in unit test mode.\n");
+      for (int k=0; k<v.size; ++k) {
+        var_h(v.offset+k) = code;
+        lev_h(v.offset+k) = k;
+      }
+    }
+    Kokkos::deep_copy(var,var_h);
+    Kokkos::deep_copy(lev,lev_h);
+  };
+  map_vars(m.model->inputs(), native_input_vars(), m.model->num_inputs(), "input", m.in_var, m.in_lev);
+  map_vars(m.model->outputs(),native_output_vars(),m.model->num_outputs(),"output",m.out_var,m.out_lev);
+  return m;
+}
+
+// =========================================================================================
+void MLCorrection::apply_native_model(const NativeModel& m, const Real dt, const Real days) {
+  using view_1d  = KokkosTypes<DefaultDevice>::view_1d<Real>;
+  using view_2d  = KokkosTypes<DefaultDevice>::view_2d<Real>;
+  using cview_1d = KokkosTypes<DefaultDevice>::view_1d<const Real>;
+  using cview_2d = KokkosTypes<DefaultDevice>::view_2d<const Real>;
+
+  const int ncols = m_num_cols;
+  const int nin   = m.model->num_inputs();
+  const int nout  = m.model->num_outputs();
+  const auto x = m.x;
+  const auto y = m.y;
+
+  const view_2d T_mid = get_field_out("T_mid").get_view<Real**>();
+  const view_2d qv    = get_field_out("qv").get_view<Real**>();
+  const view_2d u     = get_field_out("horiz_winds").get_component(0).get_view<Real**>();
+  const view_2d v     = get_field_out("horiz_winds").get_component(1).get_view<Real**>();
+  cview_1d lat, lon, phis, sfc_alb_dif_vis;
+  cview_2d SW_flux_dn;
+  view_1d sfc_flux_sw_net, sfc_flux_lw_dn;
+  if (not m_ML_correction_unit_test) {
+    lat             = m_lat.get_view<const Real*>();
+    lon             = m_lon.get_view<const Real*>();
+    phis            = get_field_in("phis").get_view<const Real*>();
+    sfc_alb_dif_vis = get_field_in("sfc_alb_dif_vis").get_view<const Real*>();
+    SW_flux_dn      = get_field_in("SW_flux_dn").get_view<const Real**>();
+    sfc_flux_sw_net = get_field_out("sfc_flux_sw_net").get_view<Real*>();
+    sfc_flux_lw_dn  = get_field_out("sfc_flux_lw_dn").get_view<Real*>();
+  }
+
+  // Gather the inputs
+  const auto in_var = m.in_var;
+  const auto in_lev = m.in_lev;
+  const auto in_policy = Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0,0},{ncols,nin});
+  Kokkos::parallel_for("ml_correction_native_inputs", in_policy,
+                       KOKKOS_LAMBDA(const int icol, const int i) {
+    const int k = in_lev(i);
+    Real val = 0;
+    switch (in_var(i)) {
+      case InTmid:         val = T_mid(icol,k); break;
+      case InQv:           val = qv(icol,k); break;
+      case InU:            val = u(icol,k); break;
+      case InV:            val = v(icol,k); break;
+      case InLat:          val = lat(icol); break;
+      case InPhis:         val = phis(icol); break;
+      case InCosZenith:    val = cos_zenith_angle(days,lon(icol),lat(icol)); break;
+      case InSfcAlbDifVis: val = sfc_alb_dif_vis(icol); break;
+      case InSwFluxDnToa:  val = SW_flux_dn(icol,0); break;
+    }
+    x(icol,i) = val;
+  });
+
+  m.model->predict(x,y);
+
+  // Apply the outputs: tendencies for the state, and overrides for the surface fluxes
+  const auto out_var = m.out_var;
+  const auto out_lev = m.out_lev;
+  const auto out_policy = Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0,0},{ncols,nout});
+  Kokkos::parallel_for("ml_correction_native_outputs", out_policy,
+                       KOKKOS_LAMBDA(const int icol, const int i) {
+    const int k = out_lev(i);
+    switch (out_var(i)) {
+      case OutDQ1:          T_mid(icol,k) += y(icol,i)*dt; break;
+      case OutDQ2:          qv(icol,k)    += y(icol,i)*dt; break;
+      case OutDQu:          u(icol,k)     += y(icol,i)*dt; break;
+      case OutDQv:          v(icol,k)     += y(icol,i)*dt; break;
+      case OutSfcFluxSwNet: sfc_flux_sw_net(icol) = y(icol,i); break;
+      case OutSfcFluxLwDn:  sfc_flux_lw_dn(icol)  = y(icol,i); break;
+    }
+  });
 }
 
 // =========================================================================================
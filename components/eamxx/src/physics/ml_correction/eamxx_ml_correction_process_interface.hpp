@@ -16,6 +16,7 @@
 #include "share/grid/mesh_free_grids_manager.hpp"
 #include "share/grid/point_grid.hpp"
 #include "share/util/scream_time_stamp.hpp"
+#include "ml_correction_native.hpp"
 
 namespace scream {
 
@@ -42,6 +43,25 @@ class MLCorrection : public AtmosphereProcess {
   // Set the grid
   void set_grids(const std::shared_ptr<const GridsManager> grids_manager);
 
+  // A native model, together with the atm quantity (and level) that each
+  // entry of its input/output vectors corresponds to, and buffers for them
+  struct NativeModel {
+    std::shared_ptr<NativeMLModel> model;
+    KokkosTypes<DefaultDevice>::view_1d<int> in_var, in_lev;
+    KokkosTypes<DefaultDevice>::view_1d<int> out_var, out_lev;
+    NativeMLModel::view_2d x, y;
+  };
+
+#ifndef KOKKOS_ENABLE_CUDA
+  // Cuda requires methods enclosing __device__ lambda's to be public
+ protected:
+#endif
+  // Evaluate a native model on all columns, and apply its outputs to the atm state
+  void apply_native_model(const NativeModel& model, const Real dt, const Real days_from_2000);
+
+  // Adjust surface precipitation by the change in column water vapor since qv_old
+  void adjust_precipitation(const Field& qv_old);
+
  protected:
   // The three main overrides for the subcomponent
   void initialize_impl(const RunType run_type);
@@ -49,6 +69,11 @@ class MLCorrection : public AtmosphereProcess {
   void finalize_impl();
   void apply_tendency(Field& base, const Field& next, const int dt);
 
+  void run_python(const double dt);
+
+  // Load a native model (if path is not NONE), and map its inputs/outputs to atm quantities
+  NativeModel load_native_model(const std::string& path) const;
+
   std::shared_ptr<const AbstractGrid>   m_grid;
   // Keep track of field dimensions and the iteration count
   Int m_num_cols;
@@ -65,6 +90,13 @@ class MLCorrection : public AtmosphereProcess {
   pybind11::object ML_model_uv;
   pybind11::object ML_model_sfc_fluxes;
   int fpe_mask;
+
+  // If true, the models are evaluated natively (see ml_correction_native.hpp),
+  // rather than via the python update_fields function
+  bool m_native_inference;
+  NativeModel m_native_tq;
+  NativeModel m_native_uv;
+  NativeModel m_native_sfc_fluxes;
 };  // class MLCorrection
 
 }  // namespace scream
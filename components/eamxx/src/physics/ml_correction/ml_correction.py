@@ -7,16 +7,26 @@ from scream_run.steppers.machine_learning import (
     open_model,
     predict,
 )
+from native_mlp import NativeMLP, is_native_mlp_file
 
 
 def get_ML_model(model_path):
     if model_path == "NONE":
         return None
+    if is_native_mlp_file(model_path):
+        return NativeMLP(model_path)
     config = MachineLearningConfig(models=[model_path])
     model = open_model(config)
     return model
 
 
+def predict_any(model, ds, dt):
+    """Run either a native MLP model, or a model loaded via MachineLearningConfig"""
+    if isinstance(model, NativeMLP):
+        return model.predict(ds)
+    return predict(model, ds, dt)
+
+
 def ensure_correction_ordering(correction):
     """Ensure that the ordering of the correction is always (ncol, z)"""
     for key in correction:
@@ -44,7 +54,7 @@ def get_ML_correction_dQ1_dQ2(model, T_mid, qv, cos_zenith, lat, phis, dt):
             surface_geopotential=(["ncol"], phis),
         )
     )
-    return ensure_correction_ordering(predict(model, ds, dt))
+    return ensure_correction_ordering(predict_any(model, ds, dt))
 
 
 def get_ML_correction_dQu_dQv(model, T_mid, qv, cos_zenith, lat, phis, u, v, dt):
@@ -72,7 +82,7 @@ def get_ML_correction_dQu_dQv(model, T_mid, qv, cos_zenith, lat, phis, u, v, dt)
             cos_zenith_angle=(["ncol"], cos_zenith),
         )
     )
-    output = ensure_correction_ordering(predict(model, ds, dt))
+    output = ensure_correction_ordering(predict_any(model, ds, dt))
     # rename dQxwind and dQywind to dQu and dQv if needed
     if "dQxwind" in output.keys():
         output["dQu"] = output.pop("dQxwind")
@@ -124,7 +134,7 @@ def get_ML_correction_sfc_fluxes(
             ),
         )
     )
-    return predict(model, ds, dt)
+    return predict_any(model, ds, dt)
 
 
 def update_fields(
@@ -0,0 +1,232 @@
+#include "ml_correction_native.hpp"
+
+#include <ekat/ekat_assert.hpp>
+#include <ekat/kokkos/ekat_kokkos_utils.hpp>
+
+#include <fstream>
+#include <sstream>
+
+namespace scream {
+
+NativeMLModel::NativeMLModel (const std::string& filename, const int ncols)
+ : m_filename (filename)
+{
+  std::ifstream ifs(filename);
+  EKAT_REQUIRE_MSG (ifs.good(),
+      "Error! Could not open ML model file '" + filename + "'.\n");
+
+  // Tokenize the whole file, skipping comments
+  std::vector<std::string> tokens;
+  std::string line, tok;
+  while (std::getline(ifs,line)) {
+    std::istringstream iss(line.substr(0,line.find('#')));
+    while (iss >> tok) {
+      tokens.push_back(tok);
+    }
+  }
+
+  size_t pos = 0;
+  auto next = [&]() -> const std::string& {
+    EKAT_REQUIRE_MSG (pos<tokens.size(),
+        "Error! Unexpected end of ML model file '" + filename + "'.\n");
+    return tokens[pos++];
+  };
+  auto expect = [&](const std::string& keyword) {
+    const auto& t = next();
+    EKAT_REQUIRE_MSG (t==keyword,
+        "Error! Unexpected entry in ML model file '" + filename + "'.\n"
+        "  - expected: " + keyword + "\n"
+        "  - found   : " + t + "\n");
+  };
+  auto next_int = [&]() -> int {
+    const auto& t = next();
+    try {
+      return std::stoi(t);
+    } catch (...) {
+      EKAT_ERROR_MSG ("Error! Expected an integer in ML model file '" + filename + "', found '" + t + "'.\n");
+    }
+  };
+  auto next_real = [&]() -> Real {
+    const auto& t = next();
+    try {
+      return std::stod(t);
+    } catch (...) {
+      EKAT_ERROR_MSG ("Error! Expected a number in ML model file '" + filename + "', found '" + t + "'.\n");
+    }
+  };
+  auto read_vars = [&](std::vector<Variable>& vars) {
+    const int n = next_int();
+    int offset = 0;
+    for (int i=0; i<n; ++i) {
+      Variable v;
+      v.name = next();
+      v.size = next_int();
+      v.offset = offset;
+      EKAT_REQUIRE_MSG (v.size>0,
+          "Error! Invalid size for variable '" + v.name + "' in ML model file '" + filename + "'.\n");
+      offset += v.size;
+      vars.push_back(v);
+    }
+    return offset;
+  };
+  auto read_values = [&](const std::string& name, const int n) {
+    expect(name);
+    view_1d v(name,n);
+    auto v_h = Kokkos::create_mirror_view(v);
+    for (int i=0; i<n; ++i) {
+      v_h(i) = next_real();
+    }
+    Kokkos::deep_copy(v,v_h);
+    return v;
+  };
+
+  expect("eamxx_native_mlp");
+  const int version = next_int();
+  EKAT_REQUIRE_MSG (version==1,
+      "Error! Unsupported version " + std::to_string(version) + " of ML model file '" + filename + "'.\n");
+
+  expect("inputs");
+  m_nin = read_vars(m_inputs);
+  expect("outputs");
+  m_nout = read_vars(m_outputs);
+
+  m_in_mean  = read_values("input_mean",m_nin);
+  m_in_std   = read_values("input_std",m_nin);
+  m_out_mean = read_values("output_mean",m_nout);
+  m_out_std  = read_values("output_std",m_nout);
+
+  // Layers: first read the sizes/weights on host, then copy to device
+  expect("layers");
+  m_num_layers = next_int();
+  EKAT_REQUIRE_MSG (m_num_layers>0,
+      "Error! ML model file '" + filename + "' has no layers.\n");
+  m_layers = KT::view_2d<int>("layers",m_num_layers,4);
+  auto layers_h = Kokkos::create_mirror_view(m_layers);
+  std::vector<Real> params;
+  int width = m_nin;
+  m_max_width = m_nin;
+  for (int l=0; l<m_num_layers; ++l) {
+    expect("dense");
+    const int nin  = next_int();
+    const int nout = next_int();
+    const auto& act = next();
+    EKAT_REQUIRE_MSG (nin==width,
+        "Error! Layer " + std::to_string(l) + " of ML model file '" + filename + "' has the wrong input size.\n"
+        "  - expected: " + std::to_string(width) + "\n"
+        "  - found   : " + std::to_string(nin) + "\n");
+    layers_h(l,0) = nin;
+    layers_h(l,1) = nout;
+    if (act=="linear") {
+      layers_h(l,2) = Linear;
+    } else if (act=="relu") {
+      layers_h(l,2) = ReLU;
+    } else if (act=="tanh") {
+      layers_h(l,2) = Tanh;
+    } else {
+      EKAT_ERROR_MSG ("Error! Unsupported activation '" + act + "' in ML model file '" + filename + "'.\n"
+                      "  - supported: linear, relu, tanh\n");
+    }
+    layers_h(l,3) = params.size();
+    for (int i=0; i<nout*nin+nout; ++i) {
+      params.push_back(next_real());
+    }
+    width = nout;
+    m_max_width = std::max(m_max_width,nout);
+  }
+  EKAT_REQUIRE_MSG (width==m_nout,
+      "Error! The last layer of ML model file '" + filename + "' has the wrong output size.\n"
+      "  - expected: " + std::to_string(m_nout) + "\n"
+      "  - found   : " + std::to_string(width) + "\n");
+  EKAT_REQUIRE_MSG (pos==tokens.size(),
+      "Error! Unexpected trailing entries in ML model file '" + filename + "'.\n");
+  Kokkos::deep_copy(m_layers,layers_h);
+
+  m_params = view_1d("params",params.size());
+  auto params_h = Kokkos::create_mirror_view(m_params);
+  std::copy(params.begin(),params.end(),params_h.data());
+  Kokkos::deep_copy(m_params,params_h);
+
+  m_work = view_2d("work",ncols,2*m_max_width);
+}
+
+void NativeMLModel::predict (const cview_2d& x, const view_2d& y) const
+{
+  using MemberType = typename KT::MemberType;
+  using ESU        = ekat::ExeSpaceUtils<typename KT::ExeSpace>;
+
+  const int ncols = x.extent(0);
+  EKAT_REQUIRE_MSG (ncols<=static_cast<int>(m_work.extent(0)),
+      "Error! Too many columns for ML model '" + m_filename + "'.\n");
+
+  const int nin = m_nin;
+  const int nout = m_nout;
+  const int num_layers = m_num_layers;
+  const int max_width = m_max_width;
+  const auto layers = m_layers;
+  const auto params = m_params;
+  const auto in_mean  = m_in_mean;
+  const auto in_std   = m_in_std;
+  const auto out_mean = m_out_mean;
+  const auto out_std  = m_out_std;
+  const auto work = m_work;
+
+  const auto policy = ESU::get_default_team_policy(ncols,max_width);
+  Kokkos::parallel_for("ml_correction_native_predict", policy,
+                       KOKKOS_LAMBDA(const MemberType& team) {
+    const int icol = team.league_rank();
+    auto buf = ekat::subview(work,icol);
+
+    // Normalized inputs go in the first half of the work array
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nin),[&](const int i) {
+      buf(i) = (x(icol,i)-in_mean(i)) / in_std(i);
+    });
+    team.team_barrier();
+
+    // Layers alternate between the two halves of the work array
+    for (int l=0; l<num_layers; ++l) {
+      const int lnin  = layers(l,0);
+      const int lnout = layers(l,1);
+      const int act   = layers(l,2);
+      const int w_off = layers(l,3);
+      const int b_off = w_off + lnout*lnin;
+      const int in_off  = (l%2)*max_width;
+      const int out_off = max_width - in_off;
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team,lnout),[&](const int j) {
+        Real sum = 0;
+        Kokkos::parallel_reduce(Kokkos::ThreadVectorRange(team,lnin),
+                                [&](const int i, Real& lsum) {
+          lsum += params(w_off+j*lnin+i)*buf(in_off+i);
+        },sum);
+        Kokkos::single(Kokkos::PerThread(team),[&]{
+          buf(out_off+j) = activate(sum+params(b_off+j),act);
+        });
+      });
+      team.team_barrier();
+    }
+
+    const int res_off = (num_layers%2)*max_width;
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nout),[&](const int i) {
+      y(icol,i) = buf(res_off+i)*out_std(i) + out_mean(i);
+    });
+  });
+}
+
+Real days_from_2000 (const util::TimeStamp& ts)
+{
+  // Days since 1970-01-01 in the gregorian calendar (H. Hinnant's days_from_civil)
+  auto days_from_civil = [](int y, const int m, const int d) {
+    y -= m<=2;
+    const int era = (y>=0 ? y : y-399) / 400;
+    const int yoe = y - era*400;
+    const int doy = (153*(m + (m>2 ? -3 : 9)) + 2)/5 + d-1;
+    const int doe = yoe*365 + yoe/4 - yoe/100 + doy;
+    return era*146097 + doe - 719468;
+  };
+
+  const int days = days_from_civil(ts.get_year(),ts.get_month(),ts.get_day())
+                 - days_from_civil(2000,1,1);
+  const Real secs = ts.get_hours()*3600 + ts.get_minutes()*60 + ts.get_seconds();
+  return days + secs/86400 - 0.5;
+}
+
+} // namespace scream
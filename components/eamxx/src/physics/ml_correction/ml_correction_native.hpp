@@ -0,0 +1,150 @@
+#ifndef SCREAM_ML_CORRECTION_NATIVE_HPP
+#define SCREAM_ML_CORRECTION_NATIVE_HPP
+
+#include "share/scream_types.hpp"
+#include "share/util/scream_time_stamp.hpp"
+
+#include <ekat/kokkos/ekat_kokkos_types.hpp>
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace scream {
+
+/*
+ * A small fully connected network (MLP), applied independently to each column.
+ * The model is evaluated with Kokkos kernels (one team per column) directly on
+ * device views, so no host copy of the atm state (nor python) is needed.
+ *
+ * The model is read from a plain text file. Anything following a '#' on a line
+ * is ignored, and tokens can be separated by any whitespace:
+ *
+ *   eamxx_native_mlp 1
+ *   inputs <n>
+ *   <name> <size>            (n lines; e.g., "T_mid 72", or "lat 1")
+ *   outputs <n>
+ *   <name> <size>            (n lines)
+ *   input_mean  <nin values>
+ *   input_std   <nin values>
+ *   output_mean <nout values>
+ *   output_std  <nout values>
+ *   layers <n>
+ *   dense <nin> <nout> <linear|relu|tanh>
+ *   <nout*nin weights, row major> <nout biases>
+ *   ...                      (n dense layers)
+ *
+ * where nin (nout) is the sum of the sizes of the inputs (outputs). The input
+ * vector of a column is the concatenation of its inputs, in the order they are
+ * listed; the output vector is split the same way. Inputs are normalized as
+ * (x-mean)/std, and outputs are de-normalized as y*std+mean.
+ *
+ * ml_correction/native_mlp.py is a numpy implementation of the same model,
+ * which can also be used by the python MLCorrection path.
+ */
+
+class NativeMLModel
+{
+public:
+  using KT       = KokkosTypes<DefaultDevice>;
+  using view_1d  = typename KT::template view_1d<Real>;
+  using view_2d  = typename KT::template view_2d<Real>;
+  using cview_2d = typename KT::template view_2d<const Real>;
+
+  enum Activation : int {
+    Linear = 0,
+    ReLU   = 1,
+    Tanh   = 2
+  };
+
+  struct Variable {
+    std::string name;
+    int size;
+    int offset;   // Offset of this variable in the input/output vector
+  };
+
+  NativeMLModel (const std::string& filename, const int ncols);
+
+  const std::vector<Variable>& inputs  () const { return m_inputs;  }
+  const std::vector<Variable>& outputs () const { return m_outputs; }
+  int num_inputs  () const { return m_nin;  }
+  int num_outputs () const { return m_nout; }
+
+  // Evaluate the model on each row of x (ncols x num_inputs),
+  // and store the results in y (ncols x num_outputs)
+  void predict (const cview_2d& x, const view_2d& y) const;
+
+  KOKKOS_INLINE_FUNCTION
+  static Real activate (const Real x, const int act) {
+    switch (act) {
+      case ReLU: return x>0 ? x : 0;
+      case Tanh: return std::tanh(x);
+      default:   return x;
+    }
+  }
+
+protected:
+
+  std::string m_filename;
+
+  std::vector<Variable> m_inputs;
+  std::vector<Variable> m_outputs;
+  int m_nin;
+  int m_nout;
+
+  // For each layer: nin, nout, activation, and offset of its weights in m_params
+  // (the biases follow the weights)
+  int                   m_num_layers;
+  KT::view_2d<int>      m_layers;
+  view_1d               m_params;
+
+  view_1d m_in_mean, m_in_std;
+  view_1d m_out_mean, m_out_std;
+
+  // Work array, to store the activations of two consecutive layers in each column
+  int     m_max_width;
+  view_2d m_work;
+};
+
+// Cosine of the solar zenith angle, from an approximate solar position formula
+// (the same used by vcm.cos_zenith_angle in the python MLCorrection path).
+// Inputs: days since 2000-01-01 12:00 UTC, and lat/lon in degrees.
+KOKKOS_INLINE_FUNCTION
+Real cos_zenith_angle (const Real days_from_2000, const Real lon, const Real lat)
+{
+  constexpr Real pi = 3.14159265358979323846;
+  constexpr Real deg2rad = pi/180;
+
+  // Solar right ascension and declination
+  const Real jc = days_from_2000 / 36525;
+  const Real mean_anomaly = deg2rad*(357.52910 + 35999.05030*jc - 0.0001559*jc*jc - 0.00000048*jc*jc*jc);
+  const Real mean_longitude = deg2rad*(280.46645 + 36000.76983*jc + 0.0003032*jc*jc);
+  const Real d_l = deg2rad*((1.914600 - 0.004817*jc - 0.000014*jc*jc)*std::sin(mean_anomaly)
+                            + (0.019993 - 0.000101*jc)*std::sin(2*mean_anomaly)
+                            + 0.000290*std::sin(3*mean_anomaly));
+  const Real eclon = mean_longitude + d_l;
+  const Real eps = deg2rad*(23.0 + 26.0/60 + 21.406/3600
+                            - (46.836769*jc - 0.0001831*jc*jc + 0.00200340*jc*jc*jc
+                               - 0.576e-6*jc*jc*jc*jc - 4.34e-8*jc*jc*jc*jc*jc)/3600);
+  const Real x = std::cos(eclon);
+  const Real y = std::cos(eps)*std::sin(eclon);
+  const Real z = std::sin(eps)*std::sin(eclon);
+  const Real r = std::sqrt(1 - z*z);
+  const Real declination = std::atan2(z,r);
+  const Real right_ascension = 2*std::atan2(y,x+r);
+
+  // Local hour angle, from the Greenwich mean sidereal time
+  const Real gmst = std::fmod(18.697374558 + 24.06570982*days_from_2000, Real(24)) * (2*pi/24);
+  const Real hour_angle = gmst + deg2rad*lon - right_ascension;
+
+  return std::sin(deg2rad*lat)*std::sin(declination)
+       + std::cos(deg2rad*lat)*std::cos(declination)*std::cos(hour_angle);
+}
+
+// Days since 2000-01-01 12:00 UTC, counted with the gregorian calendar,
+// regardless of the model calendar (as done by python's datetime)
+Real days_from_2000 (const util::TimeStamp& ts);
+
+} // namespace scream
+
+#endif // SCREAM_ML_CORRECTION_NATIVE_HPP
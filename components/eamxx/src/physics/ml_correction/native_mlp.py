@@ -0,0 +1,104 @@
+"""
+Numpy implementation of the column MLP models evaluated natively by the
+MLCorrection process (see ml_correction_native.hpp for the file format).
+
+It serves as a reference for the native (Kokkos) implementation, and allows
+the python MLCorrection path to run the same models.
+"""
+import numpy as np
+
+MAGIC = "eamxx_native_mlp"
+
+ACTIVATIONS = {
+    "linear": lambda x: x,
+    "relu": lambda x: np.maximum(x, 0.0),
+    "tanh": np.tanh,
+}
+
+# Outputs that are defined on model levels (all others are 2d)
+COLUMN_VARIABLES = ["T_mid", "qv", "U", "V", "dQ1", "dQ2", "dQu", "dQv", "dQxwind", "dQywind"]
+
+
+def is_native_mlp_file(path):
+    try:
+        with open(path) as f:
+            for line in f:
+                tokens = line.split("#", 1)[0].split()
+                if tokens:
+                    return tokens[0] == MAGIC
+    except (OSError, UnicodeDecodeError):
+        pass
+    return False
+
+
+class NativeMLP:
+    def __init__(self, path):
+        tokens = []
+        with open(path) as f:
+            for line in f:
+                tokens.extend(line.split("#", 1)[0].split())
+        it = iter(tokens)
+
+        def expect(keyword):
+            tok = next(it)
+            if tok != keyword:
+                raise ValueError(f"{path}: expected '{keyword}', found '{tok}'")
+
+        def read_vars():
+            n = int(next(it))
+            return [(next(it), int(next(it))) for _ in range(n)]
+
+        def read_values(keyword, n):
+            expect(keyword)
+            return np.array([float(next(it)) for _ in range(n)])
+
+        expect(MAGIC)
+        version = int(next(it))
+        if version != 1:
+            raise ValueError(f"{path}: unsupported version {version}")
+        expect("inputs")
+        self.inputs = read_vars()
+        expect("outputs")
+        self.outputs = read_vars()
+        nin = sum(size for _, size in self.inputs)
+        nout = sum(size for _, size in self.outputs)
+        self.input_mean = read_values("input_mean", nin)
+        self.input_std = read_values("input_std", nin)
+        self.output_mean = read_values("output_mean", nout)
+        self.output_std = read_values("output_std", nout)
+        expect("layers")
+        self.layers = []
+        for _ in range(int(next(it))):
+            expect("dense")
+            lnin, lnout, act = int(next(it)), int(next(it)), next(it)
+            w = np.array([float(next(it)) for _ in range(lnout * lnin)])
+            b = np.array([float(next(it)) for _ in range(lnout)])
+            self.layers.append((w.reshape(lnout, lnin), b, ACTIVATIONS[act]))
+
+    def predict_array(self, x):
+        """x has shape (ncol, nin); returns an array of shape (ncol, nout)"""
+        a = (np.asarray(x, dtype=np.float64) - self.input_mean) / self.input_std
+        for w, b, act in self.layers:
+            a = act(a @ w.T + b)
+        return a * self.output_std + self.output_mean
+
+    def predict(self, ds):
+        """Same as predict_array, but inputs/outputs are named, as in the ML models of the python path"""
+        import xarray as xr
+
+        ncol = ds.sizes["ncol"]
+        x = np.concatenate(
+            [np.asarray(ds[name].values).reshape(ncol, size) for name, size in self.inputs],
+            axis=1,
+        )
+        y = self.predict_array(x)
+        output = {}
+        offset = 0
+        for name, size in self.outputs:
+            values = y[:, offset : offset + size]
+            offset += size
+            if name in COLUMN_VARIABLES:
+                output[name] = xr.DataArray(values, dims=["ncol", "z"])
+            else:
+                output[name] = xr.DataArray(values[:, 0], dims=["ncol"])
+        return output
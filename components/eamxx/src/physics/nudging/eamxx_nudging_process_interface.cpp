@@ -23,6 +23,7 @@ Nudging::Nudging (const ekat::Comm& comm, const ekat::ParameterList& params)
   m_fields_nudge = m_params.get<std::vector<std::string>>("nudging_fields");
   m_use_weights   = m_params.get<bool>("use_nudging_weights",false);
   m_skip_vert_interpolation   = m_params.get<bool>("skip_vert_interpolation",false);
+  m_use_fused_kernel = m_params.get<bool>("use_fused_nudging_kernel",false);
   // If we are doing horizontal refine-remapping, we need to get the mapfile from user
   m_refine_remap_file = m_params.get<std::string>(
       "nudging_refine_remap_mapfile", "no-file-given");
@@ -199,6 +200,110 @@ void Nudging::apply_tendency(Field& state, const Field& nudge, const Real dt) co
   };
   Kokkos::parallel_for(policy,update);
 }
+// =========================================================================================
+void Nudging::apply_fused_nudging (const Real dt)
+{
+  using KT         = KokkosTypes<DefaultDevice>;
+  using MemberType = typename KT::MemberType;
+  using ESU        = ekat::ExeSpaceUtils<typename KT::ExeSpace>;
+  using view_2d    = decltype(get_helper_field("p_mid_tmp").get_view<Real**>());
+  using cview_2d   = decltype(get_helper_field("p_mid_tmp").get_view<const Real**>());
+  using cview_1d   = decltype(get_helper_field("p_mid_tmp").get_view<const Real*>());
+
+  // We can only nudge T_mid, qv, U, and V (see set_grids)
+  constexpr int max_fields = 4;
+  const int nfields = m_fields_nudge.size();
+  EKAT_REQUIRE_MSG (nfields<=max_fields,
+      "Error! The fused nudging kernel supports at most " << max_fields << " fields.\n"
+      "  - nudged fields: " << ekat::join(m_fields_nudge,",") << "\n");
+
+  Kokkos::Array<view_2d,max_fields>  state_views;
+  Kokkos::Array<cview_2d,max_fields> nudge_views;
+  for (int i=0; i<nfields; ++i) {
+    const auto& name = m_fields_nudge[i];
+    state_views[i] = get_field_out_wrap(name).get_view<Real**>();
+    nudge_views[i] = get_helper_field(name+"_tmp").get_view<const Real**>();
+  }
+
+  const bool src_pmid_3d = m_src_pres_type==TIME_DEPENDENT_3D_PROFILE;
+  cview_2d p_src_3d;
+  cview_1d p_src_1d;
+  if (src_pmid_3d) {
+    p_src_3d = get_helper_field("p_mid_tmp").get_view<const Real**>();
+  } else {
+    p_src_1d = get_helper_field("p_mid_tmp").get_view<const Real*>();
+  }
+  const auto p_tgt = get_field_in("p_mid").get_view<const Real**>();
+
+  cview_2d w_view;
+  if (m_use_weights) {
+    w_view = get_helper_field("nudging_weights").get_view<const Real**>();
+  }
+
+  // If timescale==0, we replace the atm state (ignoring weights and cutoff)
+  const bool replace = m_timescale<=0;
+  const Real dtend = replace ? 1 : dt / m_timescale;
+  const bool use_weights = m_use_weights;
+  const Real cutoff = m_refine_remap_vert_cutoff;
+  const int nlevs_src = m_num_src_levs;
+  const int nlevs_tgt = m_num_levs;
+
+  const auto policy = ESU::get_default_team_policy(m_num_cols, nlevs_tgt);
+  Kokkos::parallel_for("nudging_fused_kernel", policy,
+                       KOKKOS_LAMBDA(const MemberType& team) {
+    const int icol = team.league_rank();
+    auto p_src = [&](const int k) {
+      return src_pmid_3d ? p_src_3d(icol,k) : p_src_1d(k);
+    };
+
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nlevs_tgt),[&](const int k) {
+      const Real p = p_tgt(icol,k);
+      if (not replace and cutoff>0 and p>=cutoff) {
+        return;
+      }
+
+      // Find lo,hi such that p_src(lo)<=p<p_src(hi), and the weight of hi.
+      // Same extrapolation as the unfused version (which pads the data):
+      // above the top source level, interpolate between (0,0) and the top
+      // value; below the bottom source level, use the bottom value.
+      int lo, hi;
+      Real w;
+      if (p<p_src(0)) {
+        lo = -1;
+        hi = 0;
+        w = p / p_src(0);
+      } else if (p>=p_src(nlevs_src-1)) {
+        lo = hi = nlevs_src-1;
+        w = 0;
+      } else {
+        lo = 0;
+        hi = nlevs_src-1;
+        while (hi-lo>1) {
+          const int mid = (lo+hi)/2;
+          if (p_src(mid)<=p) {
+            lo = mid;
+          } else {
+            hi = mid;
+          }
+        }
+        w = (p-p_src(lo)) / (p_src(hi)-p_src(lo));
+      }
+      const Real coeff = use_weights ? dtend*w_view(icol,k) : dtend;
+
+      for (int ifield=0; ifield<nfields; ++ifield) {
+        const auto& y = nudge_views[ifield];
+        const Real y_lo = lo>=0 ? y(icol,lo) : 0;
+        const Real y_tgt = y_lo + w*(y(icol,hi)-y_lo);
+        auto& x = state_views[ifield](icol,k);
+        if (replace) {
+          x = y_tgt;
+        } else {
+          x += coeff*(y_tgt-x);
+        }
+      }
+    });
+  });
+}
 // =============================================================================================================
 void Nudging::initialize_impl (const RunType /* run_type */)
 {
@@ -263,8 +368,11 @@ void Nudging::initialize_impl (const RunType /* run_type */)
     if (m_timescale>0) {
       // Third copy of the field: after vert interpolation.
       // We cannot store directly in get_field_out(name),
-      // since we need to back out tendencies
-      create_helper_field(name, layout_atm, m_grid->name());
+      // since we need to back out tendencies. The fused kernel
+      // nudges the atm state directly, so it does not need it.
+      if (not m_use_fused_kernel) {
+        create_helper_field(name, layout_atm, m_grid->name());
+      }
     } else {
       // We do not need to back out any tendency; the input data is used
       // to directly replace the atm state
@@ -274,8 +382,11 @@ void Nudging::initialize_impl (const RunType /* run_type */)
 
   // A helper field, where we copy each field after horiz remap, padding it
   // at top/bot, to allow vert lin interp to extrapolate outside the bounds of p_mid
+  // NOTE: the fused kernel handles extrapolation by itself, so it needs no padding
   FieldLayout layout_padded ({COL,LEV},{m_num_cols,m_num_src_levs+2});
-  create_helper_field("padded_field",layout_padded,"");
+  if (not m_use_fused_kernel) {
+    create_helper_field("padded_field",layout_padded,"");
+  }
 
   if (m_src_pres_type == TIME_DEPENDENT_3D_PROFILE && !m_skip_vert_interpolation) {
     // If the pressure profile is 3d and time-dep, we need to interpolate (in time/horiz)
@@ -289,7 +400,9 @@ void Nudging::initialize_impl (const RunType /* run_type */)
       m_helper_fields["p_mid_tmp"] = pmid_tmp;
     }
     m_horiz_remapper->register_field(pmid_ext,pmid_tmp);
-    create_helper_field("padded_p_mid_tmp",layout_padded,"");
+    if (not m_use_fused_kernel) {
+      create_helper_field("padded_p_mid_tmp",layout_padded,"");
+    }
   } else if (m_src_pres_type == STATIC_1D_VERTICAL_PROFILE) {
     // For static 1D profile, we can read p_mid now
     auto pmid_ext = create_helper_field("p_mid_ext", grid_ext->get_vertical_layout(true), grid_ext->name());
@@ -300,8 +413,10 @@ void Nudging::initialize_impl (const RunType /* run_type */)
     m_helper_fields["p_mid_tmp"] = pmid_ext.alias("p_mid_tmp");
 
     // The padded p_mid is also 1d
-    FieldLayout pmid1d_padded_layout({COL},{m_num_src_levs+2});
-    create_helper_field("padded_p_mid_tmp",pmid1d_padded_layout,"");
+    if (not m_use_fused_kernel) {
+      FieldLayout pmid1d_padded_layout({COL},{m_num_src_levs+2});
+      create_helper_field("padded_p_mid_tmp",pmid1d_padded_layout,"");
+    }
   }
 
   // Close the registration
@@ -408,6 +523,11 @@ void Nudging::run_impl (const double dt)
     return;
   }
 
+  if (m_use_fused_kernel) {
+    apply_fused_nudging(dt);
+    return;
+  }
+
   // Copy remapper tgt fields into padded views, to allow extrapolation at top/bot,
   // then call remapping routines
 
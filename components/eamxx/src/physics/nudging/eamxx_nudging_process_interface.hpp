@@ -49,6 +49,11 @@ protected:
   // NOTE: this method will handle weighted and cutoff cases as well
   void apply_tendency (Field &state, const Field &nudge, const Real dt) const;
 
+  // Vertically interpolate all nudged fields to the model p_mid and apply the
+  // nudging to the atm state, in a single kernel. The search of each target
+  // pressure in the source column is done once, and shared by all fields.
+  void apply_fused_nudging (const Real dt);
+
 protected:
 
   Field get_field_out_wrap(const std::string& field_name);
@@ -74,6 +79,8 @@ protected:
   int m_timescale;
   bool m_use_weights;
   bool m_skip_vert_interpolation;
+  // If true, vert interp and tendency application are done in one kernel
+  bool m_use_fused_kernel;
   std::vector<std::string> m_datafiles;
   std::string              m_static_vertical_pressure_file;
   // add nudging weights for regional nudging update
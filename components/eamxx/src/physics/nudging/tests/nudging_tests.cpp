@@ -6,6 +6,8 @@
 
 #include "share/field/field_utils.hpp"
 
+#include <map>
+
 using namespace scream;
 
 std::shared_ptr<Nudging>
@@ -156,39 +158,38 @@ TEST_CASE("nudging_tests") {
     }
   }
 
+  // Helper lambda, to compute f on the "fine" vert grid from f on the data vert grid
+  // If in_bounds=false, top/bot entries are extrapolated:
+  //  top: f_out(0) = f_in(1) / 2
+  //  bot: f_out(bot) = f_in(bot-1)
+
+  auto manual_vinterp = [&](const Field& data, const Field& fine, const bool in_bounds) {
+    auto fine_h = fine.get_view<Real**,Host>();
+    auto data_h = data.get_view<Real**,Host>();
+    const bool is_pmid = data.name()=="p_mid";
+    const int top = 0;
+    const int bot = nlevs_fine-1;
+    for (int icol=0; icol<ncols_data; ++icol) {
+      // Even entries match original data
+      for (int ilev=0; ilev<nlevs_data; ++ilev) {
+        fine_h(icol,2*ilev) = data_h(icol,ilev);
+      }
+      // Odd entries are avg of the two adjacent even entries
+      for (int ilev=0; ilev<nlevs_data-1; ++ilev) {
+        fine_h(icol,2*ilev+1) = (fine_h(icol,2*ilev)+fine_h(icol,2*ilev+2))/2;
+      }
+      if (not in_bounds) {
+        fine_h(icol,top) *= 0.5;
+        fine_h(icol,bot) *= is_pmid ? 2 : 1;
+      }
+    }
+    fine.sync_to_dev();
+  };
+
   // Now test the case where we do have vertical interp.
   SECTION ("no-horiz-yes-vert") {
     const auto Pa = ekat::units::Pa;
 
-    // Helper lambda, to compute f on the "fine" vert grid from f on the data vert grid
-    // If in_bounds=false, top/bot entries are extrapolated:
-    //  top: f_out(0) = f_in(1) / 2
-    //  bot: f_out(bot) = f_in(bot-1)
-
-    auto manual_interp = [&](const Field& data, const Field& fine, const bool in_bounds) {
-      auto fine_h = fine.get_view<Real**,Host>();
-      auto data_h = data.get_view<Real**,Host>();
-      const bool is_pmid = data.name()=="p_mid";
-      const int nlevs_fine = 2*nlevs_data-1;
-      const int top = 0;
-      const int bot = nlevs_fine-1;
-      for (int icol=0; icol<ncols_data; ++icol) {
-        // Even entries match original data
-        for (int ilev=0; ilev<nlevs_data; ++ilev) {
-          fine_h(icol,2*ilev) = data_h(icol,ilev);
-        }
-        // Odd entries are avg of the two adjacent even entries
-        for (int ilev=0; ilev<nlevs_data-1; ++ilev) {
-          fine_h(icol,2*ilev+1) = (fine_h(icol,2*ilev)+fine_h(icol,2*ilev+2))/2;
-        }
-        if (not in_bounds) {
-          fine_h(icol,top) *= 0.5;
-          fine_h(icol,bot) *= is_pmid ? 2 : 1;
-        }
-      }
-      fine.sync_to_dev();
-    };
-
     ekat::ParameterList params;
     params.set<strvec_t>("nudging_filenames_patterns",{nudging_data});
     params.set<std::string>("source_pressure_type","TIME_DEPENDENT_3D_PROFILE");
@@ -207,32 +208,35 @@ TEST_CASE("nudging_tests") {
       auto U = fm->get_field("U");
       auto p_mid = fm->get_field("p_mid");
 
-      // Create and init nudging process
-      auto nudging = create_nudging(comm,params,fm,gm_fine_v,get_t0());
-
       // Compute pmid on data grid
       auto layout_data = grid_data->get_3d_scalar_layout(true);
       Field p_mid_data(FieldIdentifier("p_mid",layout_data,Pa,grid_data->name()));
       p_mid_data.allocate_view();
       compute_field(p_mid_data,get_t0(),comm,0);
 
-      manual_interp(p_mid_data,p_mid,true);
+      manual_vinterp(p_mid_data,p_mid,true);
 
-      auto time = get_t0();
       Field tmp_data = p_mid_data.clone("tmp data");
       Field tmp_fine = p_mid.clone("tmp fine");
-      for (int n=0; ok and n<nsteps_data; ++n) {
-        // Run nudging
-        nudging->run(dt_data);
-
-        // Compute data on fine grid, by manually interpolating
-        // (recall that nudging runs at t+dt)
-        compute_field(tmp_data,time+dt_data,comm,0);
-        manual_interp(tmp_data,tmp_fine,true);
-
-        CHECK (views_are_equal(tmp_fine,U));
-        ok &= catch_capture.lastAssertionPassed();
-        time += dt_data;
+      for (const bool fused : {false,true}) {
+        // Create and init nudging process
+        params.set<bool>("use_fused_nudging_kernel",fused);
+        auto nudging = create_nudging(comm,params,fm,gm_fine_v,get_t0());
+
+        auto time = get_t0();
+        for (int n=0; ok and n<nsteps_data; ++n) {
+          // Run nudging
+          nudging->run(dt_data);
+
+          // Compute data on fine grid, by manually interpolating
+          // (recall that nudging runs at t+dt)
+          compute_field(tmp_data,time+dt_data,comm,0);
+          manual_vinterp(tmp_data,tmp_fine,true);
+
+          CHECK (views_are_equal(tmp_fine,U));
+          ok &= catch_capture.lastAssertionPassed();
+          time += dt_data;
+        }
       }
       root_print (msg + (ok ? " PASS\n" : " FAIL\n"));
     }
@@ -247,32 +251,35 @@ TEST_CASE("nudging_tests") {
       auto U = fm->get_field("U");
       auto p_mid = fm->get_field("p_mid");
 
-      // Create and init nudging process
-      auto nudging = create_nudging(comm,params,fm,gm_fine_v,get_t0());
-
       // Compute pmid on data grid
       auto layout_data = grid_data->get_3d_scalar_layout(true);
       Field p_mid_data(FieldIdentifier("p_mid",layout_data,Pa,grid_data->name()));
       p_mid_data.allocate_view();
       compute_field(p_mid_data,get_t0(),comm,0);
 
-      manual_interp(p_mid_data,p_mid,false);
+      manual_vinterp(p_mid_data,p_mid,false);
 
-      auto time = get_t0();
       Field tmp_data = p_mid_data.clone("tmp data");
       Field tmp_fine = p_mid.clone("tmp fine");
-      for (int n=0; ok and n<nsteps_data; ++n) {
-        // Run nudging
-        nudging->run(dt_data);
-
-        // Compute data on fine grid, by manually interpolating
-        // (recall that nudging runs at t+dt)
-        compute_field(tmp_data,time+dt_data,comm,0);
-        manual_interp(tmp_data,tmp_fine,false);
-
-        CHECK (views_are_equal(tmp_fine,U));
-        ok &= catch_capture.lastAssertionPassed();
-        time += dt_data;
+      for (const bool fused : {false,true}) {
+        // Create and init nudging process
+        params.set<bool>("use_fused_nudging_kernel",fused);
+        auto nudging = create_nudging(comm,params,fm,gm_fine_v,get_t0());
+
+        auto time = get_t0();
+        for (int n=0; ok and n<nsteps_data; ++n) {
+          // Run nudging
+          nudging->run(dt_data);
+
+          // Compute data on fine grid, by manually interpolating
+          // (recall that nudging runs at t+dt)
+          compute_field(tmp_data,time+dt_data,comm,0);
+          manual_vinterp(tmp_data,tmp_fine,false);
+
+          CHECK (views_are_equal(tmp_fine,U));
+          ok &= catch_capture.lastAssertionPassed();
+          time += dt_data;
+        }
       }
       root_print (msg + (ok ? " PASS\n" : " FAIL\n"));
     }
@@ -462,6 +469,159 @@ TEST_CASE("nudging_tests") {
     root_print (msg + (ok ? " PASS\n" : " FAIL\n"));
   }
 
+  SECTION ("fused-kernel") {
+    std::string msg = " -> Testing fused vs unfused vert interp and nudging";
+    root_print (msg + "\n");
+
+    const auto Pa = ekat::units::Pa;
+
+    // Nudging weights on the fine vert grid, in [0,1] (including 0 and 1)
+    auto weights_file = "nudging_weights_fused.nc";
+    {
+      std::vector<Real> weights(ngcols_data*nlevs_fine);
+      for (int icol=0; icol<ngcols_data; ++icol) {
+        for (int ilev=0; ilev<nlevs_fine; ++ilev) {
+          weights[icol*nlevs_fine+ilev] = ((icol+ilev)%4) / 3.0;
+        }
+      }
+      scorpio::register_file(weights_file, scorpio::FileMode::Write);
+      scorpio::define_dim(weights_file,"ncol",ngcols_data);
+      scorpio::define_dim(weights_file,"lev",nlevs_fine);
+      scorpio::define_dim(weights_file,"time",1);
+      scorpio::define_var(weights_file,"nudging_weights",{"time","ncol","lev"},"real");
+      scorpio::enddef(weights_file);
+      scorpio::write_var(weights_file,"nudging_weights",weights.data());
+      scorpio::release_file(weights_file);
+    }
+
+    // A static 1d source pressure profile, for STATIC_1D_VERTICAL_PROFILE
+    auto p_levs_file = "nudging_p_levs.nc";
+    {
+      std::vector<Real> p_levs(nlevs_data);
+      for (int ilev=0; ilev<nlevs_data; ++ilev) {
+        p_levs[ilev] = ilev + 1;
+      }
+      scorpio::register_file(p_levs_file, scorpio::FileMode::Write);
+      scorpio::define_dim(p_levs_file,"lev",nlevs_data);
+      scorpio::define_var(p_levs_file,"p_levs",{"lev"},"real");
+      scorpio::enddef(p_levs_file);
+      scorpio::write_var(p_levs_file,"p_levs",p_levs.data());
+      scorpio::release_file(p_levs_file);
+    }
+
+    // Run nudging with and without the fused kernel, starting from the same state,
+    // and check that the nudged fields agree (up to rounding) after each step.
+    // The target p_mid is outside the source p_mid bounds at the top (and, for
+    // 3d source pressure, at the bottom), to exercise the extrapolation as well
+    auto run_case = [&](const std::string& name, ekat::ParameterList params) {
+      std::string case_msg = "   -> " + name;
+      case_msg += std::string(std::max(0,int(57-case_msg.size())),'.');
+      root_print (case_msg + "\n");
+      bool ok = true;
+
+      params.set<strvec_t>("nudging_filenames_patterns",{nudging_data});
+      params.get<std::string>("log_level","warn");
+      const auto fields = params.get<strvec_t>("nudging_fields");
+      const bool static_1d = params.get<std::string>("source_pressure_type")=="STATIC_1D_VERTICAL_PROFILE";
+
+      std::map<bool,std::shared_ptr<FieldManager>> fms;
+      for (const bool fused : {false,true}) {
+        auto fm = create_fm(grid_fine_v);
+        auto p_mid = fm->get_field("p_mid");
+        if (static_1d) {
+          auto p_mid_h = p_mid.get_view<Real**,Host>();
+          for (int icol=0; icol<ncols_data; ++icol) {
+            for (int ilev=0; ilev<nlevs_fine; ++ilev) {
+              p_mid_h(icol,ilev) = 0.5*(ilev+1);
+            }
+          }
+          p_mid.sync_to_dev();
+        } else {
+          auto layout_data = grid_data->get_3d_scalar_layout(true);
+          Field p_mid_data(FieldIdentifier("p_mid",layout_data,Pa,grid_data->name()));
+          p_mid_data.allocate_view();
+          compute_field(p_mid_data,get_t0(),comm,0);
+          manual_vinterp(p_mid_data,p_mid,false);
+        }
+        fm->get_field("U").deep_copy(Real(1));
+        fm->get_field("V").deep_copy(Real(-1));
+        fms[fused] = fm;
+      }
+
+      std::map<bool,std::shared_ptr<Nudging>> nudgings;
+      for (const bool fused : {false,true}) {
+        params.set<bool>("use_fused_nudging_kernel",fused);
+        nudgings[fused] = create_nudging(comm,params,fms[fused],gm_fine_v,get_t0());
+      }
+
+      const Real tol = std::is_same<Real,float>::value ? 1e-5 : 1e-12;
+      for (int n=0; ok and n<nsteps_data; ++n) {
+        for (const bool fused : {false,true}) {
+          nudgings[fused]->run(dt_data);
+        }
+
+        for (const auto& fname : fields) {
+          auto f_unfused = fms[false]->get_field(fname);
+          auto f_fused   = fms[true]->get_field(fname);
+          f_unfused.sync_to_host();
+          f_fused.sync_to_host();
+          auto unfused_h = f_unfused.get_view<const Real**,Host>();
+          auto fused_h   = f_fused.get_view<const Real**,Host>();
+          Real max_diff = 0;
+          for (int icol=0; icol<ncols_data; ++icol) {
+            for (int ilev=0; ilev<nlevs_fine; ++ilev) {
+              const Real scale = std::max(Real(1),std::abs(unfused_h(icol,ilev)));
+              max_diff = std::max(max_diff,std::abs(fused_h(icol,ilev)-unfused_h(icol,ilev))/scale);
+            }
+          }
+          CHECK (max_diff<=tol);
+          ok &= catch_capture.lastAssertionPassed();
+        }
+      }
+      root_print (case_msg + (ok ? " PASS\n" : " FAIL\n"));
+    };
+
+    ekat::ParameterList params;
+    params.set<std::string>("source_pressure_type","TIME_DEPENDENT_3D_PROFILE");
+    params.set<strvec_t>("nudging_fields",{"U"});
+
+    // Relaxation toward the data (rather than replacement)
+    params.set<int>("nudging_timescale",2*dt_data+dt_data/2);
+    run_case("Relaxation",params);
+
+    // Relaxation, with nudging weights
+    {
+      auto params_w = params;
+      params_w.set<bool>("use_nudging_weights",true);
+      params_w.set<std::string>("nudging_weights_file",weights_file);
+      run_case("Relaxation with weights",params_w);
+    }
+
+    // Relaxation, only above a pressure cutoff (in the middle of the columns' ranges)
+    {
+      auto params_c = params;
+      params_c.set<Real>("nudging_refine_remap_vert_cutoff",Real(nlevs_data*ngcols_data/2 + nlevs_data/2));
+      run_case("Relaxation with vertical cutoff",params_c);
+    }
+
+    // Relaxation, with a static 1d source pressure
+    {
+      auto params_1d = params;
+      params_1d.set<std::string>("source_pressure_type","STATIC_1D_VERTICAL_PROFILE");
+      params_1d.set<std::string>("source_pressure_file",p_levs_file);
+      run_case("Relaxation with static 1d source pressure",params_1d);
+    }
+
+    // Multiple fields, both with replacement and relaxation
+    {
+      auto params_m = params;
+      params_m.set<strvec_t>("nudging_fields",{"U","V"});
+      run_case("Relaxation of multiple fields",params_m);
+      params_m.set<int>("nudging_timescale",0);
+      run_case("Replacement of multiple fields",params_m);
+    }
+  }
+
   // Clean up scorpio
   scorpio::finalize_subsystem();
 }
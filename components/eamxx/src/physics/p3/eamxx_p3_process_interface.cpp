@@ -18,7 +18,32 @@ namespace scream
 P3Microphysics::P3Microphysics (const ekat::Comm& comm, const ekat::ParameterList& params)
   : AtmosphereProcess(comm, params)
 {
-  // Nothing to do here
+  // If CldFraction is fused into P3, its parameters are the ones of CldFraction (if
+  // present in the parameter list, see set_fused_process_params), not P3's own.
+  m_fuse_cld_fraction = m_params.get<bool>("fuse_cld_fraction",false);
+  for (const auto& name : {"ice_cloud_threshold", "ice_cloud_for_analysis_threshold"}) {
+    EKAT_REQUIRE_MSG (not m_params.isParameter(name),
+        "Error! P3 does not use parameter '" << name << "'.\n"
+        "       If fuse_cld_fraction=true, set it in the CldFraction parameters instead.\n");
+  }
+}
+
+// =========================================================================================
+std::vector<std::string> P3Microphysics::get_fused_processes () const
+{
+  if (m_fuse_cld_fraction) {
+    return {"CldFraction"};
+  }
+  return {};
+}
+
+// =========================================================================================
+void P3Microphysics::
+set_fused_process_params (const std::string& type, const ekat::ParameterList& params)
+{
+  EKAT_REQUIRE_MSG (type=="CldFraction",
+      "Error! P3 cannot do the work of atm proc '" + type + "'.\n");
+  m_cld_fraction_params = params;
 }
 
 // =========================================================================================
@@ -64,7 +89,17 @@ void P3Microphysics::set_grids(const std::shared_ptr<const GridsManager> grids_m
   constexpr int ps = Pack::n;
 
   // These variables are needed by the interface, but not actually passed to p3_main.
-  add_field<Required>("cldfrac_tot", scalar3d_layout_mid, nondim, grid_name, ps);
+  // If CldFraction is fused into P3, cldfrac_tot is computed here from cldfrac_liq and
+  // qi, together with the other CldFraction outputs.
+  if (m_fuse_cld_fraction) {
+    add_field<Required>("cldfrac_liq",              scalar3d_layout_mid, nondim, grid_name, ps);
+    add_field<Computed>("cldfrac_tot",              scalar3d_layout_mid, nondim, grid_name, ps);
+    add_field<Computed>("cldfrac_ice",              scalar3d_layout_mid, nondim, grid_name, ps);
+    add_field<Computed>("cldfrac_tot_for_analysis", scalar3d_layout_mid, nondim, grid_name, ps);
+    add_field<Computed>("cldfrac_ice_for_analysis", scalar3d_layout_mid, nondim, grid_name, ps);
+  } else {
+    add_field<Required>("cldfrac_tot", scalar3d_layout_mid, nondim, grid_name, ps);
+  }
 
 //should we use one pressure only, wet/full?
   add_field<Required>("p_mid",       scalar3d_layout_mid, Pa,     grid_name, ps);
@@ -231,10 +266,18 @@ void P3Microphysics::initialize_impl (const RunType /* run_type */)
   add_postcondition_check<FieldWithinIntervalCheck>(get_field_out("eff_radius_qc"),m_grid,0.0,1.0e2,false);
   add_postcondition_check<FieldWithinIntervalCheck>(get_field_out("eff_radius_qi"),m_grid,0.0,5.0e3,false);
   add_postcondition_check<FieldWithinIntervalCheck>(get_field_out("eff_radius_qr"),m_grid,0.0,5.0e3,false);
+  if (m_fuse_cld_fraction) {
+    add_postcondition_check<FieldWithinIntervalCheck>(get_field_out("cldfrac_ice"),m_grid,0.0,1.0,false);
+    add_postcondition_check<FieldWithinIntervalCheck>(get_field_out("cldfrac_tot"),m_grid,0.0,1.0,false);
+    add_postcondition_check<FieldWithinIntervalCheck>(get_field_out("cldfrac_ice_for_analysis"),m_grid,0.0,1.0,false);
+    add_postcondition_check<FieldWithinIntervalCheck>(get_field_out("cldfrac_tot_for_analysis"),m_grid,0.0,1.0,false);
+  }
 
-  // Initialize p3
+  // Initialize p3. The Fortran ice lookup tables are not read here: they are
+  // filled below from the (broadcast) C++ tables, so that the two stay in sync.
   p3::p3_init(/* write_tables = */ false,
-              this->get_comm().am_i_root());
+              this->get_comm().am_i_root(),
+              /* read_ice_tables = */ false);
 
   // Initialize all of the structures that are passed to p3_main in run_impl.
   // Note: Some variables in the structures are not stored in the field manager.  For these
@@ -246,7 +289,9 @@ void P3Microphysics::initialize_impl (const RunType /* run_type */)
   const  auto& pseudo_density = get_field_in("pseudo_density").get_view<const Pack**>();
   const  auto& pseudo_density_dry = get_field_in("pseudo_density_dry").get_view<const Pack**>();
   const  auto& T_atm          = get_field_out("T_mid").get_view<Pack**>();
-  const  auto& cld_frac_t     = get_field_in("cldfrac_tot").get_view<const Pack**>();
+  const  auto& cld_frac_t     = m_fuse_cld_fraction
+                              ? get_field_out("cldfrac_tot").get_view<const Pack**>()
+                              : get_field_in("cldfrac_tot").get_view<const Pack**>();
   const  auto& qv             = get_field_out("qv").get_view<Pack**>();
   const  auto& qc             = get_field_out("qc").get_view<Pack**>();
   const  auto& nc             = get_field_out("nc").get_view<Pack**>();
@@ -273,6 +318,17 @@ void P3Microphysics::initialize_impl (const RunType /* run_type */)
                         T_atm,cld_frac_t,
                         qv, qc, nc, qr, nr, qi, qm, ni, bm, qv_prev,
                         inv_exner, th_atm, cld_frac_l, cld_frac_i, cld_frac_r, dz);
+  if (m_fuse_cld_fraction) {
+    // Same parameters (and defaults) as CldFraction
+    const Real ice_threshold      = m_cld_fraction_params.get<double>("ice_cloud_threshold",1e-12);
+    const Real ice_4out_threshold = m_cld_fraction_params.get<double>("ice_cloud_for_analysis_threshold",1e-5);
+    p3_preproc.set_cld_fraction(ice_threshold, ice_4out_threshold,
+                                get_field_in("cldfrac_liq").get_view<const Pack**>(),
+                                get_field_out("cldfrac_ice").get_view<Pack**>(),
+                                get_field_out("cldfrac_tot").get_view<Pack**>(),
+                                get_field_out("cldfrac_ice_for_analysis").get_view<Pack**>(),
+                                get_field_out("cldfrac_tot_for_analysis").get_view<Pack**>());
+  }
   // --Prognostic State Variables:
   prog_state.qc     = p3_preproc.qc;
   prog_state.nc     = p3_preproc.nc;
@@ -343,8 +399,25 @@ void P3Microphysics::initialize_impl (const RunType /* run_type */)
     p3_postproc.set_mass_and_energy_fluxes(vapor_flux, water_flux, ice_flux, heat_flux);
   }
 
-  // Load tables
-  P3F::init_kokkos_ice_lookup_tables(lookup_tables.ice_table_vals, lookup_tables.collect_table_vals);
+  // Load tables. The ice lookup table is read by the root rank only, and broadcast.
+  // If no file is specified, the default (binary, if available) table is used.
+  const auto ice_table_file = m_params.get<std::string>("ice_lookup_table_file","");
+  const auto& comm = get_comm();
+  P3F::init_kokkos_ice_lookup_tables(lookup_tables.ice_table_vals, lookup_tables.collect_table_vals,
+                                     ice_table_file, &comm);
+  {
+    // Fill the Fortran copy of the ice tables (Fortran order, on host)
+    using P3C = typename P3F::P3C;
+    using ice_table_f90 = Kokkos::View<Real****,Kokkos::LayoutLeft,Kokkos::HostSpace>;
+    using collect_table_f90 = Kokkos::View<Real*****,Kokkos::LayoutLeft,Kokkos::HostSpace>;
+    auto ice_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),lookup_tables.ice_table_vals);
+    auto collect_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),lookup_tables.collect_table_vals);
+    ice_table_f90 ice_f90("",P3C::densize,P3C::rimsize,P3C::isize,P3C::ice_table_size);
+    collect_table_f90 collect_f90("",P3C::densize,P3C::rimsize,P3C::isize,P3C::rcollsize,P3C::collect_table_size);
+    Kokkos::deep_copy(ice_f90,ice_h);
+    Kokkos::deep_copy(collect_f90,collect_h);
+    p3::p3_set_ice_tables(ice_f90.data(),collect_f90.data());
+  }
   P3F::init_kokkos_tables(lookup_tables.vn_table_vals, lookup_tables.vm_table_vals,
                           lookup_tables.revap_table_vals, lookup_tables.mu_r_table_vals,
                           lookup_tables.dnu_table_vals);
@@ -54,6 +54,10 @@ public:
   // Set the grid
   void set_grids (const std::shared_ptr<const GridsManager> grids_manager);
 
+  // If fuse_cld_fraction=true, P3 does the work of CldFraction
+  std::vector<std::string> get_fused_processes () const;
+  void set_fused_process_params (const std::string& type, const ekat::ParameterList& params);
+
   CP3 m_p3constants;
 
   /*--------------------------------------------------------------------------------------------*/
@@ -69,6 +73,21 @@ public:
     KOKKOS_INLINE_FUNCTION
     void operator()(const int icol) const {
       for (int ipack=0;ipack<m_npack;ipack++) {
+        // If CldFraction is fused into P3, compute the ice and total cloud fractions
+        // here, from the wet qi, exactly as CldFraction would (see physics/cld_fraction).
+        // Since cld_frac_t then points to cld_frac_tot, the rest of the loop uses them.
+        if (compute_cld_fraction) {
+          const Spack& qi_pack(qi(icol,ipack));
+          const Spack& cld_frac_liq_pack(cld_frac_liq(icol,ipack));
+          Spack ice_frac(0.0), ice_frac_4out(0.0);
+          ice_frac.set(qi_pack > ice_threshold, 1.0);
+          ice_frac_4out.set(qi_pack > ice_4out_threshold, 1.0);
+          cld_frac_ice(icol,ipack)      = ice_frac;
+          cld_frac_ice_4out(icol,ipack) = ice_frac_4out;
+          cld_frac_tot(icol,ipack)      = ekat::max(ice_frac,cld_frac_liq_pack);
+          cld_frac_tot_4out(icol,ipack) = ekat::max(ice_frac_4out,cld_frac_liq_pack);
+        }
+
         // The ipack slice of input variables used more than once
         const Spack& pmid_pack(pmid(icol,ipack));
         const Spack& T_atm_pack(T_atm(icol,ipack));
@@ -155,6 +174,14 @@ public:
     view_2d       cld_frac_i;
     view_2d       cld_frac_r;
     view_2d       dz;
+    bool          compute_cld_fraction = false;
+    Real          ice_threshold;
+    Real          ice_4out_threshold;
+    view_2d_const cld_frac_liq;
+    view_2d       cld_frac_ice;
+    view_2d       cld_frac_tot;
+    view_2d       cld_frac_ice_4out;
+    view_2d       cld_frac_tot_4out;
     // Assigning local variables
     void set_variables(const int ncol, const int npack,
            const view_2d_const& pmid_, const view_2d_const& pmid_dry_,
@@ -194,6 +221,24 @@ public:
       cld_frac_r = cld_frac_r_;
       dz = dz_;
     } // set_variables
+
+    // Fuse the CldFraction calculation into the preamble: cldfrac_tot is computed
+    // (rather than read) from cldfrac_liq and qi.
+    void set_cld_fraction (const Real ice_threshold_, const Real ice_4out_threshold_,
+                           const view_2d_const& cld_frac_liq_,
+                           const view_2d& cld_frac_ice_, const view_2d& cld_frac_tot_,
+                           const view_2d& cld_frac_ice_4out_, const view_2d& cld_frac_tot_4out_)
+    {
+      compute_cld_fraction = true;
+      ice_threshold      = ice_threshold_;
+      ice_4out_threshold = ice_4out_threshold_;
+      cld_frac_liq       = cld_frac_liq_;
+      cld_frac_ice       = cld_frac_ice_;
+      cld_frac_tot       = cld_frac_tot_;
+      cld_frac_ice_4out  = cld_frac_ice_4out_;
+      cld_frac_tot_4out  = cld_frac_tot_4out_;
+      cld_frac_t         = cld_frac_tot_;
+    }
   }; // p3_preamble
   /* --------------------------------------------------------------------------------------------*/
   // Most individual processes have a post-processing step that derives variables needed by the rest
@@ -401,6 +446,15 @@ protected:
   Int m_num_levs;
   Int m_nk_pack;
 
+  // If true, P3 also does the work of CldFraction (which should then not be in the
+  // list of processes), saving one kernel and one pass over qi and cldfrac_liq/tot.
+  // NOTE: this only fuses CldFraction. SHOC and P3 still run as separate processes,
+  //       with their own kernels and workspaces, and the state they both read
+  //       (T_mid, qv, qc, p_mid, dz, ...) is not shared in team scratch.
+  bool m_fuse_cld_fraction;
+  // The CldFraction parameters (if any), for the ice cloud thresholds
+  ekat::ParameterList m_cld_fraction_params;
+
   // Struct which contains local variables
   Buffer m_buffer;
 
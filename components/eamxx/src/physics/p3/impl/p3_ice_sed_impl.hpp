@@ -172,7 +172,15 @@ void Functions<S,D>
       }, Kokkos::Max<Scalar>(Co_max));
       team.team_barrier();
 
-      generalized_sedimentation<4>(rho, inv_rho, inv_dz, team, nk, k_qxtop, k_qxbot, kbot, kdir, Co_max, dt_left, prt_accum, fluxes_ptr, vs_ptr, qnr_ptr);
+      if (p3constants.p3_implicit_sedimentation && Co_max >= 1) {
+        // Do the whole remaining dt in one shot. If Co_max<1, substepping takes a
+        // single step anyway, so we keep the explicit scheme (and stay BFB with it).
+        implicit_sedimentation<4>(rho, inv_rho, inv_dz, team, nk, k_qxtop, kbot, kdir, dt_left, prt_accum, fluxes_ptr, vs_ptr, qnr_ptr);
+        k_qxbot = kbot;
+        dt_left = 0;
+      } else {
+        generalized_sedimentation<4>(rho, inv_rho, inv_dz, team, nk, k_qxtop, k_qxbot, kbot, kdir, Co_max, dt_left, prt_accum, fluxes_ptr, vs_ptr, qnr_ptr);
+      }
 
       //Update _incld values with end-of-step cell-ave values
       //No prob w/ div by cld_frac_i because set to min of 1e-4 in interface.
@@ -93,7 +93,6 @@ Int Functions<S,D>
   get_latent_heat(nj, nk, latent_heat_vapor, latent_heat_sublim, latent_heat_fusion);
 
   const Int nk_pack = ekat::npack<Spack>(nk);
-  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(nj, nk_pack);
 
   // load constants into local vars
   const     Scalar inv_dt          = 1 / infrastructure.dt;
@@ -101,20 +100,28 @@ Int Functions<S,D>
   const     Int    ktop         = kdir == -1 ? 0    : nk-1;
   const     Int    kbot         = kdir == -1 ? nk-1 : 0;
   constexpr bool   debug_ABORT  = false;
+  constexpr Scalar qsmall       = C::QSMALL;
+  constexpr Scalar T_zerodegc   = C::T_zerodegc;
+
+  // The active level range below assumes the model top is at k=0
+  static_assert(kdir == -1, "Error! P3 level trimming assumes kdir=-1.\n");
 
   // per-column bools
   view_2d<bool> bools("bools", nj, 2);
 
+  // active columns first, then inactive ones
+  view_1d<Int> col_ids("col_ids", nj);
+
   // we do not want to measure init stuff
   auto start = std::chrono::steady_clock::now();
 
-  // p3_main loop
-  Kokkos::parallel_for(
-    "p3 main loop",
-    policy,
-    KOKKOS_LAMBDA(const MemberType& team) {
+  // Only columns with hydrometeors (or where nucleation is possible) need the
+  // full pipeline. The others only need initialization and the clipping of part1.
+  const Int num_active = p3_main_compact_columns(prognostic_state, diagnostic_inputs, col_ids, nj, nk, p3constants);
 
-    const Int i = team.league_rank();
+  // Process column i. If full_pipeline=false, stop after part1 (the column is
+  // known to have neither hydrometeors nor nucleation).
+  const auto p3_main_column = KOKKOS_LAMBDA(const MemberType& team, const Int i, const bool full_pipeline) {
 
     auto workspace = workspace_mgr.get_workspace(team);
 
@@ -238,11 +245,30 @@ Int Functions<S,D>
       obm, qc_incld, qr_incld, qi_incld, qm_incld, nc_incld, nr_incld,
       ni_incld, bm_incld, nucleationPossible, hydrometeorsPresent, p3constants);
 
+    EKAT_KERNEL_ASSERT_MSG (full_pipeline || !(nucleationPossible || hydrometeorsPresent),
+        "Error! P3 column flagged as inactive, but it has hydrometeors or nucleation.\n");
+
     // There might not be any work to do for this team
-    if (!(nucleationPossible || hydrometeorsPresent)) {
+    if (!full_pipeline || !(nucleationPossible || hydrometeorsPresent)) {
       return; // this is how you do a "continue" in a kokkos lambda
     }
 
+    // Find the topmost pack with some work to do. Packs above it have no hydrometeors,
+    // and are cold and subsaturated, so part2 skips them (see skip_all there). Since
+    // sedimentation only moves hydrometeors downward, all stages below can skip them.
+    Int kp_top = nk_pack;
+    Kokkos::parallel_reduce(
+      Kokkos::TeamVectorRange(team, nk_pack), [&] (Int k, Int& lmin) {
+      const auto range_mask = ekat::range<IntSmallPack>(k*Spack::n) < nk;
+      const auto skip_all = ( !range_mask ||
+          (oqc(k)<qsmall && oqr(k)<qsmall && oqi(k)<qsmall &&
+           T_atm(k)<T_zerodegc && qv_supersat_i(k)< -0.05) );
+      if (!skip_all.all() && k<lmin) {
+        lmin = k;
+      }
+    }, Kokkos::Min<Int>(kp_top));
+    const Int ktop_active = kp_top*Spack::n;
+
     // ------------------------------------------------------------------------------------------
     // main k-loop (for processes):
 
@@ -256,7 +282,7 @@ Int Functions<S,D>
       nr_incld, ni_incld, bm_incld, mu_c, nu, lamc, cdist, cdist1, cdistr,
       mu_r, lamr, logn0r, oqv2qi_depos_tend, oprecip_total_tend, onevapr, qr_evap_tend,
       ovap_liq_exchange, ovap_ice_exchange, oliq_ice_exchange,
-      pratot, prctot, hydrometeorsPresent, nk, p3constants);
+      pratot, prctot, hydrometeorsPresent, nk, p3constants, kp_top);
 
     //NOTE: At this point, it is possible to have negative (but small) nc, nr, ni.  This is not
     //      a problem; those values get clipped to zero in the sedimentation section (if necessary).
@@ -275,27 +301,27 @@ Int Functions<S,D>
 
     cloud_sedimentation(
       qc_incld, rho, inv_rho, ocld_frac_l, acn, inv_dz, lookup_tables.dnu_table_vals, team, workspace,
-      nk, ktop, kbot, kdir, infrastructure.dt, inv_dt, infrastructure.predictNc,
+      nk, ktop_active, kbot, kdir, infrastructure.dt, inv_dt, infrastructure.predictNc,
       oqc, onc, nc_incld, mu_c, lamc, qtend_ignore, ntend_ignore,
       diagnostic_outputs.precip_liq_surf(i));
 
     // Rain sedimentation:  (adaptive substepping)
     rain_sedimentation(
       rho, inv_rho, rhofacr, ocld_frac_r, inv_dz, qr_incld, team, workspace,
-      lookup_tables.vn_table_vals, lookup_tables.vm_table_vals, nk, ktop, kbot, kdir, infrastructure.dt, inv_dt, oqr,
+      lookup_tables.vn_table_vals, lookup_tables.vm_table_vals, nk, ktop_active, kbot, kdir, infrastructure.dt, inv_dt, oqr,
       onr, nr_incld, mu_r, lamr, oprecip_liq_flux, qtend_ignore, ntend_ignore,
       diagnostic_outputs.precip_liq_surf(i), p3constants);
 
     // Ice sedimentation:  (adaptive substepping)
     ice_sedimentation(
-      rho, inv_rho, rhofaci, ocld_frac_i, inv_dz, team, workspace, nk, ktop, kbot,
+      rho, inv_rho, rhofaci, ocld_frac_i, inv_dz, team, workspace, nk, ktop_active, kbot,
       kdir, infrastructure.dt, inv_dt, oqi, qi_incld, oni, ni_incld,
       oqm, qm_incld, obm, bm_incld, qtend_ignore, ntend_ignore,
       lookup_tables.ice_table_vals, diagnostic_outputs.precip_ice_surf(i), p3constants);
 
     // homogeneous freezing of cloud and rain
     homogeneous_freezing(
-      T_atm, oinv_exner, olatent_heat_fusion, team, nk, ktop, kbot, kdir, oqc, onc, oqr, onr, oqi,
+      T_atm, oinv_exner, olatent_heat_fusion, team, nk, ktop_active, kbot, kdir, oqc, onc, oqr, onr, oqi,
       oni, oqm, obm, oth);
 
     //
@@ -307,7 +333,7 @@ Int Functions<S,D>
       rho, inv_rho, rhofaci, oqv, oth, oqc, onc, oqr, onr, oqi, oni,
       oqm, obm, olatent_heat_vapor, olatent_heat_sublim, mu_c, nu, lamc, mu_r, lamr,
       ovap_liq_exchange, ze_rain, ze_ice, diag_vm_qi, odiag_eff_radius_qi, diag_diam_qi,
-      orho_qi, diag_equiv_reflectivity, odiag_eff_radius_qc, odiag_eff_radius_qr, p3constants);
+      orho_qi, diag_equiv_reflectivity, odiag_eff_radius_qc, odiag_eff_radius_qr, p3constants, kp_top);
 
     //
     // merge ice categories with similar properties
@@ -326,7 +352,29 @@ Int Functions<S,D>
     check_values(oqv, tmparr1, ktop, kbot, infrastructure.it, debug_ABORT, 900,
                  team, ocol_location);
 #endif
-  });
+  };
+
+  // p3_main loop
+  if (num_active>0) {
+    const auto policy_active = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(num_active, nk_pack);
+    Kokkos::parallel_for(
+      "p3 main loop",
+      policy_active,
+      KOKKOS_LAMBDA(const MemberType& team) {
+      p3_main_column(team, col_ids(team.league_rank()), true);
+    });
+  }
+
+  // Fast path for the columns with nothing to do
+  if (num_active<nj) {
+    const auto policy_inactive = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(nj-num_active, nk_pack);
+    Kokkos::parallel_for(
+      "p3 main loop (inactive columns)",
+      policy_inactive,
+      KOKKOS_LAMBDA(const MemberType& team) {
+      p3_main_column(team, col_ids(num_active+team.league_rank()), false);
+    });
+  }
   Kokkos::fence();
 
   auto finish = std::chrono::steady_clock::now();
@@ -334,6 +382,98 @@ Int Functions<S,D>
   return duration.count();
 }
 
+template <typename S, typename D>
+Int Functions<S,D>
+::p3_main_compact_columns(
+  const P3PrognosticState& prognostic_state,
+  const P3DiagnosticInputs& diagnostic_inputs,
+  const view_1d<Int>& col_ids,
+  Int nj,
+  Int nk,
+  const physics::P3_Constants<S> & p3constants)
+{
+  using ExeSpace = typename KT::ExeSpace;
+  using RangePolicy = typename KT::RangePolicy;
+  using physics = scream::physics::Functions<Scalar, Device>;
+
+  constexpr Scalar T_zerodegc = C::T_zerodegc;
+  constexpr Scalar qsmall     = C::QSMALL;
+  const auto svp_fcn = p3constants.p3_svp_table ? physics::MurphyKoopTable : physics::MurphyKoop;
+
+  const Int nk_pack = ekat::npack<Spack>(nk);
+  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(nj, nk_pack);
+
+  const auto th        = prognostic_state.th;
+  const auto qv        = prognostic_state.qv;
+  const auto qc        = prognostic_state.qc;
+  const auto qr        = prognostic_state.qr;
+  const auto qi        = prognostic_state.qi;
+  const auto pres      = diagnostic_inputs.pres;
+  const auto inv_exner = diagnostic_inputs.inv_exner;
+
+  // Flag active columns. The quantities below are computed exactly as in
+  // p3_main_init and p3_main_part1, which set nucleationPossible and hydrometeorsPresent.
+  view_1d<Int> active("active", nj);
+  Kokkos::parallel_for(
+    "p3 screen columns",
+    policy,
+    KOKKOS_LAMBDA(const MemberType& team) {
+
+    const Int i = team.league_rank();
+
+    Int is_active = 0;
+    Kokkos::parallel_reduce(
+      Kokkos::TeamVectorRange(team, nk_pack), [&] (Int k, Int& lactive) {
+
+      const auto range_pack = ekat::range<IntSmallPack>(k*Spack::n);
+      const auto range_mask = range_pack < nk;
+
+      const Spack T_atm = th(i,k) * (1 / inv_exner(i,k));
+      const Spack qv_sat_i = physics::qv_sat_dry(T_atm, pres(i,k), true, range_mask, svp_fcn, "p3::p3_main_compact_columns");
+      const Spack qv_supersat_i = max(qv(i,k), 0) / qv_sat_i - 1;
+
+      const auto nucleation = T_atm < T_zerodegc && qv_supersat_i >= -0.05;
+      const auto has_qc = !(qc(i,k) < qsmall) && range_mask;
+      const auto has_qr = !(qr(i,k) < qsmall) && range_mask;
+      const auto has_qi = !(qi(i,k) < qsmall || (qi(i,k) < 1.e-8 && qv_supersat_i < -0.1)) && range_mask;
+      if ( nucleation.any() || has_qc.any() || has_qr.any() || has_qi.any() ) {
+        lactive += 1;
+      }
+    }, is_active);
+
+    Kokkos::single(Kokkos::PerTeam(team), [&] {
+      active(i) = is_active>0 ? 1 : 0;
+    });
+  });
+
+  // Compact: active columns go first, in increasing order, then the inactive ones
+  view_1d<Int> active_offset("active_offset", nj);
+  Int num_active = 0;
+  Kokkos::parallel_scan(
+    "p3 count active columns",
+    RangePolicy(0, nj),
+    KOKKOS_LAMBDA(const Int i, Int& offset, const bool final) {
+    if (final) {
+      active_offset(i) = offset;
+    }
+    offset += active(i);
+  }, num_active);
+
+  Kokkos::parallel_for(
+    "p3 compact columns",
+    RangePolicy(0, nj),
+    KOKKOS_LAMBDA(const Int i) {
+    const Int offset = active_offset(i);
+    if (active(i)) {
+      col_ids(offset) = i;
+    } else {
+      col_ids(num_active + i - offset) = i;
+    }
+  });
+
+  return num_active;
+}
+
 template <typename S, typename D>
 Int Functions<S,D>
 ::p3_main(
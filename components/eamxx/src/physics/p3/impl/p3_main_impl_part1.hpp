@@ -82,6 +82,7 @@ void Functions<S,D>
   constexpr Scalar inv_cp       = C::INV_CP;
 
   const Scalar p3_spa_to_nc = p3constants.p3_spa_to_nc;
+  const auto svp_fcn = p3constants.p3_svp_table ? physics::MurphyKoopTable : physics::MurphyKoop;
 
   nucleationPossible = false;
   hydrometeorsPresent = false;
@@ -105,8 +106,8 @@ void Functions<S,D>
 
     rho(k)          = dpres(k)/dz(k) / g;
     inv_rho(k)      = 1 / rho(k);
-    qv_sat_l(k)     = physics::qv_sat_dry(T_atm(k), pres(k), false, range_mask, physics::MurphyKoop, "p3::p3_main_part1 (liquid)");
-    qv_sat_i(k)     = physics::qv_sat_dry(T_atm(k), pres(k), true,  range_mask, physics::MurphyKoop, "p3::p3_main_part1 (ice)");
+    qv_sat_l(k)     = physics::qv_sat_dry(T_atm(k), pres(k), false, range_mask, svp_fcn, "p3::p3_main_part1 (liquid)");
+    qv_sat_i(k)     = physics::qv_sat_dry(T_atm(k), pres(k), true,  range_mask, svp_fcn, "p3::p3_main_part1 (ice)");
 
     qv_supersat_i(k) = qv(k) / qv_sat_i(k) - 1;
 
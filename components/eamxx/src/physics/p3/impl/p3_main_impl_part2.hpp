@@ -95,7 +95,8 @@ void Functions<S,D>
   const uview_1d<Spack>& pratot,
   const uview_1d<Spack>& prctot,
   bool& hydrometeorsPresent, const Int& nk,
-  const physics::P3_Constants<S> & p3constants)
+  const physics::P3_Constants<S> & p3constants,
+  const Int kp_top)
 {
   constexpr Scalar qsmall       = C::QSMALL;
   constexpr Scalar nsmall       = C::NSMALL;
@@ -110,7 +111,7 @@ void Functions<S,D>
   team.team_barrier();
 
   Kokkos::parallel_for(
-    Kokkos::TeamVectorRange(team, nk_pack), [&] (Int k) {
+    Kokkos::TeamVectorRange(team, kp_top, nk_pack), [&] (Int k) {
 
     //compute mask to identify padded values in packs, which shouldn't be used in calculations
     const auto range_pack = ekat::range<IntSmallPack>(k*Spack::n);
@@ -58,14 +58,15 @@ void Functions<S,D>
   const uview_1d<Spack>& diag_equiv_reflectivity,
   const uview_1d<Spack>& diag_eff_radius_qc,
   const uview_1d<Spack>& diag_eff_radius_qr,
-  const physics::P3_Constants<S> & p3constants)
+  const physics::P3_Constants<S> & p3constants,
+  const Int kp_top)
 {
   constexpr Scalar qsmall       = C::QSMALL;
   constexpr Scalar inv_cp       = C::INV_CP;
   constexpr Scalar nsmall       = C::NSMALL;
 
   Kokkos::parallel_for(
-    Kokkos::TeamVectorRange(team, nk_pack), [&] (Int k) {
+    Kokkos::TeamVectorRange(team, kp_top, nk_pack), [&] (Int k) {
 
     Spack
       ignore1  (0),
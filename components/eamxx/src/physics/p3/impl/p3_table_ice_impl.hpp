@@ -3,6 +3,9 @@
 
 #include "p3_functions.hpp" // for ETI only but harmless for GPU
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 
 namespace scream {
@@ -13,26 +16,40 @@ namespace p3 {
  * this file, #include p3_functions.hpp instead.
  */
 
-template <typename S, typename D>
-void Functions<S,D>
-::init_kokkos_ice_lookup_tables(view_ice_table& ice_table_vals, view_collect_table& collect_table_vals) {
-
-  using DeviceIcetable = typename view_ice_table::non_const_type;
-  using DeviceColtable = typename view_collect_table::non_const_type;
+namespace {
 
-  const auto ice_table_vals_d     = DeviceIcetable("ice_table_vals");
-  const auto collect_table_vals_d = DeviceColtable("collect_table_vals");
-
-  const auto ice_table_vals_h    = Kokkos::create_mirror_view(ice_table_vals_d);
-  const auto collect_table_vals_h = Kokkos::create_mirror_view(collect_table_vals_d);
+// FNV-1a hash of the table entries, used to detect corrupted binary tables
+inline std::uint64_t ice_table_checksum (const std::vector<double>& data)
+{
+  std::uint64_t hash = 14695981039346656037ULL;
+  const auto bytes = reinterpret_cast<const unsigned char*>(data.data());
+  const auto nbytes = data.size()*sizeof(double);
+  for (std::size_t i=0; i<nbytes; ++i) {
+    hash ^= bytes[i];
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
 
-  //
-  // read in ice microphysics table into host views
-  //
+} // anonymous namespace
 
+template <typename S, typename D>
+std::string Functions<S,D>
+::default_ice_lookup_table_file (const bool binary)
+{
   std::string filename = std::string(P3C::p3_lookup_base) + std::string(P3C::p3_version);
+  if (binary) {
+    filename += P3C::p3_lookup_bin_ext;
+  }
+  return filename;
+}
 
+template <typename S, typename D>
+void Functions<S,D>
+::read_ice_lookup_tables_ascii (const std::string& filename, std::vector<double>& table_data)
+{
   std::ifstream in(filename);
+  EKAT_REQUIRE_MSG(in.good(), "Error! Could not open P3 ice lookup table file " << filename << "\n");
 
   // read header
   std::string version, version_val;
@@ -40,6 +57,15 @@ void Functions<S,D>
   EKAT_REQUIRE_MSG(version == "VERSION", "Bad " << filename << ", expected VERSION X.Y.Z header");
   EKAT_REQUIRE_MSG(version_val == P3C::p3_version, "Bad " << filename << ", expected version " << P3C::p3_version << ", but got " << version_val);
 
+  table_data.resize(P3C::ice_table_nvals + P3C::collect_table_nvals);
+  const auto ice_idx = [](int jj, int ii, int i, int j) {
+    return ((jj*P3C::rimsize + ii)*P3C::isize + i)*P3C::ice_table_size + j;
+  };
+  const auto coll_idx = [](int jj, int ii, int i, int j, int k) {
+    return P3C::ice_table_nvals +
+           (((jj*P3C::rimsize + ii)*P3C::isize + i)*P3C::rcollsize + j)*P3C::collect_table_size + k;
+  };
+
   // read tables
   double dum_s; int dum_i; // dum_s needs to be double to stream correctly
   for (int jj = 0; jj < P3C::densize; ++jj) {
@@ -50,7 +76,7 @@ void Functions<S,D>
         for (int j = 0; j < 15; ++j) {
           in >> dum_s;
           if (j > 1 && j != 10) {
-            ice_table_vals_h(jj, ii, i, j_idx++) = dum_s;
+            table_data[ice_idx(jj, ii, i, j_idx++)] = dum_s;
           }
         }
       }
@@ -62,13 +88,178 @@ void Functions<S,D>
           for (int k = 0; k < 6; ++k) {
             in >> dum_s;
             if (k == 3 || k == 4) {
-              collect_table_vals_h(jj, ii, i, j, k_idx++) = std::log10(dum_s);
+              table_data[coll_idx(jj, ii, i, j, k_idx++)] = std::log10(dum_s);
             }
           }
         }
       }
     }
   }
+  EKAT_REQUIRE_MSG(not in.fail(), "Error! Something went wrong while parsing " << filename << "\n");
+}
+
+template <typename S, typename D>
+void Functions<S,D>
+::read_ice_lookup_tables_binary (const std::string& filename, std::vector<double>& table_data)
+{
+  std::ifstream in(filename, std::ios::binary);
+  EKAT_REQUIRE_MSG(in.good(), "Error! Could not open P3 ice lookup table file " << filename << "\n");
+
+  // Header: magic, format, table version, table dims, number of entries, checksum
+  char magic[8];
+  std::int32_t format;
+  char version[16];
+  std::int32_t dims[6];
+  std::int64_t nvals;
+  std::uint64_t checksum;
+  in.read(magic,sizeof(magic));
+  in.read(reinterpret_cast<char*>(&format),sizeof(format));
+  in.read(version,sizeof(version));
+  in.read(reinterpret_cast<char*>(dims),sizeof(dims));
+  in.read(reinterpret_cast<char*>(&nvals),sizeof(nvals));
+  in.read(reinterpret_cast<char*>(&checksum),sizeof(checksum));
+  EKAT_REQUIRE_MSG(in.good(), "Error! Could not read header of binary table " << filename << "\n");
+
+  EKAT_REQUIRE_MSG(std::string(magic,sizeof(magic))==P3C::p3_lookup_bin_magic,
+      "Error! " << filename << " is not a binary P3 ice lookup table.\n");
+  EKAT_REQUIRE_MSG(format==P3C::p3_lookup_bin_format,
+      "Error! Unsupported binary table format in " << filename << ".\n"
+      "  - expected format: " << P3C::p3_lookup_bin_format << "\n"
+      "  - file format:     " << format << "\n"
+      "  Re-generate the table with the p3_tables_setup executable.\n");
+  version[sizeof(version)-1] = '\0';
+  EKAT_REQUIRE_MSG(std::string(version)==P3C::p3_version,
+      "Bad " << filename << ", expected version " << P3C::p3_version << ", but got " << version);
+  const std::int32_t expected_dims[6] = {P3C::densize, P3C::rimsize, P3C::isize, P3C::ice_table_size,
+                                         P3C::rcollsize, P3C::collect_table_size};
+  EKAT_REQUIRE_MSG(std::equal(dims,dims+6,expected_dims) and
+                   nvals==P3C::ice_table_nvals+P3C::collect_table_nvals,
+      "Error! Table dimensions in " << filename << " do not match the ones expected by P3.\n");
+
+  table_data.resize(nvals);
+  in.read(reinterpret_cast<char*>(table_data.data()),nvals*sizeof(double));
+  EKAT_REQUIRE_MSG(in.good(), "Error! Could not read table entries from " << filename << "\n");
+  EKAT_REQUIRE_MSG(ice_table_checksum(table_data)==checksum,
+      "Error! Checksum mismatch in " << filename << ". The file may be corrupted.\n"
+      "  Re-generate the table with the p3_tables_setup executable.\n");
+}
+
+template <typename S, typename D>
+void Functions<S,D>
+::write_ice_lookup_tables_binary (const std::string& filename, const std::vector<double>& table_data)
+{
+  EKAT_REQUIRE_MSG(table_data.size()==static_cast<std::size_t>(P3C::ice_table_nvals+P3C::collect_table_nvals),
+      "Error! Wrong number of entries in the P3 ice lookup tables.\n");
+
+  std::ofstream out(filename, std::ios::binary);
+  EKAT_REQUIRE_MSG(out.good(), "Error! Could not open " << filename << " for writing.\n");
+
+  char magic[8];
+  std::memcpy(magic,P3C::p3_lookup_bin_magic,sizeof(magic));
+  const std::int32_t format = P3C::p3_lookup_bin_format;
+  char version[16] = {};
+  std::strncpy(version,P3C::p3_version,sizeof(version)-1);
+  const std::int32_t dims[6] = {P3C::densize, P3C::rimsize, P3C::isize, P3C::ice_table_size,
+                                P3C::rcollsize, P3C::collect_table_size};
+  const std::int64_t nvals = table_data.size();
+  const std::uint64_t checksum = ice_table_checksum(table_data);
+
+  out.write(magic,sizeof(magic));
+  out.write(reinterpret_cast<const char*>(&format),sizeof(format));
+  out.write(version,sizeof(version));
+  out.write(reinterpret_cast<const char*>(dims),sizeof(dims));
+  out.write(reinterpret_cast<const char*>(&nvals),sizeof(nvals));
+  out.write(reinterpret_cast<const char*>(&checksum),sizeof(checksum));
+  out.write(reinterpret_cast<const char*>(table_data.data()),nvals*sizeof(double));
+  EKAT_REQUIRE_MSG(out.good(), "Error! Something went wrong while writing " << filename << "\n");
+}
+
+template <typename S, typename D>
+void Functions<S,D>
+::init_kokkos_ice_lookup_tables(view_ice_table& ice_table_vals, view_collect_table& collect_table_vals,
+                                const std::string& filename, const ekat::Comm* comm) {
+
+  using DeviceIcetable = typename view_ice_table::non_const_type;
+  using DeviceColtable = typename view_collect_table::non_const_type;
+
+  const auto ice_table_vals_d     = DeviceIcetable("ice_table_vals");
+  const auto collect_table_vals_d = DeviceColtable("collect_table_vals");
+
+  const auto ice_table_vals_h    = Kokkos::create_mirror_view(ice_table_vals_d);
+  const auto collect_table_vals_h = Kokkos::create_mirror_view(collect_table_vals_d);
+
+  //
+  // read in ice microphysics table on the root rank, then broadcast it
+  //
+
+  std::vector<double> table_data(P3C::ice_table_nvals + P3C::collect_table_nvals);
+  const bool am_i_root = comm==nullptr or comm->am_i_root();
+  int success = 1;
+  std::string err_msg;
+  if (am_i_root) {
+    try {
+      std::string fname = filename;
+      if (fname=="") {
+        // Prefer the binary table, if it was generated
+        fname = default_ice_lookup_table_file(true);
+        if (not std::ifstream(fname).good()) {
+          fname = default_ice_lookup_table_file(false);
+        }
+      }
+
+      // Detect the format from the first bytes of the file
+      std::ifstream in(fname, std::ios::binary);
+      EKAT_REQUIRE_MSG(in.good(), "Error! Could not open P3 ice lookup table file " << fname << "\n");
+      const std::string magic_str (P3C::p3_lookup_bin_magic);
+      std::string magic (magic_str.size(),' ');
+      in.read(&magic[0],magic.size());
+      in.close();
+
+      if (magic==magic_str) {
+        read_ice_lookup_tables_binary(fname,table_data);
+      } else {
+        read_ice_lookup_tables_ascii(fname,table_data);
+      }
+    } catch (std::exception& e) {
+      success = 0;
+      err_msg = e.what();
+    }
+  }
+
+  // Make sure all ranks know if the root failed, rather than hanging in the bcast
+  if (comm!=nullptr) {
+    comm->broadcast(&success,1,comm->root_rank());
+  }
+  EKAT_REQUIRE_MSG(success==1,
+      "Error! Could not load the P3 ice lookup tables.\n" <<
+      (am_i_root ? err_msg : std::string("  See the root rank error message for details.\n")));
+
+  if (comm!=nullptr) {
+    comm->broadcast(table_data.data(),table_data.size(),comm->root_rank());
+  }
+
+  // unpack the flat array into the host views
+  int idx = 0;
+  for (int jj = 0; jj < P3C::densize; ++jj) {
+    for (int ii = 0; ii < P3C::rimsize; ++ii) {
+      for (int i = 0; i < P3C::isize; ++i) {
+        for (int j = 0; j < P3C::ice_table_size; ++j) {
+          ice_table_vals_h(jj, ii, i, j) = table_data[idx++];
+        }
+      }
+    }
+  }
+  for (int jj = 0; jj < P3C::densize; ++jj) {
+    for (int ii = 0; ii < P3C::rimsize; ++ii) {
+      for (int i = 0; i < P3C::isize; ++i) {
+        for (int j = 0; j < P3C::rcollsize; ++j) {
+          for (int k = 0; k < P3C::collect_table_size; ++k) {
+            collect_table_vals_h(jj, ii, i, j, k) = table_data[idx++];
+          }
+        }
+      }
+    }
+  }
 
   // deep copy to device
   Kokkos::deep_copy(ice_table_vals_d, ice_table_vals_h);
@@ -128,6 +128,56 @@ void Functions<S,D>
   dt_left -= dt_sub;
 }
 
+template <typename S, typename D>
+template <int nfield>
+KOKKOS_FUNCTION
+void Functions<S,D>
+::implicit_sedimentation (
+  const uview_1d<const Spack>& rho,
+  const uview_1d<const Spack>& inv_rho,
+  const uview_1d<const Spack>& inv_dz,
+  const MemberType& team,
+  const Int& /* nk */, const Int& k_qxtop, const Int& kbot, const Int& kdir, const Scalar& dt, Scalar& prt_accum,
+  const view_1d_ptr_array<Spack, nfield>& fluxes,
+  const view_1d_ptr_array<Spack, nfield>& Vs, // (behaviorally const)
+  const view_1d_ptr_array<Spack, nfield>& rs)
+{
+  const auto srho     = scalarize(rho);
+  const auto sinv_rho = scalarize(inv_rho);
+  const auto sinv_dz  = scalarize(inv_dz);
+
+  // Each level depends on the flux coming from the level above, so this is a
+  // sequential sweep. It replaces an unbounded number of substeps, each with
+  // its own team-wide reduction and barriers.
+  Kokkos::single(
+    Kokkos::PerTeam(team), [&] () {
+      for (int f = 0; f < nfield; ++f) {
+        const auto sflux = scalarize(*fluxes[f]);
+        const auto sV    = scalarize(*Vs[f]);
+        const auto sr    = scalarize(*rs[f]);
+
+        Scalar flux_in = 0;
+        Scalar V_above = 0;
+        for (Int k = k_qxtop; ; k -= kdir) {
+          // r_new = r_old + dt/(rho*dz) * (flux_in - rho*V*r_new)
+          const Scalar V = sV(k) > 0 ? sV(k) : V_above;
+          sr(k) = (sr(k) + dt * sinv_rho(k) * sinv_dz(k) * flux_in) /
+                  (1 + dt * V * sinv_dz(k));
+          sflux(k) = srho(k) * V * sr(k);
+
+          flux_in = sflux(k);
+          V_above = V;
+          if (k == kbot) break;
+        }
+      }
+    });
+  team.team_barrier();
+
+  // accumulated precip during time step
+  const auto sflux0 = scalarize(*fluxes[0]);
+  prt_accum += sflux0(kbot) * dt;
+}
+
 template <typename S, typename D>
 template <int nfield>
 KOKKOS_FUNCTION
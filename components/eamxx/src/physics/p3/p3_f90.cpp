@@ -10,7 +10,9 @@ extern "C" {
   void micro_p3_utils_init_c(Real Cpair, Real Rair, Real RH2O, Real RHO_H2O,
                  Real MWH2O, Real MWdry, Real gravit, Real LatVap, Real LatIce,
                  Real CpLiq, Real Tmelt, Real Pi, bool masterproc);
-  void p3_init_c(const char** lookup_file_dir, int* info, const bool& write_tables);
+  void p3_init_c(const char** lookup_file_dir, int* info, const bool& write_tables,
+                 const bool& read_ice_tables);
+  void p3_set_ice_tables_c(const Real* ice_table_vals, const Real* collect_table_vals);
 }
 
 namespace scream {
@@ -100,18 +102,22 @@ void micro_p3_utils_init (const bool masterproc) {
                  c::CpLiq, c::Tmelt, c::Pi, masterproc);
 }
 
-void p3_init (const bool write_tables, const bool masterproc) {
+void p3_init (const bool write_tables, const bool masterproc, const bool read_ice_tables) {
   static bool is_init = false;
   if (!is_init) {
     micro_p3_utils_init(masterproc);
     static const char* dir = SCREAM_DATA_DIR "/tables";
     Int info;
-    p3_init_c(&dir, &info, write_tables);
+    p3_init_c(&dir, &info, write_tables, read_ice_tables);
     EKAT_REQUIRE_MSG(info == 0, "p3_init_c returned info " << info);
     is_init = true;
   }
 }
 
+void p3_set_ice_tables (const Real* ice_table_vals, const Real* collect_table_vals) {
+  p3_set_ice_tables_c(ice_table_vals, collect_table_vals);
+}
+
 int test_FortranData () {
   FortranData d(11, 72);
   return 0;
@@ -61,8 +61,16 @@ private:
   void init(const FortranData::Ptr& d);
 };
 
+// If read_ice_tables is false, the Fortran ice lookup tables are not read from
+// file, and must be filled with p3_set_ice_tables.
 void p3_init(const bool write_tables = false,
-             const bool masterproc = false);
+             const bool masterproc = false,
+             const bool read_ice_tables = true);
+
+// Fill the Fortran ice lookup tables. The arrays are in Fortran (LayoutLeft)
+// order, with dims (densize,rimsize,isize,ice_table_size) and
+// (densize,rimsize,isize,rcollsize,collect_table_size), respectively.
+void p3_set_ice_tables(const Real* ice_table_vals, const Real* collect_table_vals);
 
 // We will likely want to remove these checks in the future, as we're not tied
 // to the exact implementation or arithmetic in P3. For now, these checks are
@@ -7,6 +7,10 @@
 
 #include "ekat/ekat_pack_kokkos.hpp"
 #include "ekat/ekat_workspace.hpp"
+#include "ekat/mpi/ekat_comm.hpp"
+
+#include <string>
+#include <vector>
 
 namespace scream {
 namespace p3 {
@@ -35,6 +39,8 @@ struct Functions
       ice_table_size     = 12, // number of quantities used from lookup table
       rcollsize   = 30,
       collect_table_size  = 2,  // number of ice-rain collection  quantities used from lookup table
+      ice_table_nvals     = densize*rimsize*isize*ice_table_size,
+      collect_table_nvals = densize*rimsize*isize*rcollsize*collect_table_size,
 
       // switch for warm-rain parameterization
       // 1 => Seifert and Beheng 2001
@@ -47,7 +53,13 @@ struct Functions
     static constexpr ScalarT lookup_table_1a_dum1_c =  4.135985029041767e+00; // 1.0/(0.1*log10(261.7))
     static constexpr const char* p3_lookup_base = SCREAM_DATA_DIR "/tables/p3_lookup_table_1.dat-v";
 
-    static constexpr const char* p3_version = "4.1.1"; // TODO: Change this so that the table version and table path is a runtime option.
+    static constexpr const char* p3_version = "4.1.1";
+
+    // Binary ice lookup table: extension appended to the ASCII table name, and
+    // magic/format version identifying the header layout
+    static constexpr const char* p3_lookup_bin_ext = ".bin";
+    static constexpr const char* p3_lookup_bin_magic = "P3ICETAB";
+    static constexpr int p3_lookup_bin_format = 1;
   };
 
   //
@@ -272,8 +284,25 @@ struct Functions
     view_2d_table& vn_table_vals, view_2d_table& vm_table_vals, view_2d_table& revap_table_vals,
     view_1d_table& mu_r_table_vals, view_dnu_table& dnu);
 
+  // Load the ice lookup tables. The file can be either the original ASCII table, or
+  // the binary version generated by p3_tables_setup (detected by its header). If
+  // filename is empty, we use the binary table in the default location if it exists,
+  // and the default ASCII table otherwise. If comm is not null, only its root rank
+  // reads the file, and the tables are broadcast to the other ranks.
   static void init_kokkos_ice_lookup_tables(
-    view_ice_table& ice_table_vals, view_collect_table& collect_table_vals);
+    view_ice_table& ice_table_vals, view_collect_table& collect_table_vals,
+    const std::string& filename = "", const ekat::Comm* comm = nullptr);
+
+  // Host-only utilities for the ice lookup tables I/O. The tables are stored in a
+  // flat array (ice table first, then collect table), already post-processed
+  // (i.e., with unused entries removed, and log10 applied to the collect table)
+  static std::string default_ice_lookup_table_file (const bool binary);
+  static void read_ice_lookup_tables_ascii (const std::string& filename,
+                                            std::vector<double>& table_data);
+  static void read_ice_lookup_tables_binary (const std::string& filename,
+                                             std::vector<double>& table_data);
+  static void write_ice_lookup_tables_binary (const std::string& filename,
+                                              const std::vector<double>& table_data);
 
   // Map (mu_r, lamr) to Table3 data.
   KOKKOS_FUNCTION
@@ -397,6 +426,26 @@ struct Functions
     const view_1d_ptr_array<Spack, nfield>& Vs, // (behaviorally const)
     const view_1d_ptr_array<Spack, nfield>& rs);
 
+  // One-shot alternative to the CFL-limited substepping of generalized_sedimentation.
+  // Uses a backward-Euler (implicit) first-order upwind step over the whole dt, which
+  // is stable, positive and mass conserving for any Courant number. Since the flux
+  // out of a cell only depends on the cell itself and on the flux from above, the
+  // implicit system is solved with a single top-down sweep. Empty cells take the fall
+  // speed of the cell above, so that mass falling into them keeps falling.
+  // On output, fluxes holds the (implicit) fluxes out of the bottom of each cell
+  // in [k_qxtop, kbot], and prt_accum has been updated with the surface precip.
+  template <int nfield>
+  KOKKOS_FUNCTION
+  static void implicit_sedimentation(
+    const uview_1d<const Spack>& rho,
+    const uview_1d<const Spack>& inv_rho,
+    const uview_1d<const Spack>& inv_dz,
+    const MemberType& team,
+    const Int& nk, const Int& k_qxtop, const Int& kbot, const Int& kdir, const Scalar& dt, Scalar& prt_accum,
+    const view_1d_ptr_array<Spack, nfield>& fluxes,
+    const view_1d_ptr_array<Spack, nfield>& Vs, // (behaviorally const)
+    const view_1d_ptr_array<Spack, nfield>& rs);
+
   // Cloud sedimentation
   KOKKOS_FUNCTION
   static void cloud_sedimentation(
@@ -1119,7 +1168,8 @@ struct Functions
     const uview_1d<Spack>& prctot,
     bool& is_hydromet_present,
     const Int& nk,
-    const physics::P3_Constants<ScalarT> & p3constants);
+    const physics::P3_Constants<ScalarT> & p3constants,
+    const Int kp_top = 0); // packs above kp_top are known to need no work
 
 #ifdef SCREAM_SMALL_KERNELS
   static void p3_main_part2_disp(
@@ -1244,7 +1294,8 @@ struct Functions
     const uview_1d<Spack>& diag_equiv_reflectivity,
     const uview_1d<Spack>& diag_eff_radius_qc,
     const uview_1d<Spack>& diag_eff_radius_qr,
-    const physics::P3_Constants<ScalarT> & p3constants);
+    const physics::P3_Constants<ScalarT> & p3constants,
+    const Int kp_top = 0); // packs above kp_top are known to need no work
 
 #ifdef SCREAM_SMALL_KERNELS
   static void p3_main_part3_disp(
@@ -1319,6 +1370,18 @@ struct Functions
     Int nk, // number of vertical cells per column
     const physics::P3_Constants<ScalarT> & p3constants);
 
+  // Find the columns that need the full P3 pipeline, that is, the ones with some
+  // hydrometeor or where ice nucleation is possible (same criteria as p3_main_part1).
+  // On output, col_ids stores the active columns first, followed by the inactive ones.
+  // Returns the number of active columns.
+  static Int p3_main_compact_columns(
+    const P3PrognosticState& prognostic_state,
+    const P3DiagnosticInputs& diagnostic_inputs,
+    const view_1d<Int>& col_ids,
+    Int nj, // number of columns
+    Int nk, // number of vertical cells per column
+    const physics::P3_Constants<ScalarT> & p3constants);
+
 #ifdef SCREAM_SMALL_KERNELS
   static Int p3_main_internal_disp(
     const P3Runtime& runtime_options,
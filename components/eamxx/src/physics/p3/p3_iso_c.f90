@@ -40,7 +40,7 @@ contains
 
   end subroutine init_tables_from_f90_c
 
-  subroutine p3_init_c(lookup_file_dir_c, info, write_tables) bind(c)
+  subroutine p3_init_c(lookup_file_dir_c, info, write_tables, read_ice_tables) bind(c)
     use ekat_array_io_mod, only: array_io_file_exists
 #ifdef SCREAM_DOUBLE_PRECISION
     use ekat_array_io_mod, only: array_io_read=>array_io_read_double, array_io_write=>array_io_write_double
@@ -52,6 +52,7 @@ contains
     type(c_ptr), intent(in) :: lookup_file_dir_c
     integer(kind=c_int), intent(out) :: info
     logical(kind=c_bool), intent(in) :: write_tables
+    logical(kind=c_bool), intent(in) :: read_ice_tables
 
     real(kind=c_real), dimension(150), target :: mu_r_table_vals
     real(kind=c_real), dimension(300,10), target :: vn_table_vals, vm_table_vals, revap_table_vals
@@ -64,7 +65,10 @@ contains
 
     call c_f_pointer(lookup_file_dir_c, lookup_file_dir)
     len = index(lookup_file_dir, C_NULL_CHAR) - 1
-    call p3_init_a(lookup_file_dir(1:len),p3_version)
+    ! If the caller provides the ice tables (see p3_set_ice_tables_c), skip the ASCII read
+    if (read_ice_tables) then
+       call p3_init_a(lookup_file_dir(1:len),p3_version)
+    end if
 
     info = 0
     ok = .false.
@@ -217,6 +221,16 @@ contains
     collect_table_vals_c(:,:,:,:,:) = collect_table_vals(:,:,:,:,:)
   end subroutine p3_init_a_c
 
+  subroutine p3_set_ice_tables_c(ice_table_vals_c, collect_table_vals_c) bind(C)
+    use micro_p3, only: p3_set_ice_tables
+    use micro_p3_utils, only: densize,rimsize,isize,ice_table_size,rcollsize,collect_table_size
+
+    real(kind=c_real), intent(in), dimension(densize,rimsize,isize,ice_table_size) :: ice_table_vals_c
+    real(kind=c_real), intent(in), dimension(densize,rimsize,isize,rcollsize,collect_table_size) :: collect_table_vals_c
+
+    call p3_set_ice_tables(ice_table_vals_c, collect_table_vals_c)
+  end subroutine p3_set_ice_tables_c
+
   subroutine find_lookuptable_indices_1a_c(dumi,dumjj,dumii,dumzz,dum1,dum4,dum5,dum6,      &
        qi,ni,qm,rhop) bind(C)
     use micro_p3, only: find_lookupTable_indices_1a
@@ -1,8 +1,17 @@
-// This is a tiny program that calls p3_init() to generate tables used by p3
+// This is a tiny program that calls p3_init() to generate tables used by p3,
+// and converts the ASCII ice lookup table into the binary format read by
+// Functions::init_kokkos_ice_lookup_tables
 
 #include "physics/p3/p3_f90.hpp"
+#include "physics/p3/p3_functions.hpp"
 
 int main(int /* argc */, char** /* argv */) {
+  using P3F = scream::p3::Functions<scream::Real,scream::DefaultDevice>;
+
   scream::p3::p3_init(/* write_tables = */ true);
+
+  std::vector<double> ice_tables;
+  P3F::read_ice_lookup_tables_ascii(P3F::default_ice_lookup_table_file(false),ice_tables);
+  P3F::write_ice_lookup_tables_binary(P3F::default_ice_lookup_table_file(true),ice_tables);
   return 0;
 }
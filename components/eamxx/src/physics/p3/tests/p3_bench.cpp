@@ -0,0 +1,153 @@
+#include "share/scream_types.hpp"
+#include "share/scream_session.hpp"
+
+#include "p3_main_wrap.hpp"
+#include "p3_functions_f90.hpp"
+#include "p3_ic_cases.hpp"
+#include "physics_bench_utils.hpp"
+
+#include "ekat/util/ekat_test_utils.hpp"
+#include "ekat/ekat_assert.hpp"
+
+#include <vector>
+
+namespace {
+using namespace scream;
+using namespace scream::p3;
+namespace bench = scream::physics::bench;
+
+/*
+ * p3_bench times the C++ p3_main on the mixed IC (see ../p3_ic_cases.cpp)
+ * for every combination of the requested column and level counts. The IC
+ * only has hydrometeors in the bottom 20 levels, so the larger nlev cases
+ * also measure how well P3 skips hydrometeor-free levels.
+ *
+ * The pack size is a build-time setting; it is recorded in each result, so
+ * that runs from builds with different SCREAM_SMALL_PACK_SIZE can be
+ * compared. Each result reports the average time of one p3_main call (as
+ * measured by p3_main itself, i.e., without the host<->device transfers),
+ * the column throughput, and the effective bandwidth, computed from the
+ * size of the p3_main interface arrays, each read and written once.
+ *
+ * p3_sk_bench is the same exec built against p3_sk, where p3_main goes
+ * through the small kernels entry point (p3_main_internal_disp). Its cases
+ * have the same names, so the two implementations can be compared with
+ *   p3_bench -o fused.json && p3_sk_bench -b fused.json
+ */
+
+bench::Result run_case (const Int ncol, const Int nlev, const Int repeat, const Real dt) {
+  Int total_microsec = 0;
+  double bytes = 0;
+
+  // r=-1 is the "cold" run, which is not timed
+  for (Int r = -1; r < repeat; ++r) {
+    // Start every repetition from the IC, so that all of them do the same work
+    const auto d = ic::Factory::create(ic::Factory::mixed, ncol, nlev);
+    d->dt                = dt;
+    d->it                = 1;
+    d->do_predict_nc     = true;
+    d->do_prescribed_CCN = false;
+
+    const Int microsec = p3_main_wrap(*d, false);
+    if (r == -1) {
+      FortranDataIterator fdi(d);
+      for (Int i = 0, n = fdi.nfield(); i < n; ++i) {
+        bytes += 2.0*fdi.getfield(i).size*sizeof(Real);
+      }
+    } else {
+      total_microsec += microsec;
+    }
+  }
+
+  const double seconds = 1e-6*total_microsec / repeat;
+  const Int concurrency = Kokkos::DefaultExecutionSpace().concurrency();
+  return bench::make_result("p3_mixed", ncol, nlev, SCREAM_SMALL_PACK_SIZE,
+                            concurrency, repeat, seconds, bytes);
+}
+
+void expect_another_arg (int i, int argc) {
+  EKAT_REQUIRE_MSG(i != argc-1, "Expected another cmd-line arg.");
+}
+
+} // namespace anon
+
+int main (int argc, char** argv) {
+  if (argc > 1 && ekat::argv_matches(argv[1], "-h", "--help")) {
+    std::cout <<
+      argv[0] << " [options]\n"
+      "Options:\n"
+      "  -i <cols>           Comma-separated list of column counts. Default=1,16,256,4096.\n"
+      "  -k <nlev>           Comma-separated list of level counts. Default=72,128.\n"
+      "  -r <repeat>         Number of timed repetitions per case. Default=10.\n"
+      "  -dt <seconds>       Length of timestep. Default=300.\n"
+      "  -o <file>           Write results to this JSON file.\n"
+      "  -b <file>           Compare throughput with this JSON baseline file.\n"
+      "  -t <tol>            Relative throughput drop counted as a regression. Default=0.1.\n";
+    return 0;
+  }
+
+  std::vector<Int> ncols = {1, 16, 256, 4096};
+  std::vector<Int> nlevs = {72, 128};
+  Int repeat = 10;
+  Int dt = 300;
+  double tol = 0.1;
+  std::string json_fn, baseline_fn;
+  for (int i = 1; i < argc; ++i) {
+    if (ekat::argv_matches(argv[i], "-i", "--ncol")) {
+      expect_another_arg(i, argc);
+      ncols = bench::parse_int_list(argv[++i]);
+    }
+    if (ekat::argv_matches(argv[i], "-k", "--nlev")) {
+      expect_another_arg(i, argc);
+      nlevs = bench::parse_int_list(argv[++i]);
+    }
+    if (ekat::argv_matches(argv[i], "-r", "--repeat")) {
+      expect_another_arg(i, argc);
+      repeat = std::atoi(argv[++i]);
+      EKAT_REQUIRE_MSG(repeat > 0, "Repeat must be positive");
+    }
+    if (ekat::argv_matches(argv[i], "-dt", "--dt")) {
+      expect_another_arg(i, argc);
+      dt = std::atoi(argv[++i]);
+    }
+    if (ekat::argv_matches(argv[i], "-o", "--output")) {
+      expect_another_arg(i, argc);
+      json_fn = argv[++i];
+    }
+    if (ekat::argv_matches(argv[i], "-b", "--baseline-file")) {
+      expect_another_arg(i, argc);
+      baseline_fn = argv[++i];
+    }
+    if (ekat::argv_matches(argv[i], "-t", "--tol")) {
+      expect_another_arg(i, argc);
+      tol = std::atof(argv[++i]);
+    }
+  }
+
+  Int nregressions = 0;
+  scream::initialize_scream_session(argc, argv); {
+    p3_init();
+
+    std::cout << "P3 implementation: " << bench::implementation() << "\n";
+
+    std::vector<bench::Result> results;
+    for (const auto nlev : nlevs) {
+      for (const auto ncol : ncols) {
+        results.push_back(run_case(ncol, nlev, repeat, static_cast<Real>(dt)));
+        bench::print(results.back());
+      }
+    }
+
+    if (json_fn != "") {
+      bench::write_json(json_fn, results);
+    }
+    if (baseline_fn != "") {
+      std::cout << "Comparing with " << baseline_fn << " at tol " << tol << "\n";
+      nregressions = bench::compare(results, bench::read_json(baseline_fn), tol);
+    }
+
+    P3GlobalForFortran::deinit();
+  } scream::finalize_scream_session();
+
+  return nregressions != 0 ? 1 : 0;
+}
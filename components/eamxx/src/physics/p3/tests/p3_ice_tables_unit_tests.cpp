@@ -12,6 +12,8 @@
 #include <array>
 #include <algorithm>
 #include <random>
+#include <cstdio>
+#include <fstream>
 
 namespace scream {
 namespace p3 {
@@ -61,6 +63,43 @@ struct UnitWrap::UnitTest<D>::TestTableIce {
     }
   }
 
+  static void test_binary_lookup_tables()
+  {
+    // Convert the ASCII table to binary, and check both give the same tables
+    std::vector<double> table_data;
+    Functions::read_ice_lookup_tables_ascii(Functions::default_ice_lookup_table_file(false), table_data);
+    REQUIRE(table_data.size() == static_cast<size_t>(Functions::P3C::ice_table_nvals + Functions::P3C::collect_table_nvals));
+
+    const std::string bin_file = "p3_ice_tables_unit_test.bin";
+    Functions::write_ice_lookup_tables_binary(bin_file, table_data);
+
+    view_ice_table ice_ascii, ice_bin;
+    view_collect_table coll_ascii, coll_bin;
+    Functions::init_kokkos_ice_lookup_tables(ice_ascii, coll_ascii, Functions::default_ice_lookup_table_file(false));
+    Functions::init_kokkos_ice_lookup_tables(ice_bin, coll_bin, bin_file);
+
+    const auto ice_ascii_h  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), ice_ascii);
+    const auto ice_bin_h    = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), ice_bin);
+    const auto coll_ascii_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), coll_ascii);
+    const auto coll_bin_h   = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), coll_bin);
+    for (size_t i = 0; i < ice_ascii_h.size(); ++i) {
+      REQUIRE(ice_ascii_h.data()[i] == ice_bin_h.data()[i]);
+    }
+    for (size_t i = 0; i < coll_ascii_h.size(); ++i) {
+      REQUIRE(coll_ascii_h.data()[i] == coll_bin_h.data()[i]);
+    }
+
+    // A corrupted table must be detected by the checksum
+    table_data[table_data.size()/2] += 1;
+    {
+      std::fstream f(bin_file, std::ios::binary | std::ios::in | std::ios::out);
+      f.seekp(-static_cast<std::streamoff>(sizeof(double)*(table_data.size() - table_data.size()/2)), std::ios::end);
+      f.write(reinterpret_cast<const char*>(&table_data[table_data.size()/2]), sizeof(double));
+    }
+    REQUIRE_THROWS(Functions::init_kokkos_ice_lookup_tables(ice_bin, coll_bin, bin_file));
+    std::remove(bin_file.c_str());
+  }
+
   template <typename View>
   static void init_table_linear_dimension(View& table, int linear_dimension)
   {
@@ -346,6 +385,7 @@ TEST_CASE("p3_ice_tables", "[p3_functions]")
   using TTI = scream::p3::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestTableIce;
 
   TTI::test_read_lookup_tables_bfb();
+  TTI::test_binary_lookup_tables();
   TTI::run_phys();
   TTI::run_bfb();
 }
@@ -41,12 +41,64 @@ static void run_phys_p3_main()
   // TODO
 }
 
+static void run_phys_p3_main_compact_columns()
+{
+  // Warm, subsaturated columns: only the ones with hydrometeors are active
+  constexpr Int nj = 6;
+  constexpr Int nk = 9;
+  const Int nk_pack = ekat::npack<Spack>(nk);
+
+  view_2d<Spack> th("th", nj, nk_pack), qv("qv", nj, nk_pack), qc("qc", nj, nk_pack),
+                 qr("qr", nj, nk_pack), qi("qi", nj, nk_pack), pres("pres", nj, nk_pack),
+                 inv_exner("inv_exner", nj, nk_pack);
+  Kokkos::deep_copy(th, Spack(300));
+  Kokkos::deep_copy(qv, Spack(1e-3));
+  Kokkos::deep_copy(pres, Spack(1e5));
+  Kokkos::deep_copy(inv_exner, Spack(1));
+
+  const auto qc_h = Kokkos::create_mirror_view(qc);
+  const auto qr_h = Kokkos::create_mirror_view(qr);
+  const auto qi_h = Kokkos::create_mirror_view(qi);
+  Kokkos::deep_copy(qc_h, Spack(0));
+  Kokkos::deep_copy(qr_h, Spack(0));
+  Kokkos::deep_copy(qi_h, Spack(0));
+  qc_h(1, 3 / Spack::n)[3 % Spack::n] = 1e-4;       // cloud liquid: active
+  qr_h(2, 0)[0] = 1e-20;                            // below qsmall: inactive
+  qi_h(4, (nk-1) / Spack::n)[(nk-1) % Spack::n] = 1e-4; // ice: active
+  qi_h(5, 0)[0] = 1e-9;                             // small ice, subsaturated: inactive
+  Kokkos::deep_copy(qc, qc_h);
+  Kokkos::deep_copy(qr, qr_h);
+  Kokkos::deep_copy(qi, qi_h);
+
+  typename Functions::P3PrognosticState prog_state;
+  prog_state.th = th;
+  prog_state.qv = qv;
+  prog_state.qc = qc;
+  prog_state.qr = qr;
+  prog_state.qi = qi;
+  typename Functions::P3DiagnosticInputs diag_inputs;
+  diag_inputs.pres = pres;
+  diag_inputs.inv_exner = inv_exner;
+
+  view_1d<Int> col_ids("col_ids", nj);
+  const physics::P3_Constants<Real> p3constants;
+  const Int num_active = Functions::p3_main_compact_columns(prog_state, diag_inputs, col_ids, nj, nk, p3constants);
+  REQUIRE(num_active == 2);
+
+  const auto col_ids_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), col_ids);
+  const Int expected[nj] = {1, 4, 0, 2, 3, 5};
+  for (Int i = 0; i < nj; ++i) {
+    REQUIRE(col_ids_h(i) == expected[i]);
+  }
+}
+
 static void run_phys()
 {
   run_phys_p3_main_part1();
   run_phys_p3_main_part2();
   run_phys_p3_main_part3();
   run_phys_p3_main();
+  run_phys_p3_main_compact_columns();
 }
 
 static void run_bfb_p3_main_part1()
@@ -276,9 +276,222 @@ static void run_bfb()
 template <typename D>
 struct UnitWrap::UnitTest<D>::TestGenSed {
 
+// Sediment a profile with implicit_sedimentation using a time step far beyond
+// the explicit CFL limit. The scheme must conserve column mass (including what
+// falls out of the bottom), keep the mixing ratio nonnegative, and report the
+// outflow in prt_accum.
 static void run_phys()
 {
-  // TODO
+  using ekat::repack;
+  constexpr auto SPS = SCREAM_SMALL_PACK_SIZE;
+
+  const auto eps = std::numeric_limits<Scalar>::epsilon();
+
+  for (Int nk : {17, 72, 128}) {
+    const Int npack = (nk + Pack::n - 1) / Pack::n;
+    const Real max_speed = 4.2, min_dz = 0.33;
+    const Real dt = 50*min_dz/max_speed; // Courant number ~50
+
+    view_1d<Pack> rho("rho", npack), inv_rho("inv_rho", npack), inv_dz("inv_dz", npack),
+      flux("flux", npack), V("V", npack), r("r", npack);
+    const auto lrho = repack<SPS>(rho), linv_rho = repack<SPS>(inv_rho), linv_dz = repack<SPS>(inv_dz);
+    auto lflux = repack<SPS>(flux), lV = repack<SPS>(V), lr = repack<SPS>(r);
+
+    const auto init_fields = KOKKOS_LAMBDA (const MemberType& team) {
+      const auto set_fields = [&] (const Int& k) {
+        const auto range = ekat::range<Pack>(k*Pack::n);
+        rho(k) = 1 + range/nk;
+        inv_rho(k) = 1 / rho(k);
+        inv_dz(k) = 1 / (min_dz + range*range / (nk*nk));
+        V(k) = 0.5*(1 + range/nk) * max_speed;
+        r(k) = 0;
+        const auto mask = range >= 2 && range < nk-2;
+        r(k).set(mask, range/nk);
+      };
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(team, npack), set_fields);
+    };
+    Kokkos::parallel_for(ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(1, npack),
+                         init_fields);
+
+    const auto step = KOKKOS_LAMBDA (const MemberType& team, Int& nerr) {
+      const auto sr = scalarize(r), srho = scalarize(rho), sinv_dz = scalarize(inv_dz);
+      const auto column_mass = [&] () {
+        Scalar mass = 0;
+        Kokkos::parallel_reduce(Kokkos::TeamVectorRange(team, nk), [&] (const Int& k, Scalar& m) {
+          m += srho(k)*sr(k)/sinv_dz(k);
+        }, mass);
+        return mass;
+      };
+
+      const Scalar mass0 = column_mass();
+      team.team_barrier();
+
+      Scalar prt_accum = 0;
+      Functions::template implicit_sedimentation<1>(
+        lrho, linv_rho, linv_dz, team, nk, 0, nk-1, -1, dt, prt_accum,
+        {&lflux}, {&lV}, {&lr});
+
+      const Scalar mass1 = column_mass();
+      if (ekat::impl::rel_diff(mass0, mass1 + prt_accum) > 1e2*eps) ++nerr;
+      if (prt_accum <= 0) ++nerr;
+
+      Int nneg = 0;
+      Kokkos::parallel_reduce(Kokkos::TeamVectorRange(team, nk), [&] (const Int& k, Int& n) {
+        if (sr(k) < 0) ++n;
+      }, nneg);
+      nerr += nneg;
+    };
+    Int nerr = 0;
+    Kokkos::parallel_reduce(ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(1, npack),
+                            step, nerr);
+    Kokkos::fence();
+    REQUIRE(nerr == 0);
+  }
+}
+
+// In the small Courant number limit, implicit_sedimentation must agree with the
+// explicit generalized_sedimentation up to O(Co^2) terms. Also, since rain and ice
+// sedimentation only switch to the implicit scheme if Co_max>=1, turning on
+// p3_implicit_sedimentation must be BFB with the explicit scheme when Co_max<1.
+static void run_small_courant()
+{
+  using ekat::repack;
+  constexpr auto SPS = SCREAM_SMALL_PACK_SIZE;
+
+  const auto eps = std::numeric_limits<Scalar>::epsilon();
+
+  for (Int nk : {17, 72, 128}) {
+    const Int npack = (nk + Pack::n - 1) / Pack::n;
+    const Real max_speed = 4.2, min_dz = 0.33;
+    const Real dt = 1e-3*min_dz/max_speed; // Courant number ~1e-3
+
+    view_1d<Pack> rho("rho", npack), inv_rho("inv_rho", npack), inv_dz("inv_dz", npack), V("V", npack),
+      flux_exp("flux_exp", npack), r_exp("r_exp", npack), flux_imp("flux_imp", npack), r_imp("r_imp", npack);
+    const auto lrho = repack<SPS>(rho), linv_rho = repack<SPS>(inv_rho), linv_dz = repack<SPS>(inv_dz);
+    auto lV = repack<SPS>(V);
+    auto lflux_exp = repack<SPS>(flux_exp), lr_exp = repack<SPS>(r_exp);
+    auto lflux_imp = repack<SPS>(flux_imp), lr_imp = repack<SPS>(r_imp);
+
+    // Unlike run_phys, the bottom cells are not empty, so that some mass leaves the column
+    const auto init_fields = KOKKOS_LAMBDA (const MemberType& team) {
+      const auto set_fields = [&] (const Int& k) {
+        const auto range = ekat::range<Pack>(k*Pack::n);
+        rho(k) = 1 + range/nk;
+        inv_rho(k) = 1 / rho(k);
+        inv_dz(k) = 1 / (min_dz + range*range / (nk*nk));
+        V(k) = 0.5*(1 + range/nk) * max_speed;
+        r_exp(k) = 0;
+        const auto mask = range >= 2;
+        r_exp(k).set(mask, range/nk);
+        r_imp(k) = r_exp(k);
+      };
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(team, npack), set_fields);
+    };
+    Kokkos::parallel_for(ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(1, npack),
+                         init_fields);
+
+    const auto step = KOKKOS_LAMBDA (const MemberType& team, Int& nerr) {
+      const auto sV = scalarize(V), sinv_dz = scalarize(inv_dz);
+      const auto sr_exp = scalarize(r_exp), sr_imp = scalarize(r_imp);
+
+      Scalar Co_max = 0;
+      Kokkos::parallel_reduce(Kokkos::TeamVectorRange(team, nk), [&] (const Int& k, Scalar& lmax) {
+        const Scalar Co = sV(k)*dt*sinv_dz(k);
+        if (Co > lmax) lmax = Co;
+      }, Kokkos::Max<Scalar>(Co_max));
+      team.team_barrier();
+
+      Int k_qxbot = nk-1;
+      Scalar dt_left = dt, prt_exp = 0, prt_imp = 0;
+      Functions::template generalized_sedimentation<1>(
+        lrho, linv_rho, linv_dz, team, nk, 0, k_qxbot, nk-1, -1, Co_max, dt_left, prt_exp,
+        {&lflux_exp}, {&lV}, {&lr_exp});
+      Functions::template implicit_sedimentation<1>(
+        lrho, linv_rho, linv_dz, team, nk, 0, nk-1, -1, dt, prt_imp,
+        {&lflux_imp}, {&lV}, {&lr_imp});
+      team.team_barrier();
+
+      // The explicit scheme takes a single substep
+      if (dt_left != 0) ++nerr;
+      if (Co_max >= 1e-2) ++nerr;
+
+      // The two schemes only differ by O(Co^2) in the mixing ratio, and so by
+      // O(Co) relative to the (O(Co)) outflow
+      Int ndiff = 0;
+      Kokkos::parallel_reduce(Kokkos::TeamVectorRange(team, nk), [&] (const Int& k, Int& n) {
+        const Scalar diff = sr_exp(k) - sr_imp(k);
+        if (diff > 10*Co_max*Co_max + 10*eps || -diff > 10*Co_max*Co_max + 10*eps) ++n;
+      }, ndiff);
+      nerr += ndiff;
+      if (prt_exp <= 0) ++nerr;
+      if (ekat::impl::rel_diff(prt_exp, prt_imp) > 10*Co_max) ++nerr;
+    };
+    Int nerr = 0;
+    Kokkos::parallel_reduce(ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(1, npack),
+                            step, nerr);
+    Kokkos::fence();
+    REQUIRE(nerr == 0);
+  }
+
+  // Rain sedimentation with a time step small enough that Co_max<1
+  auto engine = setup_random_test();
+  constexpr Scalar dt = 2;
+  RainSedData rsd_exp(1, 72, 27, 72, -1, dt, 1/dt, 0.0);
+  rsd_exp.randomize(engine, { {rsd_exp.qr_incld, {C::QSMALL/2, C::QSMALL*2}},
+                              {rsd_exp.inv_dz,   {1e-3, 1e-2}} });
+  RainSedData rsd_imp(rsd_exp);
+
+  physics::P3_Constants<Real> explicit_constants, implicit_constants;
+  implicit_constants.p3_implicit_sedimentation = true;
+
+  const auto vn_table_vals = P3GlobalForFortran::vn_table_vals();
+  const auto vm_table_vals = P3GlobalForFortran::vm_table_vals();
+  for (auto* d : {&rsd_exp, &rsd_imp}) {
+    const auto& p3constants = d==&rsd_exp ? explicit_constants : implicit_constants;
+    const Int nk = d->nk(), ktop = d->ktop-1, kbot = d->kbot-1, kdir = d->kdir;
+    const Scalar inv_dt = d->inv_dt;
+
+    std::vector<view_1d<Spack>> temp_d(RainSedData::NUM_ARRAYS);
+    std::vector<size_t> sizes(RainSedData::NUM_ARRAYS, nk);
+    sizes[RainSedData::NUM_ARRAYS - 1] = nk+1;
+    ekat::host_to_device({d->qr_incld, d->rho, d->inv_rho, d->rhofacr, d->cld_frac_r, d->inv_dz,
+                          d->qr, d->nr, d->nr_incld, d->mu_r, d->lamr, d->qr_tend, d->nr_tend,
+                          d->precip_liq_flux}, sizes, temp_d);
+    view_1d<Spack>
+      qr_incld(temp_d[0]), rho(temp_d[1]), rinv_rho(temp_d[2]), rhofacr(temp_d[3]),
+      cld_frac_r(temp_d[4]), rinv_dz(temp_d[5]), qr(temp_d[6]), nr(temp_d[7]), nr_incld(temp_d[8]),
+      mu_r(temp_d[9]), lamr(temp_d[10]), qr_tend(temp_d[11]), nr_tend(temp_d[12]), precip_liq_flux(temp_d[13]);
+
+    auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(1, ekat::npack<Spack>(nk));
+    typename Functions::WorkspaceManager wsm(rho.extent(0), 4, policy);
+    Scalar precip_liq_surf = 0;
+    Kokkos::parallel_reduce(policy, KOKKOS_LAMBDA(const MemberType& team, Scalar& precip_liq_surf_k) {
+      Functions::rain_sedimentation(
+        rho, rinv_rho, rhofacr, cld_frac_r, rinv_dz, qr_incld,
+        team, wsm.get_workspace(team), vn_table_vals, vm_table_vals,
+        nk, ktop, kbot, kdir, dt, inv_dt,
+        qr, nr, nr_incld, mu_r, lamr, precip_liq_flux, qr_tend, nr_tend,
+        precip_liq_surf_k, p3constants);
+    }, precip_liq_surf);
+    d->precip_liq_surf += precip_liq_surf;
+
+    std::vector<size_t> sizes_out(8, nk);
+    sizes_out[7] = nk+1;
+    std::vector<view_1d<Spack>> inout_views = {qr, nr, nr_incld, mu_r, lamr, qr_tend, nr_tend, precip_liq_flux};
+    ekat::device_to_host({d->qr, d->nr, d->nr_incld, d->mu_r, d->lamr, d->qr_tend, d->nr_tend,
+                          d->precip_liq_flux}, sizes_out, inout_views);
+  }
+
+  // Check we actually sedimented something, and that the two runs are BFB
+  REQUIRE(rsd_exp.precip_liq_surf > 0);
+  for (Int k = 0; k < rsd_exp.nk(); ++k) {
+    REQUIRE(rsd_exp.qr[k]              == rsd_imp.qr[k]);
+    REQUIRE(rsd_exp.nr[k]              == rsd_imp.nr[k]);
+    REQUIRE(rsd_exp.precip_liq_flux[k] == rsd_imp.precip_liq_flux[k]);
+    REQUIRE(rsd_exp.qr_tend[k]         == rsd_imp.qr_tend[k]);
+    REQUIRE(rsd_exp.nr_tend[k]         == rsd_imp.nr_tend[k]);
+  }
+  REQUIRE(rsd_exp.precip_liq_surf == rsd_imp.precip_liq_surf);
 }
 
 static void run_bfb()
@@ -368,8 +581,13 @@ TEST_CASE("p3_gen_sed", "[p3_functions]")
 {
   using TG = scream::p3::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestGenSed;
 
+  scream::p3::p3_init(); // need fortran table data
+
   TG::run_phys();
+  TG::run_small_courant();
   TG::run_bfb();
+
+  scream::p3::P3GlobalForFortran::deinit();
 }
 
 } // namespace
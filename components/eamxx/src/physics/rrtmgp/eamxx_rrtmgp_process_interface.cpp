@@ -9,6 +9,9 @@
 #include "share/property_checks/field_within_interval_check.hpp"
 #include "share/util/scream_common_physics_functions.hpp"
 #include "share/util/scream_column_ops.hpp"
+#include "share/util/scream_utils.hpp"
+#include "share/grid/remap/coarsening_remapper.hpp"
+#include "share/grid/remap/refining_remapper_p2p.hpp"
 
 #include "ekat/ekat_assert.hpp"
 
@@ -17,6 +20,8 @@
 #include "YAKL.h"
 #endif
 
+#include <chrono>
+
 namespace scream {
 
 using KT = KokkosTypes<DefaultDevice>;
@@ -57,6 +62,20 @@ void RRTMGPRadiation::set_grids(const std::shared_ptr<const GridsManager> grids_
   m_ncol = m_grid->get_num_local_dofs();
   m_nlay = m_grid->get_num_vertical_levels();
 
+  // Optionally, compute radiation on a coarser grid, and map the results back
+  const auto coarsening_map_file = m_params.get<std::string>("coarsening_map_file","");
+  if (coarsening_map_file!="") {
+    EKAT_REQUIRE_MSG (not m_iop,
+        "Error! Coarse radiation (coarsening_map_file) is not supported in IOP runs.\n");
+    const auto refining_map_file = m_params.get<std::string>("refining_map_file","");
+    EKAT_REQUIRE_MSG (refining_map_file!="",
+        "Error! Coarse radiation requires both coarsening_map_file and refining_map_file.\n");
+    setup_coarse_rad_grid(coarsening_map_file,refining_map_file);
+  } else {
+    m_rad_grid = m_grid;
+  }
+  m_rad_ncol = m_rad_grid->get_num_local_dofs();
+
   if (m_iop) {
     // For IOP runs, we need to use the lat/lon from the
     // IOP files instead of the geometry data.
@@ -65,26 +84,55 @@ void RRTMGPRadiation::set_grids(const std::shared_ptr<const GridsManager> grids_
 
     m_lon = m_grid->get_geometry_data("lon").clone();
     m_lon.deep_copy(m_iop->get_params().get<Real>("target_longitude"));
-  } else {
+  } else if (m_coarsen==nullptr) {
     m_lat = m_grid->get_geometry_data("lat");
     m_lon = m_grid->get_geometry_data("lon");
   }
 
-  // Figure out radiation column chunks stats
-  m_col_chunk_size = std::min(m_params.get("column_chunk_size", m_ncol),m_ncol);
-  m_num_col_chunks = (m_ncol+m_col_chunk_size-1) / m_col_chunk_size;
-  m_col_chunk_beg.resize(m_num_col_chunks+1,0);
-  for (int i=0; i<m_num_col_chunks; ++i) {
-    m_col_chunk_beg[i+1] = std::min(m_ncol,m_col_chunk_beg[i] + m_col_chunk_size);
+  // Set up dimension layouts
+  m_nswgpts = m_params.get<int>("nswgpts",112);
+  m_nlwgpts = m_params.get<int>("nlwgpts",128);
+
+  // Figure out radiation column chunks stats. The chunk size is either given, or it is the
+  // largest one whose buffers and RRTMGP temporaries fit in a memory budget (in MB), which is
+  // given or computed as a fraction of the currently available (device) memory.
+  m_col_chunk_size = std::min(m_params.get("column_chunk_size", m_rad_ncol),m_rad_ncol);
+  auto mem_budget = m_params.get<double>("column_chunk_mem_budget",0);
+  const auto mem_fraction = m_params.get<double>("column_chunk_mem_fraction",0);
+  EKAT_REQUIRE_MSG (mem_budget>=0 && mem_fraction>=0 && mem_fraction<=1,
+      "Error! Invalid column_chunk_mem_budget/column_chunk_mem_fraction.\n"
+      "  - column_chunk_mem_budget: " + std::to_string(mem_budget) + " (must be >=0)\n"
+      "  - column_chunk_mem_fraction: " + std::to_string(mem_fraction) + " (must be in [0,1])\n");
+  if (mem_fraction>0) {
+    const auto avail = get_available_mem(MB);
+    EKAT_REQUIRE_MSG (avail>=0,
+        "Error! column_chunk_mem_fraction>0, but the available memory cannot be queried on this system.\n"
+        "  Please, use column_chunk_mem_budget instead.\n");
+    mem_budget = mem_budget>0 ? std::min(mem_budget,mem_fraction*avail) : mem_fraction*avail;
+  }
+  if (mem_budget>0) {
+    const double bytes_per_col = (buffer_reals_per_col() + temporary_reals_per_col())*sizeof(Real);
+    const int max_chunk = static_cast<int>(std::min(1e6*mem_budget/bytes_per_col,double(m_rad_ncol)));
+    EKAT_REQUIRE_MSG (max_chunk>0,
+        "Error! The RRTMGP memory budget is too small to fit a single column.\n"
+        "  - memory budget (MB): " + std::to_string(mem_budget) + "\n"
+        "  - bytes per column: " + std::to_string(bytes_per_col) + "\n");
+    m_col_chunk_size = max_chunk;
   }
+  set_col_chunks(m_col_chunk_size);
   this->log(LogLevel::debug,
             "[RRTMGP::set_grids] Col chunking stats:\n"
             "  - Chunk size: " + std::to_string(m_col_chunk_size) + "\n"
             "  - Number of chunks: " + std::to_string(m_num_col_chunks) + "\n");
 
-  // Set up dimension layouts
-  m_nswgpts = m_params.get<int>("nswgpts",112);
-  m_nlwgpts = m_params.get<int>("nlwgpts",128);
+  // Optionally, time some smaller chunk sizes on the first radiation steps. The first
+  // radiation step is a warmup, and is not timed.
+  if (m_params.get<bool>("column_chunk_tune",false)) {
+    m_col_chunk_candidates = {m_col_chunk_size, m_col_chunk_size};
+    for (int size=m_col_chunk_size/2; size>=m_col_chunk_size/8 && size>0; size /= 2) {
+      m_col_chunk_candidates.push_back(size);
+    }
+  }
   FieldLayout scalar2d = m_grid->get_2d_scalar_layout();
   FieldLayout scalar3d_mid = m_grid->get_3d_scalar_layout(true);
   FieldLayout scalar3d_int = m_grid->get_3d_scalar_layout(false);
@@ -241,21 +289,56 @@ void RRTMGPRadiation::set_grids(const std::shared_ptr<const GridsManager> grids_
       m_grid->set_geometry_data(bands);
     }
   }
+
+  // Between radiation steps, the outputs of the last radiation step are held
+  m_rad_freq_in_steps = m_params.get<Int>("rad_frequency", 1);
+  if (m_rad_freq_in_steps>1) {
+    set_computed_fields_persistent();
+  }
 }  // RRTMGPRadiation::set_grids
 
+void RRTMGPRadiation::set_col_chunks (const int chunk_size)
+{
+  EKAT_REQUIRE_MSG (chunk_size>0 && chunk_size<=m_col_chunk_size,
+      "Error! Invalid RRTMGP column chunk size: " + std::to_string(chunk_size) + "\n");
+  m_num_col_chunks = (m_rad_ncol+chunk_size-1) / chunk_size;
+  m_col_chunk_beg.assign(m_num_col_chunks+1,0);
+  for (int i=0; i<m_num_col_chunks; ++i) {
+    m_col_chunk_beg[i+1] = std::min(m_rad_ncol,m_col_chunk_beg[i] + chunk_size);
+  }
+}
+
+size_t RRTMGPRadiation::buffer_reals_per_col() const
+{
+  return
+    Buffer::num_1d_ncol +
+    Buffer::num_2d_nlay*m_nlay +
+    Buffer::num_2d_nlay_p1*(m_nlay+1) +
+    Buffer::num_2d_nswbands*m_nswbands +
+    Buffer::num_3d_nlev_nswbands*(m_nlay+1)*m_nswbands +
+    Buffer::num_3d_nlev_nlwbands*(m_nlay+1)*m_nlwbands +
+    Buffer::num_3d_nlay_nswbands*(m_nlay)*m_nswbands +
+    Buffer::num_3d_nlay_nlwbands*(m_nlay)*m_nlwbands +
+    Buffer::num_3d_nlay_nswgpts*(m_nlay)*m_nswgpts +
+    Buffer::num_3d_nlay_nlwgpts*(m_nlay)*m_nlwgpts;
+}
+
+size_t RRTMGPRadiation::temporary_reals_per_col() const
+{
+  // Inside rrtmgp_main, the largest allocations are (ncol,nlev,ngpt) arrays: gas and
+  // cloud optical properties, sources, gpoint fluxes, and the solvers' work arrays.
+  // SW and LW do not overlap in time, so only the largest of the two matters. The
+  // count below is a (generous) upper bound; the GasConcs arrays are sized by the
+  // chunk as well.
+  constexpr int num_3d_nlev_ngpts = 16;
+  const int ngpts = std::max(m_nswgpts,m_nlwgpts);
+  const size_t gas_concs = m_ngas*m_nlay;
+  return num_3d_nlev_ngpts*(m_nlay+1)*ngpts + 2*gas_concs;
+}
+
 size_t RRTMGPRadiation::requested_buffer_size_in_bytes() const
 {
-  const size_t interface_request =
-    Buffer::num_1d_ncol*m_col_chunk_size +
-    Buffer::num_2d_nlay*m_col_chunk_size*m_nlay +
-    Buffer::num_2d_nlay_p1*m_col_chunk_size*(m_nlay+1) +
-    Buffer::num_2d_nswbands*m_col_chunk_size*m_nswbands +
-    Buffer::num_3d_nlev_nswbands*m_col_chunk_size*(m_nlay+1)*m_nswbands +
-    Buffer::num_3d_nlev_nlwbands*m_col_chunk_size*(m_nlay+1)*m_nlwbands +
-    Buffer::num_3d_nlay_nswbands*m_col_chunk_size*(m_nlay)*m_nswbands +
-    Buffer::num_3d_nlay_nlwbands*m_col_chunk_size*(m_nlay)*m_nlwbands +
-    Buffer::num_3d_nlay_nswgpts*m_col_chunk_size*(m_nlay)*m_nswgpts +
-    Buffer::num_3d_nlay_nlwgpts*m_col_chunk_size*(m_nlay)*m_nlwgpts;
+  const size_t interface_request = buffer_reals_per_col()*m_col_chunk_size;
 
   return interface_request * sizeof(Real);
 } // RRTMGPRadiation::requested_buffer_size
@@ -564,8 +647,7 @@ void RRTMGPRadiation::init_buffers(const ATMBufferManager &buffer_manager)
 void RRTMGPRadiation::initialize_impl(const RunType /* run_type */) {
   using PC = scream::physics::Constants<Real>;
 
-  // Determine rad timestep, specified as number of atm steps
-  m_rad_freq_in_steps = m_params.get<Int>("rad_frequency", 1);
+  // Note: the rad timestep (m_rad_freq_in_steps, in atm steps) is set in set_grids
 
   // Determine orbital year. If orbital_year is negative, use current year
   // from timestamp for orbital year; if positive, use provided orbital year
@@ -590,6 +672,8 @@ void RRTMGPRadiation::initialize_impl(const RunType /* run_type */) {
 
   // Whether or not to do MCICA subcolumn sampling
   m_do_subcol_sampling = m_params.get<bool>("do_subcol_sampling",true);
+  // Whether to generate the MCICA subcolumns with the counter-based, bit-packed generator
+  const bool counter_based_subcol_gen = m_params.get<bool>("counter_based_subcol_gen",false);
 
   // Initialize yakl
   init_kls();
@@ -621,6 +705,7 @@ void RRTMGPRadiation::initialize_impl(const RunType /* run_type */) {
           cloud_optics_file_sw, cloud_optics_file_lw,
           m_atm_logger
   );
+  rrtmgp::counter_based_subcol_gen = counter_based_subcol_gen;
 #endif
 #ifdef RRTMGP_ENABLE_KOKKOS
   m_gas_concs_k.init(gas_names_yakl_offset,m_col_chunk_size,m_nlay);
@@ -630,6 +715,7 @@ void RRTMGPRadiation::initialize_impl(const RunType /* run_type */) {
           cloud_optics_file_sw, cloud_optics_file_lw,
           m_atm_logger
   );
+  interface_t::counter_based_subcol_gen_k = counter_based_subcol_gen;
   VALIDATE_KOKKOS(m_gas_concs, m_gas_concs_k);
   VALIDATE_KOKKOS(rrtmgp::k_dist_sw, interface_t::k_dist_sw_k);
   VALIDATE_KOKKOS(rrtmgp::k_dist_lw, interface_t::k_dist_lw_k);
@@ -640,15 +726,365 @@ void RRTMGPRadiation::initialize_impl(const RunType /* run_type */) {
   // Set property checks for fields in this process
   add_invariant_check<FieldWithinIntervalCheck>(get_field_out("T_mid"),m_grid,100.0, 500.0,false);
 
+  // Whether to rescale SW fluxes and heating (with the current cosine zenith angle) and set the
+  // surface upward LW flux (from the current surface state) at steps between radiation steps
+  m_rad_incremental_update = m_params.get<bool>("rad_incremental_update",false);
+  m_have_rad_state = false;
+  if (m_rad_incremental_update) {
+    const auto& heating_fid = get_field_out("rad_heating_pdel").get_header().get_identifier();
+    using namespace ekat::units;
+    m_sw_heating = Field(FieldIdentifier("sw_heating",heating_fid.get_layout(),K/s,m_grid->name()));
+    m_sw_heating.allocate_view();
+    m_cosz_step = real1dk("cosz_step",m_ncol);
+    m_cosz_rad  = real1dk("cosz_rad",m_ncol);
+    m_rad_heating_pdel_rad = real2dk("rad_heating_pdel_rad",m_ncol,m_nlay);
+    m_sw_heating_pdel_rad  = real2dk("sw_heating_pdel_rad",m_ncol,m_nlay);
+    m_sw_flux_dn_rad       = real2dk("sw_flux_dn_rad",m_ncol,m_nlay+1);
+    m_sw_flux_up_rad       = real2dk("sw_flux_up_rad",m_ncol,m_nlay+1);
+    m_sw_flux_dn_dir_rad   = real2dk("sw_flux_dn_dir_rad",m_ncol,m_nlay+1);
+    m_sfc_sw_fluxes_rad    = real2dk("sfc_sw_fluxes_rad",m_ncol,5);
+    m_sfc_lw_fluxes_rad    = real2dk("sfc_lw_fluxes_rad",m_ncol,2);
+  }
+
+  if (m_coarsen) {
+    init_coarse_rad_fields();
+  }
+
   // VMR of n2 and co is currently prescribed as a constant value, read from file
   if (has_computed_field("n2_volume_mix_ratio",m_grid->name())) {
     auto n2_vmr = get_field_out("n2_volume_mix_ratio").get_view<Real**>();
     Kokkos::deep_copy(n2_vmr, m_params.get<double>("n2vmr", 0.7906));
+    if (m_coarsen) {
+      m_coarse_fields.at("n2_volume_mix_ratio").deep_copy(m_params.get<double>("n2vmr", 0.7906));
+    }
   }
   if (has_computed_field("co_volume_mix_ratio",m_grid->name())) {
     auto co_vmr = get_field_out("co_volume_mix_ratio").get_view<Real**>();
     Kokkos::deep_copy(co_vmr, m_params.get<double>("covmr", 1.0e-7));
+    if (m_coarsen) {
+      m_coarse_fields.at("co_volume_mix_ratio").deep_copy(m_params.get<double>("covmr", 1.0e-7));
+    }
+  }
+}
+
+// =========================================================================================
+
+void RRTMGPRadiation::
+setup_coarse_rad_grid (const std::string& coarsening_map_file,
+                       const std::string& refining_map_file)
+{
+  auto refine = std::make_shared<RefiningRemapperP2P>(m_grid,refining_map_file);
+  EKAT_REQUIRE_MSG (refine->is_injection(),
+      "Error! The RRTMGP refining map must be a piecewise constant injection, that is,\n"
+      "  each row must have exactly one entry, with weight 1. Otherwise, the refined\n"
+      "  heating rates and fluxes do not conserve energy.\n"
+      "  - refining map: " + refining_map_file + "\n");
+  m_coarsen = std::make_shared<CoarseningRemapper>(m_grid,coarsening_map_file);
+  m_refine  = refine;
+  m_rad_grid = m_coarsen->get_tgt_grid();
+
+  // Coarse fields are used as src of m_refine, so the two maps must yield the same coarse dofs
+  // on each rank, which is the case if the refining map is the "transpose" of the coarsening one
+  const auto& refine_grid = m_refine->get_src_grid();
+  auto gids = m_rad_grid->get_dofs_gids().get_view<const AbstractGrid::gid_type*,Host>();
+  auto refine_gids = refine_grid->get_dofs_gids().get_view<const AbstractGrid::gid_type*,Host>();
+  bool same_gids = gids.size()==refine_gids.size();
+  for (size_t i=0; same_gids && i<gids.size(); ++i) {
+    same_gids = gids[i]==refine_gids[i];
+  }
+  EKAT_REQUIRE_MSG (same_gids,
+      "Error! The coarse grids of the RRTMGP coarsening and refining maps are not compatible.\n"
+      "  The refining map must map each physics column from the same coarse columns that the\n"
+      "  coarsening map maps it to.\n"
+      "  - coarsening map: " + coarsening_map_file + "\n"
+      "  - refining map: " + refining_map_file + "\n");
+
+  // Averaging lat/lon directly is wrong for coarse columns straddling the
+  // lon=0 meridian, so average the unit vector of each column instead
+  using PC = scream::physics::Constants<Real>;
+  const auto& lat = m_grid->get_geometry_data("lat");
+  const auto& lon = m_grid->get_geometry_data("lon");
+  const auto& fine_layout = lat.get_header().get_identifier().get_layout();
+  const auto coarse_layout = m_coarsen->create_tgt_layout(fine_layout);
+  auto coord_remap = std::make_shared<CoarseningRemapper>(m_grid,coarsening_map_file,false,false);
+  std::vector<Field> fine_xyz, coarse_xyz;
+  coord_remap->registration_begins();
+  for (const std::string c : {"x","y","z"}) {
+    Field ff(FieldIdentifier("coord_"+c,fine_layout,ekat::units::Units::nondimensional(),m_grid->name()));
+    Field cf(FieldIdentifier("coord_"+c,coarse_layout,ekat::units::Units::nondimensional(),m_rad_grid->name()));
+    ff.allocate_view();
+    cf.allocate_view();
+    fine_xyz.push_back(ff);
+    coarse_xyz.push_back(cf);
+  }
+  auto h_lat = lat.get_view<const Real*,Host>();
+  auto h_lon = lon.get_view<const Real*,Host>();
+  const Real deg2rad = PC::Pi / 180;
+  auto h_x = fine_xyz[0].get_view<Real*,Host>();
+  auto h_y = fine_xyz[1].get_view<Real*,Host>();
+  auto h_z = fine_xyz[2].get_view<Real*,Host>();
+  for (int i=0; i<m_ncol; ++i) {
+    h_x(i) = std::cos(h_lat(i)*deg2rad)*std::cos(h_lon(i)*deg2rad);
+    h_y(i) = std::cos(h_lat(i)*deg2rad)*std::sin(h_lon(i)*deg2rad);
+    h_z(i) = std::sin(h_lat(i)*deg2rad);
+  }
+  for (int c=0; c<3; ++c) {
+    fine_xyz[c].sync_to_dev();
+    coord_remap->register_field(fine_xyz[c],coarse_xyz[c]);
+  }
+  coord_remap->registration_ends();
+  coord_remap->remap(true);
+
+  m_lat = Field(FieldIdentifier("lat",coarse_layout,lat.get_header().get_identifier().get_units(),m_rad_grid->name()));
+  m_lon = Field(FieldIdentifier("lon",coarse_layout,lon.get_header().get_identifier().get_units(),m_rad_grid->name()));
+  m_lat.allocate_view();
+  m_lon.allocate_view();
+  for (auto& f : coarse_xyz) {
+    f.sync_to_host();
+  }
+  auto x = coarse_xyz[0].get_view<const Real*,Host>();
+  auto y = coarse_xyz[1].get_view<const Real*,Host>();
+  auto z = coarse_xyz[2].get_view<const Real*,Host>();
+  auto h_clat = m_lat.get_view<Real*,Host>();
+  auto h_clon = m_lon.get_view<Real*,Host>();
+  for (int i=0; i<m_rad_grid->get_num_local_dofs(); ++i) {
+    const Real r = std::sqrt(x(i)*x(i) + y(i)*y(i) + z(i)*z(i));
+    h_clat(i) = std::asin(z(i)/r) / deg2rad;
+    h_clon(i) = std::atan2(y(i),x(i)) / deg2rad;
+    if (h_clon(i)<0) {
+      h_clon(i) += 360;
+    }
+  }
+  m_lat.sync_to_dev();
+  m_lon.sync_to_dev();
+
+  this->log(LogLevel::info,
+            "[RRTMGP::set_grids] Radiation is computed on a coarse grid:\n"
+            "  - physics grid cols: " + std::to_string(m_grid->get_num_global_dofs()) + "\n"
+            "  - radiation grid cols: " + std::to_string(m_rad_grid->get_num_global_dofs()) + "\n");
+}
+
+void RRTMGPRadiation::init_coarse_rad_fields ()
+{
+  // Inputs, coarsened before each radiation call
+  std::vector<std::string> fields_in = {
+    "p_mid", "p_int", "pseudo_density", "T_mid", "qv", "qc", "nc", "qi",
+    "cldfrac_tot", "eff_radius_qc", "eff_radius_qi", "surf_lw_flux_up",
+    "sfc_alb_dir_vis", "sfc_alb_dir_nir", "sfc_alb_dif_vis", "sfc_alb_dif_nir"
+  };
+  if (m_do_aerosol_rad) {
+    for (const std::string name : {"aero_tau_sw","aero_ssa_sw","aero_g_sw","aero_tau_lw"}) {
+      fields_in.push_back(name);
+    }
+  }
+  // Outputs, refined after each radiation call. Note: rad_heating_pdel holds the heating
+  // rate (not scaled by pdel) at this point, so that its refinement conserves energy
+  std::vector<std::string> fields_out = {
+    "SW_flux_dn", "SW_flux_up", "SW_flux_dn_dir", "LW_flux_up", "LW_flux_dn",
+    "SW_clnclrsky_flux_dn", "SW_clnclrsky_flux_up", "SW_clnclrsky_flux_dn_dir",
+    "SW_clrsky_flux_dn", "SW_clrsky_flux_up", "SW_clrsky_flux_dn_dir",
+    "SW_clnsky_flux_dn", "SW_clnsky_flux_up", "SW_clnsky_flux_dn_dir",
+    "LW_clnclrsky_flux_up", "LW_clnclrsky_flux_dn", "LW_clrsky_flux_up",
+    "LW_clrsky_flux_dn", "LW_clnsky_flux_up", "LW_clnsky_flux_dn",
+    "rad_heating_pdel", "cldlow", "cldmed", "cldhgh", "cldtot",
+    "dtau067", "dtau105", "sunlit", "cldfrac_rad",
+    "T_mid_at_cldtop", "p_mid_at_cldtop", "cldfrac_ice_at_cldtop", "cldfrac_liq_at_cldtop",
+    "cldfrac_tot_at_cldtop", "cdnc_at_cldtop", "eff_radius_qc_at_cldtop", "eff_radius_qi_at_cldtop",
+    "sfc_flux_dir_nir", "sfc_flux_dir_vis", "sfc_flux_dif_nir", "sfc_flux_dif_vis",
+    "sfc_flux_sw_net", "sfc_flux_lw_dn"
+  };
+  for (const auto& gas : m_gas_names) {
+    auto& names = gas=="o3" ? fields_in : fields_out;
+    names.push_back(gas + "_volume_mix_ratio");
+  }
+
+  auto create_coarse_field = [&](const Field& f) {
+    const auto& fid = f.get_header().get_identifier();
+    FieldIdentifier cfid(fid.name(),m_coarsen->create_tgt_layout(fid.get_layout()),
+                         fid.get_units(),m_rad_grid->name());
+    Field cf(cfid);
+    cf.allocate_view();
+    m_coarse_fields[fid.name()] = cf;
+    return cf;
+  };
+
+  m_coarsen->registration_begins();
+  for (const auto& name : fields_in) {
+    const auto& f = name=="T_mid" ? get_field_out(name) : get_field_in(name);
+    m_coarsen->register_field(f,create_coarse_field(f));
+  }
+  m_coarsen->registration_ends();
+
+  m_refine->registration_begins();
+  for (const auto& name : fields_out) {
+    const auto& f = get_field_out(name);
+    m_refine->register_field(create_coarse_field(f),f);
+  }
+  if (m_rad_incremental_update) {
+    m_refine->register_field(create_coarse_field(m_sw_heating),m_sw_heating);
+  }
+  // The coarse surface upward LW flux, used to downscale the bottom LW_flux_up
+  const auto& surf_lw_fid = get_field_in("surf_lw_flux_up").get_header().get_identifier();
+  m_rad_surf_lw_flux_up = Field(FieldIdentifier("surf_lw_flux_up_rad",surf_lw_fid.get_layout(),
+                                                surf_lw_fid.get_units(),m_grid->name()));
+  m_rad_surf_lw_flux_up.allocate_view();
+  m_refine->register_field(m_coarse_fields.at("surf_lw_flux_up"),m_rad_surf_lw_flux_up);
+  m_refine->registration_ends();
+}
+
+void RRTMGPRadiation::downscale_rad_outputs ()
+{
+  // The refining map copies the coarse values to the physics columns. The heating rate
+  // is then the same in all physics columns of a coarse column, so the column integrated
+  // heating is conserved (the coarse pdel being the area average of the physics ones).
+  // At the surface, the downwelling fluxes are kept, but the upwelling ones are computed
+  // from the local albedo and surface upwelling LW flux. With area-averaged albedos, this
+  // also conserves the SW flux absorbed at the surface. The LW one is shifted by the local
+  // anomaly of surf_lw_flux_up, which conserves the coarse flux (the RRTMGP surface emission
+  // is not exactly surf_lw_flux_up, so we cannot simply replace it).
+  auto d_alb_dir_vis = get_field_in("sfc_alb_dir_vis").get_view<const Real*>();
+  auto d_alb_dir_nir = get_field_in("sfc_alb_dir_nir").get_view<const Real*>();
+  auto d_alb_dif_vis = get_field_in("sfc_alb_dif_vis").get_view<const Real*>();
+  auto d_alb_dif_nir = get_field_in("sfc_alb_dif_nir").get_view<const Real*>();
+  auto d_surf_lw_flux_up = get_field_in("surf_lw_flux_up").get_view<const Real*>();
+  auto d_rad_surf_lw_flux_up = m_rad_surf_lw_flux_up.get_view<const Real*>();
+  auto d_dir_vis = get_field_out("sfc_flux_dir_vis").get_view<const Real*>();
+  auto d_dir_nir = get_field_out("sfc_flux_dir_nir").get_view<const Real*>();
+  auto d_dif_vis = get_field_out("sfc_flux_dif_vis").get_view<const Real*>();
+  auto d_dif_nir = get_field_out("sfc_flux_dif_nir").get_view<const Real*>();
+  auto d_sfc_flux_sw_net = get_field_out("sfc_flux_sw_net").get_view<Real*>();
+  auto d_sw_flux_up = get_field_out("SW_flux_up").get_view<Real**>();
+  auto d_sw_flux_dn = get_field_out("SW_flux_dn").get_view<const Real**>();
+  auto d_lw_flux_up = get_field_out("LW_flux_up").get_view<Real**>();
+
+  const int kbot = m_nlay;
+  Kokkos::parallel_for(KT::RangePolicy(0,m_ncol), KOKKOS_LAMBDA(const int icol) {
+    const Real sw_absorbed = d_dir_vis(icol)*(1-d_alb_dir_vis(icol))
+                           + d_dir_nir(icol)*(1-d_alb_dir_nir(icol))
+                           + d_dif_vis(icol)*(1-d_alb_dif_vis(icol))
+                           + d_dif_nir(icol)*(1-d_alb_dif_nir(icol));
+    d_sfc_flux_sw_net(icol) = sw_absorbed;
+    d_sw_flux_up(icol,kbot) = d_sw_flux_dn(icol,kbot) - sw_absorbed;
+    d_lw_flux_up(icol,kbot) += d_surf_lw_flux_up(icol) - d_rad_surf_lw_flux_up(icol);
+  });
+}
+
+// =========================================================================================
+
+void RRTMGPRadiation::
+update_rad_incrementally (const bool update_rad, const double dt,
+                          const double calday, const double delta)
+{
+  using PC = scream::physics::Constants<Real>;
+
+  // Cosine of the zenith angle averaged over the radiation interval (at radiation steps, which
+  // is what the radiation call used), or over this step (at the other steps)
+  const auto& lat = m_coarsen ? m_grid->get_geometry_data("lat") : m_lat;
+  const auto& lon = m_coarsen ? m_grid->get_geometry_data("lon") : m_lon;
+  auto h_lat = lat.get_view<const Real*,Host>();
+  auto h_lon = lon.get_view<const Real*,Host>();
+  auto compute_cosz = [&](const real1dk& cosz, const double dt_avg) {
+    auto h_cosz = Kokkos::create_mirror_view(cosz);
+    for (int i=0; i<m_ncol; ++i) {
+      if (m_fixed_solar_zenith_angle > 0) {
+        h_cosz(i) = m_fixed_solar_zenith_angle;
+      } else {
+        const double lat_rad = h_lat(i)*PC::Pi/180.0;
+        const double lon_rad = h_lon(i)*PC::Pi/180.0;
+        h_cosz(i) = shr_orb_cosz_c2f(calday, lat_rad, lon_rad, delta, dt_avg);
+      }
+    }
+    Kokkos::deep_copy(cosz,h_cosz);
+  };
+
+  auto d_pdel = get_field_in("pseudo_density").get_view<const Real**>();
+  auto d_surf_lw_flux_up = get_field_in("surf_lw_flux_up").get_view<const Real*>();
+  auto d_rad_heating = get_field_out("rad_heating_pdel").get_view<Real**>();
+  auto d_sw_heating = m_sw_heating.get_view<const Real**>();
+  auto d_sw_flux_dn = get_field_out("SW_flux_dn").get_view<Real**>();
+  auto d_sw_flux_up = get_field_out("SW_flux_up").get_view<Real**>();
+  auto d_sw_flux_dn_dir = get_field_out("SW_flux_dn_dir").get_view<Real**>();
+  auto d_lw_flux_up = get_field_out("LW_flux_up").get_view<Real**>();
+  auto d_sfc_dir_vis = get_field_out("sfc_flux_dir_vis").get_view<Real*>();
+  auto d_sfc_dir_nir = get_field_out("sfc_flux_dir_nir").get_view<Real*>();
+  auto d_sfc_dif_vis = get_field_out("sfc_flux_dif_vis").get_view<Real*>();
+  auto d_sfc_dif_nir = get_field_out("sfc_flux_dif_nir").get_view<Real*>();
+  auto d_sfc_sw_net  = get_field_out("sfc_flux_sw_net").get_view<Real*>();
+
+  auto cosz_step = m_cosz_step;
+  auto cosz_rad = m_cosz_rad;
+  auto rad_heating_pdel_rad = m_rad_heating_pdel_rad;
+  auto sw_heating_pdel_rad = m_sw_heating_pdel_rad;
+  auto sw_flux_dn_rad = m_sw_flux_dn_rad;
+  auto sw_flux_up_rad = m_sw_flux_up_rad;
+  auto sw_flux_dn_dir_rad = m_sw_flux_dn_dir_rad;
+  auto sfc_sw_fluxes_rad = m_sfc_sw_fluxes_rad;
+  auto sfc_lw_fluxes_rad = m_sfc_lw_fluxes_rad;
+  const int nlay = m_nlay;
+  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(m_ncol, m_nlay);
+
+  if (update_rad) {
+    // Save the radiation step fluxes and heating (which is still a heating rate at this point)
+    compute_cosz(m_cosz_rad,m_rad_freq_in_steps*dt);
+    Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+      const int i = team.league_rank();
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay+1), [&] (const int& k) {
+        sw_flux_dn_rad(i,k)     = d_sw_flux_dn(i,k);
+        sw_flux_up_rad(i,k)     = d_sw_flux_up(i,k);
+        sw_flux_dn_dir_rad(i,k) = d_sw_flux_dn_dir(i,k);
+        if (k<nlay) {
+          rad_heating_pdel_rad(i,k) = d_pdel(i,k)*d_rad_heating(i,k);
+          sw_heating_pdel_rad(i,k)  = d_pdel(i,k)*d_sw_heating(i,k);
+        }
+      });
+      Kokkos::single(Kokkos::PerTeam(team), [&] {
+        sfc_sw_fluxes_rad(i,0) = d_sfc_dir_vis(i);
+        sfc_sw_fluxes_rad(i,1) = d_sfc_dir_nir(i);
+        sfc_sw_fluxes_rad(i,2) = d_sfc_dif_vis(i);
+        sfc_sw_fluxes_rad(i,3) = d_sfc_dif_nir(i);
+        sfc_sw_fluxes_rad(i,4) = d_sfc_sw_net(i);
+        sfc_lw_fluxes_rad(i,0) = d_lw_flux_up(i,nlay);
+        sfc_lw_fluxes_rad(i,1) = d_surf_lw_flux_up(i);
+      });
+    });
+    m_have_rad_state = true;
+
+    // The fluxes and heating of a radiation step are used as they are
+    return;
   }
+
+  // SW fluxes scale with the insolation, i.e. with cosz. Since cosz_rad is the average over the
+  // radiation interval, the SW energy input over the interval is (approximately) unchanged.
+  // The change of the surface LW emission since the radiation step is added to the bottom
+  // LW_flux_up, and assumed to be absorbed in the bottom layer (which keeps the LW fluxes
+  // consistent with the LW heating, and the LW fluxes at the other interfaces unchanged).
+  compute_cosz(m_cosz_step,dt);
+  const int kbot = nlay-1;
+  Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+    const int i = team.league_rank();
+    const Real f = (cosz_rad(i)>0 and cosz_step(i)>0) ? cosz_step(i)/cosz_rad(i) : 0;
+    const Real lw_delta = d_surf_lw_flux_up(i) - sfc_lw_fluxes_rad(i,1);
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay+1), [&] (const int& k) {
+      d_sw_flux_dn(i,k)     = f*sw_flux_dn_rad(i,k);
+      d_sw_flux_up(i,k)     = f*sw_flux_up_rad(i,k);
+      d_sw_flux_dn_dir(i,k) = f*sw_flux_dn_dir_rad(i,k);
+      if (k<nlay) {
+        Real heating_pdel = rad_heating_pdel_rad(i,k) + (f-1)*sw_heating_pdel_rad(i,k);
+        if (k==kbot) {
+          heating_pdel += lw_delta*PC::gravit/PC::Cpair;
+        }
+        d_rad_heating(i,k) = heating_pdel / d_pdel(i,k);
+      }
+    });
+    Kokkos::single(Kokkos::PerTeam(team), [&] {
+      d_sfc_dir_vis(i) = f*sfc_sw_fluxes_rad(i,0);
+      d_sfc_dir_nir(i) = f*sfc_sw_fluxes_rad(i,1);
+      d_sfc_dif_vis(i) = f*sfc_sw_fluxes_rad(i,2);
+      d_sfc_dif_nir(i) = f*sfc_sw_fluxes_rad(i,3);
+      d_sfc_sw_net(i)  = f*sfc_sw_fluxes_rad(i,4);
+      d_lw_flux_up(i,nlay) = sfc_lw_fluxes_rad(i,0) + lw_delta;
+    });
+  });
 }
 
 // =========================================================================================
@@ -658,29 +1094,41 @@ void RRTMGPRadiation::run_impl (const double dt) {
   using PC = scream::physics::Constants<Real>;
   using CO = scream::ColumnOps<DefaultDevice,Real>;
 
+  // With coarse radiation, the radiation code works on the coarse copies of the fields
+  const bool coarse_rad = m_coarsen!=nullptr;
+  auto get_rad_field_in = [&](const std::string& name) -> Field {
+    return coarse_rad ? m_coarse_fields.at(name) : get_field_in(name);
+  };
+  auto get_rad_field_out = [&](const std::string& name) -> Field {
+    if (name=="sw_heating") {
+      return coarse_rad ? m_coarse_fields.at(name) : m_sw_heating;
+    }
+    return coarse_rad ? m_coarse_fields.at(name) : get_field_out(name);
+  };
+
   // get a host copy of lat/lon
   auto h_lat  = m_lat.get_view<const Real*,Host>();
   auto h_lon  = m_lon.get_view<const Real*,Host>();
 
   // Get data from the FieldManager
-  auto d_pmid = get_field_in("p_mid").get_view<const Real**>();
-  auto d_pint = get_field_in("p_int").get_view<const Real**>();
-  auto d_pdel = get_field_in("pseudo_density").get_view<const Real**>();
-  auto d_sfc_alb_dir_vis = get_field_in("sfc_alb_dir_vis").get_view<const Real*>();
-  auto d_sfc_alb_dir_nir = get_field_in("sfc_alb_dir_nir").get_view<const Real*>();
-  auto d_sfc_alb_dif_vis = get_field_in("sfc_alb_dif_vis").get_view<const Real*>();
-  auto d_sfc_alb_dif_nir = get_field_in("sfc_alb_dif_nir").get_view<const Real*>();
-  auto d_qv = get_field_in("qv").get_view<const Real**>();
-  auto d_qc = get_field_in("qc").get_view<const Real**>();
-  auto d_nc = get_field_in("nc").get_view<const Real**>();
-  auto d_qi = get_field_in("qi").get_view<const Real**>();
-  auto d_cldfrac_tot = get_field_in("cldfrac_tot").get_view<const Real**>();
-  auto d_rel = get_field_in("eff_radius_qc").get_view<const Real**>();
-  auto d_rei = get_field_in("eff_radius_qi").get_view<const Real**>();
-  auto d_surf_lw_flux_up = get_field_in("surf_lw_flux_up").get_view<const Real*>();
+  auto d_pmid = get_rad_field_in("p_mid").get_view<const Real**>();
+  auto d_pint = get_rad_field_in("p_int").get_view<const Real**>();
+  auto d_pdel = get_rad_field_in("pseudo_density").get_view<const Real**>();
+  auto d_sfc_alb_dir_vis = get_rad_field_in("sfc_alb_dir_vis").get_view<const Real*>();
+  auto d_sfc_alb_dir_nir = get_rad_field_in("sfc_alb_dir_nir").get_view<const Real*>();
+  auto d_sfc_alb_dif_vis = get_rad_field_in("sfc_alb_dif_vis").get_view<const Real*>();
+  auto d_sfc_alb_dif_nir = get_rad_field_in("sfc_alb_dif_nir").get_view<const Real*>();
+  auto d_qv = get_rad_field_in("qv").get_view<const Real**>();
+  auto d_qc = get_rad_field_in("qc").get_view<const Real**>();
+  auto d_nc = get_rad_field_in("nc").get_view<const Real**>();
+  auto d_qi = get_rad_field_in("qi").get_view<const Real**>();
+  auto d_cldfrac_tot = get_rad_field_in("cldfrac_tot").get_view<const Real**>();
+  auto d_rel = get_rad_field_in("eff_radius_qc").get_view<const Real**>();
+  auto d_rei = get_rad_field_in("eff_radius_qi").get_view<const Real**>();
+  auto d_surf_lw_flux_up = get_rad_field_in("surf_lw_flux_up").get_view<const Real*>();
   // Output fields
-  auto d_tmid = get_field_out("T_mid").get_view<Real**>();
-  auto d_cldfrac_rad = get_field_out("cldfrac_rad").get_view<Real**>();
+  auto d_tmid = get_rad_field_out("T_mid").get_view<Real**>();
+  auto d_cldfrac_rad = get_rad_field_out("cldfrac_rad").get_view<Real**>();
 
   // Aerosol optics only exist if m_do_aerosol_rad is true, so declare views and copy from FM if so
   using view_3d = Field::view_dev_t<const Real***>;
@@ -689,63 +1137,63 @@ void RRTMGPRadiation::run_impl (const double dt) {
   view_3d d_aero_g_sw;
   view_3d d_aero_tau_lw;
   if (m_do_aerosol_rad) {
-    d_aero_tau_sw = get_field_in("aero_tau_sw").get_view<const Real***>();
-    d_aero_ssa_sw = get_field_in("aero_ssa_sw").get_view<const Real***>();
-    d_aero_g_sw   = get_field_in("aero_g_sw"  ).get_view<const Real***>();
-    d_aero_tau_lw = get_field_in("aero_tau_lw").get_view<const Real***>();
+    d_aero_tau_sw = get_rad_field_in("aero_tau_sw").get_view<const Real***>();
+    d_aero_ssa_sw = get_rad_field_in("aero_ssa_sw").get_view<const Real***>();
+    d_aero_g_sw   = get_rad_field_in("aero_g_sw"  ).get_view<const Real***>();
+    d_aero_tau_lw = get_rad_field_in("aero_tau_lw").get_view<const Real***>();
   }
-  auto d_sw_flux_up = get_field_out("SW_flux_up").get_view<Real**>();
-  auto d_sw_flux_dn = get_field_out("SW_flux_dn").get_view<Real**>();
-  auto d_sw_flux_dn_dir = get_field_out("SW_flux_dn_dir").get_view<Real**>();
-  auto d_lw_flux_up = get_field_out("LW_flux_up").get_view<Real**>();
-  auto d_lw_flux_dn = get_field_out("LW_flux_dn").get_view<Real**>();
-  auto d_sw_clnclrsky_flux_up = get_field_out("SW_clnclrsky_flux_up").get_view<Real**>();
-  auto d_sw_clnclrsky_flux_dn = get_field_out("SW_clnclrsky_flux_dn").get_view<Real**>();
-  auto d_sw_clnclrsky_flux_dn_dir = get_field_out("SW_clnclrsky_flux_dn_dir").get_view<Real**>();
-  auto d_sw_clrsky_flux_up = get_field_out("SW_clrsky_flux_up").get_view<Real**>();
-  auto d_sw_clrsky_flux_dn = get_field_out("SW_clrsky_flux_dn").get_view<Real**>();
-  auto d_sw_clrsky_flux_dn_dir = get_field_out("SW_clrsky_flux_dn_dir").get_view<Real**>();
-  auto d_sw_clnsky_flux_up = get_field_out("SW_clnsky_flux_up").get_view<Real**>();
-  auto d_sw_clnsky_flux_dn = get_field_out("SW_clnsky_flux_dn").get_view<Real**>();
-  auto d_sw_clnsky_flux_dn_dir = get_field_out("SW_clnsky_flux_dn_dir").get_view<Real**>();
-  auto d_lw_clnclrsky_flux_up = get_field_out("LW_clnclrsky_flux_up").get_view<Real**>();
-  auto d_lw_clnclrsky_flux_dn = get_field_out("LW_clnclrsky_flux_dn").get_view<Real**>();
-  auto d_lw_clrsky_flux_up = get_field_out("LW_clrsky_flux_up").get_view<Real**>();
-  auto d_lw_clrsky_flux_dn = get_field_out("LW_clrsky_flux_dn").get_view<Real**>();
-  auto d_lw_clnsky_flux_up = get_field_out("LW_clnsky_flux_up").get_view<Real**>();
-  auto d_lw_clnsky_flux_dn = get_field_out("LW_clnsky_flux_dn").get_view<Real**>();
-  auto d_rad_heating_pdel = get_field_out("rad_heating_pdel").get_view<Real**>();
-  auto d_sfc_flux_dir_vis = get_field_out("sfc_flux_dir_vis").get_view<Real*>();
-  auto d_sfc_flux_dir_nir = get_field_out("sfc_flux_dir_nir").get_view<Real*>();
-  auto d_sfc_flux_dif_vis = get_field_out("sfc_flux_dif_vis").get_view<Real*>();
-  auto d_sfc_flux_dif_nir = get_field_out("sfc_flux_dif_nir").get_view<Real*>();
-  auto d_sfc_flux_sw_net = get_field_out("sfc_flux_sw_net").get_view<Real*>();
-  auto d_sfc_flux_lw_dn  = get_field_out("sfc_flux_lw_dn").get_view<Real*>();
-  auto d_cldlow = get_field_out("cldlow").get_view<Real*>();
-  auto d_cldmed = get_field_out("cldmed").get_view<Real*>();
-  auto d_cldhgh = get_field_out("cldhgh").get_view<Real*>();
-  auto d_cldtot = get_field_out("cldtot").get_view<Real*>();
+  auto d_sw_flux_up = get_rad_field_out("SW_flux_up").get_view<Real**>();
+  auto d_sw_flux_dn = get_rad_field_out("SW_flux_dn").get_view<Real**>();
+  auto d_sw_flux_dn_dir = get_rad_field_out("SW_flux_dn_dir").get_view<Real**>();
+  auto d_lw_flux_up = get_rad_field_out("LW_flux_up").get_view<Real**>();
+  auto d_lw_flux_dn = get_rad_field_out("LW_flux_dn").get_view<Real**>();
+  auto d_sw_clnclrsky_flux_up = get_rad_field_out("SW_clnclrsky_flux_up").get_view<Real**>();
+  auto d_sw_clnclrsky_flux_dn = get_rad_field_out("SW_clnclrsky_flux_dn").get_view<Real**>();
+  auto d_sw_clnclrsky_flux_dn_dir = get_rad_field_out("SW_clnclrsky_flux_dn_dir").get_view<Real**>();
+  auto d_sw_clrsky_flux_up = get_rad_field_out("SW_clrsky_flux_up").get_view<Real**>();
+  auto d_sw_clrsky_flux_dn = get_rad_field_out("SW_clrsky_flux_dn").get_view<Real**>();
+  auto d_sw_clrsky_flux_dn_dir = get_rad_field_out("SW_clrsky_flux_dn_dir").get_view<Real**>();
+  auto d_sw_clnsky_flux_up = get_rad_field_out("SW_clnsky_flux_up").get_view<Real**>();
+  auto d_sw_clnsky_flux_dn = get_rad_field_out("SW_clnsky_flux_dn").get_view<Real**>();
+  auto d_sw_clnsky_flux_dn_dir = get_rad_field_out("SW_clnsky_flux_dn_dir").get_view<Real**>();
+  auto d_lw_clnclrsky_flux_up = get_rad_field_out("LW_clnclrsky_flux_up").get_view<Real**>();
+  auto d_lw_clnclrsky_flux_dn = get_rad_field_out("LW_clnclrsky_flux_dn").get_view<Real**>();
+  auto d_lw_clrsky_flux_up = get_rad_field_out("LW_clrsky_flux_up").get_view<Real**>();
+  auto d_lw_clrsky_flux_dn = get_rad_field_out("LW_clrsky_flux_dn").get_view<Real**>();
+  auto d_lw_clnsky_flux_up = get_rad_field_out("LW_clnsky_flux_up").get_view<Real**>();
+  auto d_lw_clnsky_flux_dn = get_rad_field_out("LW_clnsky_flux_dn").get_view<Real**>();
+  auto d_rad_heating_pdel = get_rad_field_out("rad_heating_pdel").get_view<Real**>();
+  auto d_sfc_flux_dir_vis = get_rad_field_out("sfc_flux_dir_vis").get_view<Real*>();
+  auto d_sfc_flux_dir_nir = get_rad_field_out("sfc_flux_dir_nir").get_view<Real*>();
+  auto d_sfc_flux_dif_vis = get_rad_field_out("sfc_flux_dif_vis").get_view<Real*>();
+  auto d_sfc_flux_dif_nir = get_rad_field_out("sfc_flux_dif_nir").get_view<Real*>();
+  auto d_sfc_flux_sw_net = get_rad_field_out("sfc_flux_sw_net").get_view<Real*>();
+  auto d_sfc_flux_lw_dn  = get_rad_field_out("sfc_flux_lw_dn").get_view<Real*>();
+  auto d_cldlow = get_rad_field_out("cldlow").get_view<Real*>();
+  auto d_cldmed = get_rad_field_out("cldmed").get_view<Real*>();
+  auto d_cldhgh = get_rad_field_out("cldhgh").get_view<Real*>();
+  auto d_cldtot = get_rad_field_out("cldtot").get_view<Real*>();
   // Outputs for COSP
-  auto d_dtau067 = get_field_out("dtau067").get_view<Real**>();
-  auto d_dtau105 = get_field_out("dtau105").get_view<Real**>();
-  auto d_sunlit = get_field_out("sunlit").get_view<Real*>();
+  auto d_dtau067 = get_rad_field_out("dtau067").get_view<Real**>();
+  auto d_dtau105 = get_rad_field_out("dtau105").get_view<Real**>();
+  auto d_sunlit = get_rad_field_out("sunlit").get_view<Real*>();
 
   Kokkos::deep_copy(d_dtau067,0.0);
   Kokkos::deep_copy(d_dtau105,0.0);
   // Outputs for AeroCom cloud-top diagnostics
-  auto d_T_mid_at_cldtop = get_field_out("T_mid_at_cldtop").get_view<Real *>();
-  auto d_p_mid_at_cldtop = get_field_out("p_mid_at_cldtop").get_view<Real *>();
+  auto d_T_mid_at_cldtop = get_rad_field_out("T_mid_at_cldtop").get_view<Real *>();
+  auto d_p_mid_at_cldtop = get_rad_field_out("p_mid_at_cldtop").get_view<Real *>();
   auto d_cldfrac_ice_at_cldtop =
-      get_field_out("cldfrac_ice_at_cldtop").get_view<Real *>();
+      get_rad_field_out("cldfrac_ice_at_cldtop").get_view<Real *>();
   auto d_cldfrac_liq_at_cldtop =
-      get_field_out("cldfrac_liq_at_cldtop").get_view<Real *>();
+      get_rad_field_out("cldfrac_liq_at_cldtop").get_view<Real *>();
   auto d_cldfrac_tot_at_cldtop =
-      get_field_out("cldfrac_tot_at_cldtop").get_view<Real *>();
-  auto d_cdnc_at_cldtop = get_field_out("cdnc_at_cldtop").get_view<Real *>();
+      get_rad_field_out("cldfrac_tot_at_cldtop").get_view<Real *>();
+  auto d_cdnc_at_cldtop = get_rad_field_out("cdnc_at_cldtop").get_view<Real *>();
   auto d_eff_radius_qc_at_cldtop =
-      get_field_out("eff_radius_qc_at_cldtop").get_view<Real *>();
+      get_rad_field_out("eff_radius_qc_at_cldtop").get_view<Real *>();
   auto d_eff_radius_qi_at_cldtop =
-      get_field_out("eff_radius_qi_at_cldtop").get_view<Real *>();
+      get_rad_field_out("eff_radius_qi_at_cldtop").get_view<Real *>();
 
   constexpr auto stebol = PC::stebol;
   const auto nlay = m_nlay;
@@ -758,6 +1206,35 @@ void RRTMGPRadiation::run_impl (const double dt) {
   auto ts = timestamp();
   auto update_rad = scream::rrtmgp::radiation_do(m_rad_freq_in_steps, ts.get_num_steps());
 
+  // Compute orbital parameters; these are used both for computing
+  // the solar zenith angle and also for computing total solar
+  // irradiance scaling (tsi_scaling).
+  double obliqr, lambm0, mvelpp;
+  auto orbital_year = m_orbital_year;
+  auto eccen = m_orbital_eccen;
+  auto obliq = m_orbital_obliq;
+  auto mvelp = m_orbital_mvelp;
+  if (eccen >= 0 && obliq >= 0 && mvelp >= 0) {
+    // use fixed orbital parameters; to force this, we need to set
+    // orbital_year to SHR_ORB_UNDEF_INT, which is exposed through
+    // our c2f bridge as shr_orb_undef_int_c2f
+    orbital_year = shr_orb_undef_int_c2f;
+  } else if (orbital_year < 0) {
+    // compute orbital parameters based on current year
+    orbital_year = ts.get_year();
+  }
+  shr_orb_params_c2f(&orbital_year, &eccen, &obliq, &mvelp,
+                     &obliqr, &lambm0, &mvelpp);
+  // Use the orbital parameters to calculate the solar declination and eccentricity factor
+  double delta, eccf;
+  auto calday = ts.frac_of_year_in_days() + 1;  // Want day + fraction; calday 1 == Jan 1 0Z
+  shr_orb_decl_c2f(calday, eccen, mvelpp, lambm0,
+                   obliqr, &delta, &eccf);
+
+  if (update_rad and coarse_rad) {
+    m_coarsen->remap(true);
+  }
+
   if (update_rad) {
     // On each chunk, we internally "reset" the GasConcs object to subview the concs 3d array
     // with the correct ncol dimension. So let's keep a copy of the original (ref-counted)
@@ -771,31 +1248,6 @@ void RRTMGPRadiation::run_impl (const double dt) {
     auto orig_ncol_k = m_gas_concs_k.ncol;
 #endif
 
-    // Compute orbital parameters; these are used both for computing
-    // the solar zenith angle and also for computing total solar
-    // irradiance scaling (tsi_scaling).
-    double obliqr, lambm0, mvelpp;
-    auto orbital_year = m_orbital_year;
-    auto eccen = m_orbital_eccen;
-    auto obliq = m_orbital_obliq;
-    auto mvelp = m_orbital_mvelp;
-    if (eccen >= 0 && obliq >= 0 && mvelp >= 0) {
-      // use fixed orbital parameters; to force this, we need to set
-      // orbital_year to SHR_ORB_UNDEF_INT, which is exposed through
-      // our c2f bridge as shr_orb_undef_int_c2f
-      orbital_year = shr_orb_undef_int_c2f;
-    } else if (orbital_year < 0) {
-      // compute orbital parameters based on current year
-      orbital_year = ts.get_year();
-    }
-    shr_orb_params_c2f(&orbital_year, &eccen, &obliq, &mvelp,
-                       &obliqr, &lambm0, &mvelpp);
-    // Use the orbital parameters to calculate the solar declination and eccentricity factor
-    double delta, eccf;
-    auto calday = ts.frac_of_year_in_days() + 1;  // Want day + fraction; calday 1 == Jan 1 0Z
-    shr_orb_decl_c2f(calday, eccen, mvelpp, lambm0,
-                     obliqr, &delta, &eccf);
-
     // Precompute VMR for all gases, on all cols, before starting the chunks loop
     //
     // h2o is taken from qv
@@ -810,11 +1262,11 @@ void RRTMGPRadiation::run_impl (const double dt) {
       // as a constant value, read from file during init. Skip these.
       if (name=="o3" or name == "n2" or name == "co") continue;
 
-      auto d_vmr = get_field_out(name + "_volume_mix_ratio").get_view<Real**>();
+      auto d_vmr = get_rad_field_out(name + "_volume_mix_ratio").get_view<Real**>();
       if (name == "h2o") {
         // h2o is (wet) mass mixing ratio in FM, otherwise known as "qv", which we've already read in above
         // Convert to vmr
-        const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(m_ncol, m_nlay);
+        const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(m_rad_ncol, m_nlay);
         Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
           const int icol = team.league_rank();
           Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k) {
@@ -830,7 +1282,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
         );
         // Back out volume mixing ratios
         const auto air_mol_weight = PC::MWdry;
-        const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(m_ncol, m_nlay);
+        const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(m_rad_ncol, m_nlay);
         Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
           const int i = team.league_rank();
           Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k) {
@@ -840,6 +1292,15 @@ void RRTMGPRadiation::run_impl (const double dt) {
       }
     }
 
+    // If we are tuning the chunk size, time the chunks loop with the next candidate
+    const bool tune_col_chunks = not m_col_chunk_candidates.empty();
+    std::chrono::steady_clock::time_point chunks_start;
+    if (tune_col_chunks) {
+      set_col_chunks(m_col_chunk_candidates[m_col_chunk_times.size()]);
+      Kokkos::fence();
+      chunks_start = std::chrono::steady_clock::now();
+    }
+
     // Loop over each chunk of columns
     for (int ic=0; ic<m_num_col_chunks; ++ic) {
       const int beg  = m_col_chunk_beg[ic];
@@ -1212,7 +1673,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
         auto full_name = name + "_volume_mix_ratio";
 
         // 'o3' is marked as 'Required' rather than 'Computed', so we need to get the proper field
-        auto f = name=="o3" ? get_field_in(full_name) : get_field_out(full_name);
+        auto f = name=="o3" ? get_rad_field_in(full_name) : get_rad_field_out(full_name);
         auto d_vmr = f.get_view<const Real**>();
 #ifdef RRTMGP_ENABLE_KOKKOS
         auto tmp2d_k = subview_2dkc(d_vmr, m_nlay);
@@ -1677,6 +2138,45 @@ void RRTMGPRadiation::run_impl (const double dt) {
 #endif
     } // loop over chunk
 
+    if (tune_col_chunks) {
+      Kokkos::fence();
+      const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - chunks_start;
+      m_col_chunk_times.push_back(elapsed.count());
+      if (m_col_chunk_times.size()==m_col_chunk_candidates.size()) {
+        // Done: keep the fastest size (the first time is the warmup, so skip it)
+        std::string timings;
+        size_t best = 1;
+        for (size_t i=1; i<m_col_chunk_times.size(); ++i) {
+          timings += "  - chunk size " + std::to_string(m_col_chunk_candidates[i]) + ": "
+                   + std::to_string(m_col_chunk_times[i]) + " s\n";
+          if (m_col_chunk_times[i]<m_col_chunk_times[best]) {
+            best = i;
+          }
+        }
+        set_col_chunks(m_col_chunk_candidates[best]);
+        this->log(LogLevel::info,
+                  "[RRTMGP::run_impl] Column chunk size tuning:\n" + timings +
+                  "  - selected chunk size: " + std::to_string(m_col_chunk_candidates[best]) + "\n");
+        m_col_chunk_candidates.clear();
+        m_col_chunk_times.clear();
+      }
+    }
+
+    if (m_rad_incremental_update) {
+      // Keep the SW heating rate, which is rescaled until the next radiation step
+      auto d_sw_heating = get_rad_field_out("sw_heating").get_view<Real**>();
+      const int nlay = m_nlay;
+      const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(m_rad_ncol, m_nlay);
+      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+        const int icol = team.league_rank();
+        Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k) {
+          d_sw_heating(icol,k) = (d_sw_flux_up(icol,k+1) - d_sw_flux_up(icol,k) -
+                                  d_sw_flux_dn(icol,k+1) + d_sw_flux_dn(icol,k))
+                               * PC::gravit / (PC::Cpair * d_pdel(icol,k));
+        });
+      });
+    }
+
     // Restore the refCounted array.
 #ifdef RRTMGP_ENABLE_YAKL
     m_gas_concs.concs = gas_concs;
@@ -1688,6 +2188,29 @@ void RRTMGPRadiation::run_impl (const double dt) {
 #endif
   } // update_rad
 
+  if (coarse_rad) {
+    // Map the radiation outputs back to the physics grid, and use the physics grid fields from now on
+    if (update_rad) {
+      m_refine->remap(true);
+      downscale_rad_outputs();
+    }
+    d_tmid = get_field_out("T_mid").get_view<Real**>();
+    d_pdel = get_field_in("pseudo_density").get_view<const Real**>();
+    d_rad_heating_pdel = get_field_out("rad_heating_pdel").get_view<Real**>();
+    d_sw_flux_up = get_field_out("SW_flux_up").get_view<Real**>();
+    d_sw_flux_dn = get_field_out("SW_flux_dn").get_view<Real**>();
+    d_lw_flux_up = get_field_out("LW_flux_up").get_view<Real**>();
+    d_lw_flux_dn = get_field_out("LW_flux_dn").get_view<Real**>();
+  }
+
+  // With incremental updates, the SW fluxes and heating are rescaled at every non-radiation
+  // step, and d_rad_heating_pdel then holds the (new) heating rate, like at radiation steps
+  bool new_heating = update_rad;
+  if (m_rad_incremental_update and (update_rad or m_have_rad_state)) {
+    update_rad_incrementally(update_rad,dt,calday,delta);
+    new_heating = true;
+  }
+
   // Apply temperature tendency; if we updated radiation this timestep, then d_rad_heating_pdel should
   // contain actual heating rate, not pdel scaled heating rate. Otherwise, if we have NOT updated the
   // radiative heating, then we need to back out the heating from the rad_heating*pdel term that we carry
@@ -1698,7 +2221,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
   Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
     const int i = team.league_rank();
     Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlays), [&] (const int& k) {
-      if (update_rad) {
+      if (new_heating) {
         d_tmid(i,k) = d_tmid(i,k) + d_rad_heating_pdel(i,k) * dt;
         d_rad_heating_pdel(i,k) = d_pdel(i,k) * d_rad_heating_pdel(i,k);
       } else {
@@ -1715,6 +2238,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
     auto water_flux = get_field_out("water_flux").get_view<Real*>();
     auto ice_flux   = get_field_out("ice_flux").get_view<Real*>();
     auto heat_flux  = get_field_out("heat_flux").get_view<Real*>();
+    const bool heat_flux_from_heating = coarse_rad or m_rad_incremental_update;
 
     const int ncols = m_ncol;
     const int nlays = m_nlay;
@@ -1726,6 +2250,17 @@ void RRTMGPRadiation::run_impl (const double dt) {
       water_flux(icol) = 0;
       ice_flux(icol)   = 0;
 
+      if (heat_flux_from_heating) {
+        // The (refined or rescaled) fluxes are not consistent with the heating of each
+        // physics column, so compute the heat flux from the heating itself
+        Real heating = 0;
+        Kokkos::parallel_reduce(Kokkos::TeamVectorRange(team, nlays), [&] (const int& k, Real& sum) {
+          sum += d_rad_heating_pdel(icol,k);
+        }, heating);
+        heat_flux(icol) = PC::Cpair*heating/PC::gravit;
+        return;
+      }
+
       const auto fsns = d_sw_flux_dn(icol, nlays) - d_sw_flux_up(icol, nlays);
       const auto fsnt = d_sw_flux_dn(icol, 0)     - d_sw_flux_up(icol, 0);
       const auto flns = d_lw_flux_up(icol, nlays) - d_lw_flux_dn(icol, nlays);
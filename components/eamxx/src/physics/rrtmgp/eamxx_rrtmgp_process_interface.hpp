@@ -4,6 +4,7 @@
 #include "cpp/rrtmgp/mo_gas_concentrations.h"
 #include "physics/rrtmgp/scream_rrtmgp_interface.hpp"
 #include "share/atm_process/atmosphere_process.hpp"
+#include "share/grid/remap/abstract_remapper.hpp"
 #include "ekat/ekat_parameter_list.hpp"
 #include "ekat/util/ekat_string_utils.hpp"
 #include <string>
@@ -50,6 +51,9 @@ public:
   // Set the grid
   void set_grids (const std::shared_ptr<const GridsManager> grid_manager);
 
+  // Radiation runs every rad_frequency steps
+  int get_update_frequency () const { return m_rad_freq_in_steps; }
+
 // NOTE: cannot use lambda functions for CUDA devices if these are protected!
 public:
   // The three main interfaces for the subcomponent
@@ -57,11 +61,29 @@ public:
   void run_impl        (const double dt);
   void finalize_impl   ();
 
+  // Coarse radiation: radiation is computed on the coarse grid of m_coarsen, and the
+  // outputs are mapped back to the physics grid with m_refine, then downscaled
+  void setup_coarse_rad_grid (const std::string& coarsening_map_file,
+                              const std::string& refining_map_file);
+  void init_coarse_rad_fields ();
+  void downscale_rad_outputs ();
+
+  // At radiation steps, saves the fluxes and heating. At the other steps, rescales the SW fluxes
+  // and heating of the last radiation step with the cosine zenith angle of the current step, and
+  // updates the surface upward LW flux (and the LW heating) with the current surface state
+  void update_rad_incrementally (const bool update_rad, const double dt,
+                                 const double calday, const double delta);
+
   // Keep track of number of columns and levels
   int m_ncol;
+  int m_rad_ncol;         // Number of columns of the radiation grid (m_ncol if not coarsening)
   int m_num_col_chunks;
-  int m_col_chunk_size;
+  int m_col_chunk_size;   // Max chunk size, which sets the size of the buffers
   std::vector<int> m_col_chunk_beg;
+  // If column_chunk_tune=true, the first radiation steps time the chunk sizes in
+  // m_col_chunk_candidates (one per step), then the fastest one is kept
+  std::vector<int>    m_col_chunk_candidates;
+  std::vector<double> m_col_chunk_times;
   int m_nlay;
   Field m_lat;
   Field m_lon;
@@ -120,6 +142,23 @@ public:
   // Whether or not to do subcolumn sampling of cloud state for MCICA
   bool m_do_subcol_sampling;
 
+  // State of the last radiation step, for the incremental updates between radiation steps.
+  // Heating arrays hold heating*pdel, m_sfc_sw_fluxes_rad holds sfc_flux_dir_vis,
+  // sfc_flux_dir_nir, sfc_flux_dif_vis, sfc_flux_dif_nir and sfc_flux_sw_net, and
+  // m_sfc_lw_fluxes_rad holds the bottom LW_flux_up and surf_lw_flux_up.
+  bool    m_rad_incremental_update;
+  bool    m_have_rad_state;   // False until the first radiation step of this run (e.g., after a restart)
+  Field   m_sw_heating;       // SW heating rate of the last radiation step
+  real1dk m_cosz_step;
+  real1dk m_cosz_rad;
+  real2dk m_rad_heating_pdel_rad;
+  real2dk m_sw_heating_pdel_rad;
+  real2dk m_sw_flux_dn_rad;
+  real2dk m_sw_flux_up_rad;
+  real2dk m_sw_flux_dn_dir_rad;
+  real2dk m_sfc_sw_fluxes_rad;
+  real2dk m_sfc_lw_fluxes_rad;
+
   // Structure for storing local variables initialized using the ATMBufferManager
   struct Buffer {
     static constexpr int num_1d_ncol        = 10;
@@ -321,12 +360,27 @@ protected:
   // Computes total number of bytes needed for local variables
   size_t requested_buffer_size_in_bytes() const;
 
+  // Number of reals of local variables (see Buffer) and of (estimated) RRTMGP
+  // temporaries needed for each column of a chunk
+  size_t buffer_reals_per_col() const;
+  size_t temporary_reals_per_col() const;
+
+  // Sets m_num_col_chunks and m_col_chunk_beg for chunks of at most chunk_size columns
+  void set_col_chunks (const int chunk_size);
+
   // Set local variables using memory provided by
   // the ATMBufferManager
   void init_buffers(const ATMBufferManager &buffer_manager);
 
   std::shared_ptr<const AbstractGrid>   m_grid;
 
+  // Grid where radiation is computed, and the remappers to/from it (if different from m_grid)
+  std::shared_ptr<const AbstractGrid>   m_rad_grid;
+  std::shared_ptr<AbstractRemapper>     m_coarsen;
+  std::shared_ptr<AbstractRemapper>     m_refine;
+  std::map<std::string,Field>           m_coarse_fields;
+  Field                                 m_rad_surf_lw_flux_up;  // Coarse surf_lw_flux_up, on m_grid
+
   // Struct which contains local variables
   Buffer m_buffer;
 };  // class RRTMGPRadiation
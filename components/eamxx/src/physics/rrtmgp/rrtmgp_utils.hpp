@@ -5,6 +5,10 @@
 #include "cpp/rrtmgp_const.h"
 #include "cpp/rrtmgp_conversion.h"
 
+#include <Kokkos_Core.hpp>
+
+#include <cstdint>
+
 #ifdef RRTMGP_ENABLE_YAKL
 #include "YAKL.h"
 #include "YAKL_Bounds_fortran.h"
@@ -69,6 +73,27 @@ void compute_heating_rate (
 }
 #endif
 
+// Counter-based random numbers for the McICA subcolumn generator: returns a
+// uniform number in [0,1) that only depends on (key, ctr0, ctr1), using the
+// Philox-2x32-10 generator of Salmon et al. (2011), "Parallel random numbers:
+// as easy as 1, 2, 3". Unlike a stateful generator, any (column, gpoint, layer)
+// can be sampled independently, and in any order.
+KOKKOS_INLINE_FUNCTION
+double philox_uniform(const std::uint32_t key, const std::uint32_t ctr0, const std::uint32_t ctr1) {
+  constexpr std::uint32_t mult = 0xD256D193;
+  constexpr std::uint32_t bump = 0x9E3779B9;
+  std::uint32_t x0 = ctr0, x1 = ctr1, k = key;
+  for (int round = 0; round < 10; ++round) {
+    const std::uint64_t prod = static_cast<std::uint64_t>(mult) * x0;
+    x0 = static_cast<std::uint32_t>(prod >> 32) ^ k ^ x1;
+    x1 = static_cast<std::uint32_t>(prod);
+    k += bump;
+  }
+  // Use 53 of the 64 random bits, so that the result is exactly representable
+  const std::uint64_t bits = (static_cast<std::uint64_t>(x0) << 21) | (x1 >> 11);
+  return bits * (1.0 / 9007199254740992.0); // 2^-53
+}
+
 inline bool radiation_do(const int irad, const int nstep) {
   // If irad == 0, then never do radiation;
   // Otherwise, we always call radiation at the first step,
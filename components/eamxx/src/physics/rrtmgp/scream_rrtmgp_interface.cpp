@@ -51,6 +51,8 @@ CloudOptics cloud_optics_lw;
 bool initialized = false;
 bool initialized_k = false;
 
+bool counter_based_subcol_gen = false;
+
 // local functions
 namespace {
 
@@ -139,13 +141,21 @@ OpticalProps2str get_subsampled_clouds(
   parallel_for(SimpleBounds<1>(ncol), YAKL_LAMBDA(int icol) {
       seeds(icol) = 1e9 * (p_lay(icol,nlay) - int(p_lay(icol,nlay)));
     });
-  auto cldmask = get_subcolumn_mask(ncol, nlay, ngpt, cldfrac_rad, overlap, seeds);
+  // With the counter-based generator, the mask has one bit per layer, packed in 32-bit words
+  const bool packed = counter_based_subcol_gen;
+  int3d cldmask;
+  if (packed) {
+    cldmask = get_subcolumn_mask_packed(ncol, nlay, ngpt, cldfrac_rad, overlap, seeds);
+  } else {
+    cldmask = get_subcolumn_mask(ncol, nlay, ngpt, cldfrac_rad, overlap, seeds);
+  }
 
   // Assign optical properties to subcolumns (note this implements MCICA)
   auto gpoint_bands = kdist.get_gpoint_bands();
   parallel_for(SimpleBounds<3>(ngpt,nlay,ncol), YAKL_LAMBDA(int igpt, int ilay, int icol) {
       auto ibnd = gpoint_bands(igpt);
-      if (cldmask(icol,ilay,igpt) == 1) {
+      const bool cloudy = packed ? subcolumn_mask_bit(cldmask,icol,ilay,igpt) : cldmask(icol,ilay,igpt) == 1;
+      if (cloudy) {
         subsampled_optics.tau(icol,ilay,igpt) = cloud_optics.tau(icol,ilay,ibnd);
         subsampled_optics.ssa(icol,ilay,igpt) = cloud_optics.ssa(icol,ilay,ibnd);
         subsampled_optics.g  (icol,ilay,igpt) = cloud_optics.g  (icol,ilay,ibnd);
@@ -188,12 +198,20 @@ OpticalProps1scl get_subsampled_clouds(
   parallel_for(SimpleBounds<1>(ncol), YAKL_LAMBDA(int icol) {
       seeds(icol) = 1e9 * (p_lay(icol,nlay-1) - int(p_lay(icol,nlay-1)));
     });
-  auto cldmask = get_subcolumn_mask(ncol, nlay, ngpt, cldfrac_rad, overlap, seeds);
+  // With the counter-based generator, the mask has one bit per layer, packed in 32-bit words
+  const bool packed = counter_based_subcol_gen;
+  int3d cldmask;
+  if (packed) {
+    cldmask = get_subcolumn_mask_packed(ncol, nlay, ngpt, cldfrac_rad, overlap, seeds);
+  } else {
+    cldmask = get_subcolumn_mask(ncol, nlay, ngpt, cldfrac_rad, overlap, seeds);
+  }
   // Assign optical properties to subcolumns (note this implements MCICA)
   auto gpoint_bands = kdist.get_gpoint_bands();
   parallel_for(SimpleBounds<3>(ngpt,nlay,ncol), YAKL_LAMBDA(int igpt, int ilay, int icol) {
       auto ibnd = gpoint_bands(igpt);
-      if (cldmask(icol,ilay,igpt) == 1) {
+      const bool cloudy = packed ? subcolumn_mask_bit(cldmask,icol,ilay,igpt) : cldmask(icol,ilay,igpt) == 1;
+      if (cloudy) {
         subsampled_optics.tau(icol,ilay,igpt) = cloud_optics.tau(icol,ilay,ibnd);
       } else {
         subsampled_optics.tau(icol,ilay,igpt) = 0;
@@ -581,6 +599,47 @@ int3d get_subcolumn_mask(const int ncol, const int nlay, const int ngpt, real2d
   return subcolumn_mask;
 }
 
+int3d get_subcolumn_mask_packed(const int ncol, const int nlay, const int ngpt, real2d &cldf, const int overlap_option, int1d &seeds) {
+
+  // Same overlap assumptions as get_subcolumn_mask, but the random number for each
+  // (column, gpoint, layer) comes from a counter-based generator, so that each
+  // (column, gpoint) subcolumn can be generated independently, stepping down the
+  // column and applying the maximum-random recurrence on the fly. Neither the
+  // ncol x nlay x ngpt random numbers nor the unpacked mask are stored: the mask
+  // has one bit per layer, packed in 32-bit words (see subcolumn_mask_bit).
+  const int nwords = (nlay+31) / 32;
+  auto subcolumn_mask = int3d("subcolumn_mask", ncol, nwords, ngpt);
+  parallel_for(SimpleBounds<2>(ngpt,ncol), YAKL_LAMBDA(int igpt, int icol) {
+      const auto key = static_cast<std::uint32_t>(seeds(icol));
+      unsigned word = 0;
+      Real cldx_above = 0;
+      for (int ilay = 1; ilay <= nlay; ilay++) {
+        Real cldx = 1;
+        if (overlap_option != 0) {
+          // Counters are 0-based, so that the Kokkos version produces the same mask
+          cldx = philox_uniform(key, ilay-1, igpt-1);
+          if (ilay > 1) {
+            // Eq (14) in Raisanen et al. 2004, as in get_subcolumn_mask
+            if (cldx_above > 1.0 - cldf(icol,ilay-1)) {
+              cldx = cldx_above;
+            } else {
+              cldx = cldx * (1.0 - cldf(icol,ilay-1));
+            }
+          }
+        }
+        cldx_above = cldx;
+        if (cldx > 1.0 - cldf(icol,ilay)) {
+          word |= 1u << ((ilay-1) % 32);
+        }
+        if ((ilay-1) % 32 == 31 || ilay == nlay) {
+          subcolumn_mask(icol,(ilay-1)/32+1,igpt) = static_cast<int>(word);
+          word = 0;
+        }
+      }
+    });
+  return subcolumn_mask;
+}
+
 void rrtmgp_sw(
   const int ncol, const int nlay,
   GasOpticsRRTMGP &k_dist,
@@ -41,6 +41,9 @@ extern CloudOptics cloud_optics_lw;
 
 extern bool initialized;
 
+// If true, the McICA subcolumn cloud mask is generated with get_subcolumn_mask_packed
+extern bool counter_based_subcol_gen;
+
 void rrtmgp_initialize(
   GasConcs &gas_concs,
   const std::string& coefficients_file_sw, const std::string& coefficients_file_lw,
@@ -107,6 +110,14 @@ void rrtmgp_lw(
 
 int3d get_subcolumn_mask(const int ncol, const int nlay, const int ngpt, real2d &cldf, const int overlap_option, int1d &seeds);
 
+// Memory-lean alternative to get_subcolumn_mask: returns a (ncol, (nlay+31)/32, ngpt)
+// mask, with the cloud flag of layer ilay in bit (ilay-1)%32 of word (ilay-1)/32+1
+int3d get_subcolumn_mask_packed(const int ncol, const int nlay, const int ngpt, real2d &cldf, const int overlap_option, int1d &seeds);
+
+YAKL_INLINE bool subcolumn_mask_bit(const int3d &mask, const int icol, const int ilay, const int igpt) {
+  return (static_cast<unsigned>(mask(icol,(ilay-1)/32+1,igpt)) >> ((ilay-1) % 32)) & 1u;
+}
+
 void compute_cloud_area(
   int ncol, int nlay, int ngpt, Real pmin, Real pmax,
   const real2d& pmid, const real3d& cld_tau_gpt, real1d& cld_area);
@@ -215,6 +226,11 @@ static inline cloud_optics_t cloud_optics_lw_k;
  */
 static inline bool initialized_k = false;
 
+/*
+ * If true, the McICA subcolumn cloud mask is generated with get_subcolumn_mask_packed
+ */
+static inline bool counter_based_subcol_gen_k = false;
+
 /*
  * Initialize data for RRTMGP driver
  */
@@ -1020,6 +1036,54 @@ static int3dk get_subcolumn_mask(const int ncol, const int nlay, const int ngpt,
   return subcolumn_mask;
 }
 
+/*
+ * Memory-lean alternative to get_subcolumn_mask. The random number of each
+ * (column, gpoint, layer) comes from a counter-based generator, so each
+ * (column, gpoint) subcolumn is generated independently, applying the
+ * maximum-random recurrence on the fly while stepping down the column.
+ * Returns a (ncol, (nlay+31)/32, ngpt) mask, with the cloud flag of layer
+ * ilay in bit ilay%32 of word ilay/32 (see subcolumn_mask_bit).
+ */
+static int3dk get_subcolumn_mask_packed(const int ncol, const int nlay, const int ngpt, const real2dk &cldf, const int overlap_option, int1dk &seeds)
+{
+  const int nwords = (nlay+31) / 32;
+  int3dk subcolumn_mask = int3dk("subcolumn_mask", ncol, nwords, ngpt);
+  Kokkos::parallel_for(MDRP::template get<2>({ngpt,ncol}), KOKKOS_LAMBDA(int igpt, int icol) {
+    const auto key = static_cast<std::uint32_t>(seeds(icol));
+    unsigned word = 0;
+    RealT cldx_above = 0;
+    for (int ilay = 0; ilay < nlay; ilay++) {
+      RealT cldx = 1;
+      if (overlap_option != 0) {
+        cldx = philox_uniform(key, ilay, igpt);
+        if (ilay > 0) {
+          // Eq (14) in Raisanen et al. 2004, as in get_subcolumn_mask
+          if (cldx_above > 1.0 - cldf(icol,ilay-1)) {
+            cldx = cldx_above;
+          } else {
+            cldx = cldx * (1.0 - cldf(icol,ilay-1));
+          }
+        }
+      }
+      cldx_above = cldx;
+      if (cldx > 1.0 - cldf(icol,ilay)) {
+        word |= 1u << (ilay % 32);
+      }
+      if (ilay % 32 == 31 || ilay == nlay-1) {
+        subcolumn_mask(icol,ilay/32,igpt) = static_cast<int>(word);
+        word = 0;
+      }
+    }
+  });
+  return subcolumn_mask;
+}
+
+KOKKOS_INLINE_FUNCTION
+static bool subcolumn_mask_bit(const int3dk &mask, const int icol, const int ilay, const int igpt)
+{
+  return (static_cast<unsigned>(mask(icol,ilay/32,igpt)) >> (ilay % 32)) & 1u;
+}
+
 /*
  * Compute cloud area from 3d subcol cloud property
  */
@@ -1323,12 +1387,16 @@ static optical_props2_t get_subsampled_clouds(
   Kokkos::parallel_for(ncol, KOKKOS_LAMBDA(int icol) {
     seeds(icol) = 1e9 * (p_lay(icol,nlay-1) - int(p_lay(icol,nlay-1)));
   });
-  auto cldmask = get_subcolumn_mask(ncol, nlay, ngpt, cldfrac_rad, overlap, seeds);
+  // With the counter-based generator, the mask has one bit per layer, packed in 32-bit words
+  const bool packed = counter_based_subcol_gen_k;
+  auto cldmask = packed ? get_subcolumn_mask_packed(ncol, nlay, ngpt, cldfrac_rad, overlap, seeds)
+                        : get_subcolumn_mask(ncol, nlay, ngpt, cldfrac_rad, overlap, seeds);
   // Assign optical properties to subcolumns (note this implements MCICA)
   auto gpoint_bands = kdist.get_gpoint_bands();
   Kokkos::parallel_for(MDRP::template get<3>({ngpt,nlay,ncol}), KOKKOS_LAMBDA(int igpt, int ilay, int icol) {
     auto ibnd = gpoint_bands(igpt);
-    if (cldmask(icol,ilay,igpt) == 1) {
+    const bool cloudy = packed ? subcolumn_mask_bit(cldmask,icol,ilay,igpt) : cldmask(icol,ilay,igpt) == 1;
+    if (cloudy) {
       subsampled_optics.tau(icol,ilay,igpt) = cloud_optics.tau(icol,ilay,ibnd);
       subsampled_optics.ssa(icol,ilay,igpt) = cloud_optics.ssa(icol,ilay,ibnd);
       subsampled_optics.g  (icol,ilay,igpt) = cloud_optics.g  (icol,ilay,ibnd);
@@ -1371,12 +1439,16 @@ static optical_props1_t get_subsampled_clouds(
   Kokkos::parallel_for(ncol, KOKKOS_LAMBDA(int icol) {
     seeds(icol) = 1e9 * (p_lay(icol,nlay-2) - int(p_lay(icol,nlay-2)));
   });
-  auto cldmask = get_subcolumn_mask(ncol, nlay, ngpt, cldfrac_rad, overlap, seeds);
+  // With the counter-based generator, the mask has one bit per layer, packed in 32-bit words
+  const bool packed = counter_based_subcol_gen_k;
+  auto cldmask = packed ? get_subcolumn_mask_packed(ncol, nlay, ngpt, cldfrac_rad, overlap, seeds)
+                        : get_subcolumn_mask(ncol, nlay, ngpt, cldfrac_rad, overlap, seeds);
   // Assign optical properties to subcolumns (note this implements MCICA)
   auto gpoint_bands = kdist.get_gpoint_bands();
   Kokkos::parallel_for(MDRP::template get<3>({ngpt,nlay,ncol}), KOKKOS_LAMBDA(int igpt, int ilay, int icol) {
       auto ibnd = gpoint_bands(igpt);
-      if (cldmask(icol,ilay,igpt) == 1) {
+      const bool cloudy = packed ? subcolumn_mask_bit(cldmask,icol,ilay,igpt) : cldmask(icol,ilay,igpt) == 1;
+      if (cloudy) {
         subsampled_optics.tau(icol,ilay,igpt) = cloud_optics.tau(icol,ilay,ibnd);
       } else {
         subsampled_optics.tau(icol,ilay,igpt) = 0;
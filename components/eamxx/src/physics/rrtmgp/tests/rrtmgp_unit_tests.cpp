@@ -527,6 +527,75 @@ TEST_CASE("rrtmgp_test_subcol_gen") {
 }
 
 
+TEST_CASE("rrtmgp_test_subcol_gen_packed") {
+    // Initialize YAKL
+    if (!yakl::isInitialized()) { yakl::init(); }
+    // Use more than 32 layers, so that the mask spans more than one word, and
+    // enough subcolumns to check the sampled cloud fraction
+    const int ncol = 2;
+    const int nlay = 40;
+    const int ngpt = 4000;
+    auto cldfrac = real2d("cldfrac", ncol, nlay);
+    yakl::fortran::parallel_for(yakl::fortran::SimpleBounds<2>(nlay,ncol), YAKL_LAMBDA(int ilay, int icol) {
+        // Alternate clear, overcast and partly cloudy layers, with two adjacent
+        // partly cloudy layers straddling the word boundary
+        const int k = (ilay-1) % 4;
+        cldfrac(icol,ilay) = k == 0 ? 0 : (k == 1 ? 1 : 0.3);
+    });
+    auto seeds = int1d("seeds", ncol);
+    yakl::fortran::parallel_for(ncol, YAKL_LAMBDA(int icol) {
+        seeds(icol) = 12345*icol;
+    });
+    auto cldmask = scream::rrtmgp::get_subcolumn_mask_packed(ncol, nlay, ngpt, cldfrac, 1, seeds);
+    REQUIRE(cldmask.dimension[1] == (nlay+31)/32);
+    auto cldmask_h = cldmask.createHostCopy();
+    auto cldfrac_h = cldfrac.createHostCopy();
+    // Unpack on host; same bit layout as scream::rrtmgp::subcolumn_mask_bit
+    auto bit = [&](int icol, int ilay, int igpt) {
+        return ((static_cast<unsigned>(cldmask_h(icol,(ilay-1)/32+1,igpt)) >> ((ilay-1) % 32)) & 1u) == 1u;
+    };
+    for (int icol = 1; icol <= ncol; icol++) {
+        for (int ilay = 1; ilay <= nlay; ilay++) {
+            int ncloudy = 0;
+            for (int igpt = 1; igpt <= ngpt; igpt++) {
+                const bool cloudy = bit(icol,ilay,igpt);
+                ncloudy += cloudy;
+                // Adjacent cloudy layers are maximally overlapped
+                if (ilay > 1 && cldfrac_h(icol,ilay-1) > 0 && cldfrac_h(icol,ilay) >= cldfrac_h(icol,ilay-1) &&
+                    bit(icol,ilay-1,igpt)) {
+                    REQUIRE(cloudy);
+                }
+            }
+            // Clear and overcast layers are exact; the others are within sampling noise
+            const real frac = real(ncloudy) / ngpt;
+            if (cldfrac_h(icol,ilay) == 0 || cldfrac_h(icol,ilay) == 1) {
+                REQUIRE(frac == cldfrac_h(icol,ilay));
+            } else {
+                REQUIRE(std::abs(frac - cldfrac_h(icol,ilay)) < 0.05);
+            }
+        }
+    }
+    // Different columns get different subcolumns
+    bool same = true;
+    for (int igpt = 1; igpt <= ngpt; igpt++) {
+        same = same && cldmask_h(1,1,igpt) == cldmask_h(2,1,igpt);
+    }
+    REQUIRE(not same);
+    // overlap_option=0 yields all-or-nothing clouds
+    cldmask = scream::rrtmgp::get_subcolumn_mask_packed(ncol, nlay, ngpt, cldfrac, 0, seeds);
+    cldmask_h = cldmask.createHostCopy();
+    for (int igpt = 1; igpt <= ngpt; igpt++) {
+        for (int ilay = 1; ilay <= nlay; ilay++) {
+            REQUIRE(bit(1,ilay,igpt) == (cldfrac_h(1,ilay) > 0));
+        }
+    }
+    // Clean up after test
+    cldfrac.deallocate();
+    cldmask.deallocate();
+    seeds.deallocate();
+    yakl::finalize();
+}
+
 TEST_CASE("rrtmgp_cloud_area") {
     // Initialize YAKL
     if (!yakl::isInitialized()) { yakl::init(); }
@@ -1337,6 +1406,64 @@ TEST_CASE("rrtmgp_test_subcol_gen_k") {
   scream::finalize_kls();
 }
 
+TEST_CASE("rrtmgp_test_subcol_gen_packed_k") {
+  // Initialize YAKL
+  scream::init_kls();
+  // Use more than 32 layers, so that the mask spans more than one word, and
+  // enough subcolumns to check the sampled cloud fraction
+  const int ncol = 2;
+  const int nlay = 40;
+  const int ngpt = 4000;
+  auto cldfrac = real2dk("cldfrac", ncol, nlay);
+  Kokkos::parallel_for(MDRP::template get<2>({nlay,ncol}), KOKKOS_LAMBDA(int ilay, int icol) {
+    // Alternate clear, overcast and partly cloudy layers, with two adjacent
+    // partly cloudy layers straddling the word boundary
+    const int k = ilay % 4;
+    cldfrac(icol,ilay) = k == 0 ? 0 : (k == 1 ? 1 : 0.3);
+  });
+  auto seeds = int1dk("seeds", ncol);
+  Kokkos::parallel_for(ncol, KOKKOS_LAMBDA(int icol) {
+    seeds(icol) = 12345*(icol+1);
+  });
+  auto cldmask = interface_t::get_subcolumn_mask_packed(ncol, nlay, ngpt, cldfrac, 1, seeds);
+  REQUIRE(cldmask.extent_int(1) == (nlay+31)/32);
+  auto cldmask_h = chc(cldmask);
+  auto cldfrac_h = chc(cldfrac);
+  // Unpack on host; same bit layout as interface_t::subcolumn_mask_bit
+  auto bit = [&](int icol, int ilay, int igpt) {
+    return ((static_cast<unsigned>(cldmask_h(icol,ilay/32,igpt)) >> (ilay % 32)) & 1u) == 1u;
+  };
+  for (int icol = 0; icol < ncol; icol++) {
+    for (int ilay = 0; ilay < nlay; ilay++) {
+      int ncloudy = 0;
+      for (int igpt = 0; igpt < ngpt; igpt++) {
+        const bool cloudy = bit(icol,ilay,igpt);
+        ncloudy += cloudy;
+        // Adjacent cloudy layers are maximally overlapped
+        if (ilay > 0 && cldfrac_h(icol,ilay-1) > 0 && cldfrac_h(icol,ilay) >= cldfrac_h(icol,ilay-1) &&
+            bit(icol,ilay-1,igpt)) {
+          REQUIRE(cloudy);
+        }
+      }
+      // Clear and overcast layers are exact; the others are within sampling noise
+      const real frac = real(ncloudy) / ngpt;
+      if (cldfrac_h(icol,ilay) == 0 || cldfrac_h(icol,ilay) == 1) {
+        REQUIRE(frac == cldfrac_h(icol,ilay));
+      } else {
+        REQUIRE(std::abs(frac - cldfrac_h(icol,ilay)) < 0.05);
+      }
+    }
+  }
+  // Different columns get different subcolumns
+  bool same = true;
+  for (int igpt = 0; igpt < ngpt; igpt++) {
+    same = same && cldmask_h(0,0,igpt) == cldmask_h(1,0,igpt);
+  }
+  REQUIRE(not same);
+  // Clean up after test
+  scream::finalize_kls();
+}
+
 TEST_CASE("rrtmgp_cloud_area_k") {
   // Initialize YAKL
   scream::init_kls();
@@ -1627,4 +1754,58 @@ TEST_CASE("rrtmgp_aerocom_cloudtop_k") {
 }
 #endif
 
+#if defined(RRTMGP_ENABLE_YAKL) && defined(RRTMGP_ENABLE_KOKKOS)
+TEST_CASE("rrtmgp_test_subcol_gen_packed_yakl_vs_k") {
+  // Initialize YAKL and Kokkos
+  scream::init_kls();
+  // The YAKL and Kokkos versions use the same (0-based) counters for the random
+  // numbers, so they must give the same masks. Use more than two words per
+  // column, and cloud fractions 0,0.1,...,1 in all possible orders.
+  const int ncol = 3;
+  const int nlay = 70;
+  const int ngpt = 112;
+  auto cldfrac_y = real2d("cldfrac", ncol, nlay);
+  auto seeds_y = int1d("seeds", ncol);
+  yakl::fortran::parallel_for(yakl::fortran::SimpleBounds<2>(nlay,ncol), YAKL_LAMBDA(int ilay, int icol) {
+    cldfrac_y(icol,ilay) = ((7*(icol-1) + 3*(ilay-1)) % 11) / 10.0;
+  });
+  yakl::fortran::parallel_for(ncol, YAKL_LAMBDA(int icol) {
+    seeds_y(icol) = 12345*icol;
+  });
+  auto cldfrac_k = real2dk("cldfrac", ncol, nlay);
+  auto seeds_k = int1dk("seeds", ncol);
+  Kokkos::parallel_for(MDRP::template get<2>({nlay,ncol}), KOKKOS_LAMBDA(int ilay, int icol) {
+    cldfrac_k(icol,ilay) = ((7*icol + 3*ilay) % 11) / 10.0;
+  });
+  Kokkos::parallel_for(ncol, KOKKOS_LAMBDA(int icol) {
+    seeds_k(icol) = 12345*(icol+1);
+  });
+  for (int overlap : {0, 1}) {
+    auto cldmask_y = scream::rrtmgp::get_subcolumn_mask_packed(ncol, nlay, ngpt, cldfrac_y, overlap, seeds_y);
+    auto cldmask_k = interface_t::get_subcolumn_mask_packed(ncol, nlay, ngpt, cldfrac_k, overlap, seeds_k);
+    const int nwords = (nlay+31)/32;
+    REQUIRE(cldmask_y.dimension[1] == nwords);
+    REQUIRE(cldmask_k.extent_int(1) == nwords);
+    auto cldmask_y_h = cldmask_y.createHostCopy();
+    auto cldmask_k_h = chc(cldmask_k);
+    int nset = 0;
+    for (int icol = 0; icol < ncol; icol++) {
+      for (int iw = 0; iw < nwords; iw++) {
+        for (int igpt = 0; igpt < ngpt; igpt++) {
+          REQUIRE(cldmask_y_h(icol+1,iw+1,igpt+1) == cldmask_k_h(icol,iw,igpt));
+          nset += cldmask_k_h(icol,iw,igpt) != 0;
+        }
+      }
+    }
+    // Make sure we are not comparing empty masks
+    REQUIRE(nset > 0);
+    cldmask_y.deallocate();
+  }
+  // Clean up after test
+  cldfrac_y.deallocate();
+  seeds_y.deallocate();
+  scream::finalize_kls();
+}
+#endif
+
 }
@@ -0,0 +1,183 @@
+#ifndef SCREAM_PHYSICS_BENCH_UTILS_HPP
+#define SCREAM_PHYSICS_BENCH_UTILS_HPP
+
+#include "share/scream_types.hpp"
+
+#include "ekat/ekat_assert.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace scream {
+namespace physics {
+namespace bench {
+
+/*
+ * Small utilities shared by the standalone physics benchmark executables
+ * (p3_bench, shoc_bench). A benchmark run is a list of cases; each case is
+ * written as one line of a JSON array, so that baseline files are easy to
+ * diff, and easy to parse back without a JSON library.
+ */
+
+struct Result {
+  std::string name;   // Case name, e.g. "p3_mixed"
+  Int ncol, nlev;
+  Int pack;           // SCREAM_SMALL_PACK_SIZE of the build
+  Int concurrency;    // Kokkos::DefaultExecutionSpace::concurrency()
+  Int repeat;
+  double seconds;     // Average kernel time per call
+  double cols_per_sec;
+  double gbytes_per_sec; // Interface bytes (read+write) per second
+
+  // Cases are matched against baselines by this key
+  std::string key () const {
+    return name + "_ncol" + std::to_string(ncol) + "_nlev" + std::to_string(nlev)
+                + "_pack" + std::to_string(pack);
+  }
+};
+
+inline Result make_result (const std::string& name, const Int ncol, const Int nlev,
+                           const Int pack, const Int concurrency, const Int repeat,
+                           const double seconds, const double bytes)
+{
+  Result r;
+  r.name = name;
+  r.ncol = ncol;
+  r.nlev = nlev;
+  r.pack = pack;
+  r.concurrency = concurrency;
+  r.repeat = repeat;
+  r.seconds = seconds;
+  r.cols_per_sec = seconds>0 ? ncol/seconds : 0;
+  r.gbytes_per_sec = seconds>0 ? 1e-9*bytes/seconds : 0;
+  return r;
+}
+
+inline void print (const Result& r) {
+  printf("%-16s ncol=%6d nlev=%4d pack=%2d : %1.3e s, %1.3e cols/s, %7.2f GB/s\n",
+         r.name.c_str(), r.ncol, r.nlev, r.pack, r.seconds, r.cols_per_sec, r.gbytes_per_sec);
+}
+
+inline void write_json (const std::string& filename, const std::vector<Result>& results) {
+  std::ofstream ofs(filename);
+  EKAT_REQUIRE_MSG (ofs.good(), "Error! Could not open '" + filename + "' for writing.\n");
+
+  ofs.precision(9);
+  ofs << "[\n";
+  for (size_t i=0; i<results.size(); ++i) {
+    const auto& r = results[i];
+    ofs << "  {\"name\": \"" << r.name << "\""
+        << ", \"ncol\": " << r.ncol
+        << ", \"nlev\": " << r.nlev
+        << ", \"pack\": " << r.pack
+        << ", \"concurrency\": " << r.concurrency
+        << ", \"repeat\": " << r.repeat
+        << ", \"seconds\": " << r.seconds
+        << ", \"cols_per_sec\": " << r.cols_per_sec
+        << ", \"gbytes_per_sec\": " << r.gbytes_per_sec
+        << "}" << (i+1<results.size() ? "," : "") << "\n";
+  }
+  ofs << "]\n";
+}
+
+// Parses files written by write_json (one case per line).
+inline std::vector<Result> read_json (const std::string& filename) {
+  std::ifstream ifs(filename);
+  EKAT_REQUIRE_MSG (ifs.good(), "Error! Could not open baseline file '" + filename + "'.\n");
+
+  // Returns the text following '"key": ' up to the next ',' or '}'
+  auto value = [&](const std::string& line, const std::string& key) -> std::string {
+    const auto tag = "\"" + key + "\": ";
+    const auto pos = line.find(tag);
+    EKAT_REQUIRE_MSG (pos!=std::string::npos,
+        "Error! Missing entry '" + key + "' in baseline file '" + filename + "'.\n");
+    const auto beg = pos + tag.size();
+    const auto end = line.find_first_of(",}",beg);
+    auto s = line.substr(beg,end-beg);
+    s.erase(std::remove(s.begin(),s.end(),'"'),s.end());
+    return s;
+  };
+
+  std::vector<Result> results;
+  std::string line;
+  while (std::getline(ifs,line)) {
+    if (line.find('{')==std::string::npos) {
+      continue;
+    }
+    Result r;
+    r.name           = value(line,"name");
+    r.ncol           = std::stoi(value(line,"ncol"));
+    r.nlev           = std::stoi(value(line,"nlev"));
+    r.pack           = std::stoi(value(line,"pack"));
+    r.concurrency    = std::stoi(value(line,"concurrency"));
+    r.repeat         = std::stoi(value(line,"repeat"));
+    r.seconds        = std::stod(value(line,"seconds"));
+    r.cols_per_sec   = std::stod(value(line,"cols_per_sec"));
+    r.gbytes_per_sec = std::stod(value(line,"gbytes_per_sec"));
+    results.push_back(r);
+  }
+  return results;
+}
+
+// Returns the number of cases whose throughput dropped by more than the
+// relative tolerance tol with respect to the baseline. Cases missing from
+// the baseline are reported, but do not count as regressions.
+inline Int compare (const std::vector<Result>& results,
+                    const std::vector<Result>& baseline,
+                    const double tol)
+{
+  Int nregressions = 0;
+  for (const auto& r : results) {
+    auto it = std::find_if(baseline.begin(),baseline.end(),
+                           [&](const Result& b) { return b.key()==r.key(); });
+    if (it==baseline.end()) {
+      std::cout << "  " << r.key() << ": not in baseline\n";
+      continue;
+    }
+    const double ratio = it->cols_per_sec>0 ? r.cols_per_sec/it->cols_per_sec : 1;
+    const bool regressed = ratio < 1-tol;
+    printf("  %-40s %1.3e cols/s (baseline %1.3e, ratio %5.3f)%s\n",
+           r.key().c_str(), r.cols_per_sec, it->cols_per_sec, ratio,
+           regressed ? " <-- REGRESSION" : "");
+    if (regressed) {
+      ++nregressions;
+    }
+  }
+  return nregressions;
+}
+
+// The implementation the exec was built against. In SCREAM_SMALL_KERNELS builds
+// (e.g., when linking p3_sk/shoc_sk), p3_main/shoc_main dispatch to the *_disp
+// entry points, which launch one kernel per sub-step over all columns.
+inline std::string implementation () {
+#ifdef SCREAM_SMALL_KERNELS
+  return "small kernels (disp)";
+#else
+  return "one kernel per column";
+#endif
+}
+
+// Parses a comma-separated list of ints, e.g. "1,16,256"
+inline std::vector<Int> parse_int_list (const std::string& s) {
+  std::vector<Int> vals;
+  std::stringstream ss(s);
+  std::string item;
+  while (std::getline(ss,item,',')) {
+    if (not item.empty()) {
+      vals.push_back(std::stoi(item));
+    }
+  }
+  EKAT_REQUIRE_MSG (not vals.empty(), "Error! Empty list '" + s + "'.\n");
+  return vals;
+}
+
+} // namespace bench
+} // namespace physics
+} // namespace scream
+
+#endif // SCREAM_PHYSICS_BENCH_UTILS_HPP
@@ -138,6 +138,11 @@ struct P3_Constants
   Scalar p3_dep_nucleation_exponent   = 0.304;
   Scalar p3_ice_sed_knob              = 1.0;
   Scalar p3_d_breakup_cutoff          = 0.00028;
+  // Use one-shot implicit sedimentation (rain and ice) instead of CFL substepping
+  bool   p3_implicit_sedimentation    = false;
+  // Use the tabulated fit of the Murphy-Koop saturation vapor pressure (see
+  // Functions::MurphyKoop_svp_table) for qv_sat in p3_main_part1
+  bool   p3_svp_table                 = false;
 
   void set_p3_from_namelist(ekat::ParameterList &params){
 
@@ -189,6 +194,14 @@ struct P3_Constants
     if(params.isParameter(nname))
        p3_d_breakup_cutoff = params.get<double>(nname);
 
+    nname = "p3_implicit_sedimentation";
+    if(params.isParameter(nname))
+       p3_implicit_sedimentation = params.get<bool>(nname);
+
+    nname = "p3_svp_table";
+    if(params.isParameter(nname))
+       p3_svp_table = params.get<bool>(nname);
+
   };
 
   void print_p3constants(std::shared_ptr<ekat::logger::LoggerBase> logger){
@@ -230,6 +243,12 @@ struct P3_Constants
       nname = "p3_d_breakup_cutoff";
       logger->info(std::string("P3   ") + nname + std::string(" = ") + std::to_string(p3_d_breakup_cutoff));
 
+      nname = "p3_implicit_sedimentation";
+      logger->info(std::string("P3   ") + nname + std::string(" = ") + (p3_implicit_sedimentation ? "true" : "false"));
+
+      nname = "p3_svp_table";
+      logger->info(std::string("P3   ") + nname + std::string(" = ") + (p3_svp_table ? "true" : "false"));
+
       logger->info(" ");
   };
 
@@ -24,7 +24,7 @@ template <typename ScalarT, typename DeviceT>
 struct Functions
 {
 
-  enum SaturationFcn { Polysvp1 = 0, MurphyKoop = 1};
+  enum SaturationFcn { Polysvp1 = 0, MurphyKoop = 1, MurphyKoopTable = 2};
 
   //
   // ------- Types --------
@@ -92,6 +92,16 @@ struct Functions
   KOKKOS_FUNCTION
   static Spack MurphyKoop_svp(const Spack& t, const bool ice, const Smask& range_mask, const char* caller=nullptr);
 
+  //  compute saturation vapor pressure using a piecewise polynomial fit of MurphyKoop_svp.
+  //  The relative difference from MurphyKoop_svp is below 1e-9 for svp_table_tmin <= t and
+  //  t < svp_table_tmax (liquid) or t < Tmelt (ice); elsewhere MurphyKoop_svp is used.
+  //  Much cheaper than MurphyKoop_svp, since it only needs one exp per element.
+  static constexpr Scalar svp_table_tmin = 150;
+  static constexpr Scalar svp_table_tmax = 330;
+  static constexpr Scalar svp_table_dt   = 10;
+  KOKKOS_FUNCTION
+  static Spack MurphyKoop_svp_table(const Spack& t, const bool ice, const Smask& range_mask, const char* caller=nullptr);
+
   // Calls a function to obtain the saturation vapor pressure, and then computes
   // and returns the dry saturation mixing ratio, with respect to either liquid or ice,
   // depending on value of 'ice'
@@ -81,6 +81,96 @@ Functions<S,D>::MurphyKoop_svp(const Spack& t_atm, const bool ice, const Smask&
   return result;
 }
 
+template <typename S, typename D>
+KOKKOS_FUNCTION
+typename Functions<S,D>::Spack
+Functions<S,D>::MurphyKoop_svp_table(const Spack& t_atm, const bool ice, const Smask& range_mask, const char* caller)
+{
+  //First check if the temperature is legitimate or not
+  check_temperature(t_atm, caller ? caller : "MurphyKoop_svp_table", range_mask);
+
+  // Piecewise polynomial fit of log(svp) from MurphyKoop_svp, on intervals of svp_table_dt
+  // degrees starting at svp_table_tmin. Each row holds the monomial coefficients (lowest
+  // order first) of the degree 6 Chebyshev interpolant on one interval, in the variable
+  // x = 2*(T-T_lo)/svp_table_dt - 1, which is in [-1,1] on the interval.
+  // The relative error w.r.t. MurphyKoop_svp is below 1e-9 (7.6e-10 for liquid, 2.3e-11
+  // for ice) in double precision.
+  static constexpr int    ncoeffs   = 7;
+  static constexpr int    nint_ice  = 13; // 150K to 280K
+  static constexpr int    nint_liq  = 18; // 150K to 330K
+  static constexpr Scalar tmin      = svp_table_tmin;
+  static constexpr Scalar dt        = svp_table_dt;
+  static constexpr Scalar tmax_liq  = svp_table_tmax;
+  static constexpr Scalar tmelt     = C::Tmelt;
+
+  static constexpr Scalar ice_coeffs[nint_ice*ncoeffs] = {
+    -1.0696058730776203e+01, 1.2685824428129555e+00, -4.0259761006422271e-02, 1.2789482774427361e-03, -4.0937807460141228e-05, 1.3167932849528253e-06, -4.2344457337354206e-08,
+    -8.3103167796632462e+00, 1.1216783863163473e+00, -3.3472722266707111e-02, 9.9794979757717979e-04, -2.9992806058183013e-05, 9.0580939121866806e-07, -2.7357578297986555e-08,
+    -6.1933198861591565e+00, 9.9887058372998372e-01, -2.8138539943330137e-02, 7.9023312827832405e-04, -2.2382022143472924e-05, 6.3702970970421693e-07, -1.8136816493097285e-08,
+    -4.3021498630800350e+00, 8.9513063159215467e-01, -2.3887441613481997e-02, 6.3398902735991734e-04, -1.6977849319437560e-05, 4.5689537442893460e-07, -1.2302570390992124e-08,
+    -2.6026242416470780e+00, 8.0667973138476434e-01, -2.0457210337884359e-02, 5.1462362738508862e-04, -1.3068297811510578e-05, 3.3350908768518072e-07, -8.5179584021131757e-09,
+    -1.0671755805141474e+00, 7.3063329888569672e-01, -1.7658361602780899e-02, 4.2215363062531584e-04, -1.0192308257130276e-05, 2.4732482985158513e-07, -6.0075052234407974e-09,
+    3.2667926384744234e-01, 6.6475821883191266e-01, -1.5351637214541240e-02, 3.4961353832976258e-04, -8.0444870846193708e-06, 1.8605507233011010e-07, -4.3082174018747662e-09,
+    1.5974630347217633e+00, 6.0730369630389558e-01, -1.3433122633910053e-02, 2.9205619891904314e-04, -6.4183868980295851e-06, 1.4179574005383243e-07, -3.1368454500579901e-09,
+    2.7605760341423276e+00, 5.5688125423804946e-01, -1.1824200610769893e-02, 2.4591090628021668e-04, -5.1718513446477990e-06, 1.0935558623093530e-07, -2.3157821057598731e-09,
+    3.8289296326836082e+00, 5.1237820216962171e-01, -1.0464641943514914e-02, 2.0856237632658773e-04, -4.2053370703192579e-06, 8.5259890859839075e-08, -1.7315276831400946e-09,
+    4.8134313030317166e+00, 4.7289431119080405e-01, -9.3077725761977325e-03, 1.7806927074682204e-04, -3.4480636981827824e-06, 6.7142220811131255e-08, -1.3097698164139209e-09,
+    5.7233602869186964e+00, 4.3769484179630319e-01, -8.3170403756960918e-03, 1.5297270426114536e-04, -2.8489889533237341e-06, 5.3365342510999570e-08, -1.0016399138684002e-09,
+    6.5666616518366823e+00, 4.0617526777012414e-01, -7.4635413974829682e-03, 1.3216387092064352e-04, -2.3708261030565477e-06, 4.2779669893438693e-08, -7.7356381617781668e-10
+  };
+  static constexpr Scalar liq_coeffs[nint_liq*ncoeffs] = {
+    -9.7956237271556432e+00, 1.2307887873932895e+00, -3.9202699395200435e-02, 1.2363093398518785e-03, -3.9184715582507579e-05, 1.2650832665817677e-06, -4.2021259868566367e-08,
+    -7.4815555609345976e+00, 1.0876532337996612e+00, -3.2633652769017703e-02, 9.6715550616817273e-04, -2.8829918232275983e-05, 8.2497156248829163e-07, -3.3553318092214920e-08,
+    -5.4294834896110853e+00, 9.6786147265106359e-01, -2.7464728780947488e-02, 7.6409846999577554e-04, -2.2632305933610394e-05, 4.0215575328381834e-07, -3.8933746639356412e-08,
+    -3.5978584676732530e+00, 8.6647197893098915e-01, -2.3400852168031210e-02, 5.9257623057027244e-04, -2.1099990081501524e-05, -9.6537795368673603e-08, -3.7883751247136388e-08,
+    -1.9541201518225118e+00, 7.7929043848736279e-01, -2.0366538547886393e-02, 4.1591587763739482e-04, -2.3070550701577626e-05, -3.7718132053245910e-08, 7.8747426357494987e-08,
+    -4.7404212264577178e-01, 7.0209427421103077e-01, -1.8400170357272368e-02, 2.5032801423982267e-04, -1.4597188762304520e-05, 2.0990886785289439e-06, 2.2616003533418701e-07,
+    8.5839508315292201e-01, 6.3123585252857994e-01, -1.7037120255057745e-02, 2.4282600852995126e-04, 1.3303473115757112e-05, 2.2594351216613982e-06, -2.9203777466132609e-07,
+    2.0549248064790957e+00, 5.6654176576255588e-01, -1.5165767609559884e-02, 3.8025631617791863e-04, 1.2979792184302547e-05, -2.1292931483192372e-06, -2.1347095519835030e-07,
+    3.1305169188439845e+00, 5.1066073107071208e-01, -1.2769396750979909e-02, 3.8702891221877619e-04, -9.6885142212447098e-06, -1.4102242976511449e-06, 2.1498392247362321e-07,
+    4.1036703187782235e+00, 4.6384445241595279e-01, -1.0743797166554270e-02, 2.8450278889540561e-04, -1.2817174691497663e-05, 4.1318995936050492e-07, 6.2053170982575716e-08,
+    4.9904713506954321e+00, 4.2391484535673346e-01, -9.3018159783470212e-03, 2.0371086643004591e-04, -7.3230423310073026e-06, 4.9801273543742769e-07, -2.2756529866845602e-08,
+    5.8026207236630709e+00, 3.8895305509847383e-01, -8.2212039732897507e-03, 1.6120323970909446e-04, -3.7759959197509422e-06, 2.2404770813298353e-07, -1.8153347777375269e-08,
+    6.5488773108401848e+00, 3.5789658706161931e-01, -7.3305346998824615e-03, 1.3751001945534042e-04, -2.3844750524558222e-06, 7.9726572548706586e-08, -6.9067920906361121e-09,
+    7.2364124233841531e+00, 3.3015347459274480e-01, -6.5577211939114978e-03, 1.2074927110769106e-04, -1.8832261058524376e-06, 3.1577824523136393e-08, -1.9448285521710722e-09,
+    7.8714252495764709e+00, 3.0531352312405119e-01, -5.8762771202033794e-03, 1.0671157747341634e-04, -1.6455322468443356e-06, 1.9343582840498690e-08, -4.1426062580285361e-10,
+      8.4593751472139598e+00, 2.8303777747493425e-01, -5.2740311180021439e-03, 9.4273340323698093e-05, -1.4676873537463765e-06, 1.6959223525489458e-08, -7.8417526440586825e-11,
+      9.0050858194794383e+00, 2.6302731026668702e-01, -4.7422752889937515e-03, 8.3199629991441760e-05, -1.3019027415493513e-06, 1.6221327688299355e-08, -6.4986238612618763e-11,
+      9.5128166201640827e+00, 2.4501622815182342e-01, -4.2730425224394453e-03, 7.3421524724523964e-05, -1.1443127446243902e-06, 1.5207739186355744e-08, -1.0398691431743957e-10
+  };
+
+  const Smask ice_mask = (t_atm < tmelt) && ice;
+  const Smask in_table = (t_atm >= tmin) && ((t_atm < tmax_liq) || ice_mask);
+
+  // Entries outside of the table (or padding) are evaluated at tmin, and
+  // overwritten below, so that the lookup is always in bounds
+  Spack t_tab(tmin);
+  t_tab.set(in_table, t_atm);
+
+  Spack log_svp;
+  for (int s=0; s<Spack::n; ++s) {
+    const Scalar y = (t_tab[s] - tmin) / dt;
+    const int nint = ice_mask[s] ? nint_ice : nint_liq;
+    const int i = ekat::impl::min(static_cast<int>(y), nint-1);
+    const Scalar x = 2*(y - i) - 1;
+    const Scalar* c = (ice_mask[s] ? ice_coeffs : liq_coeffs) + i*ncoeffs;
+    Scalar p = c[ncoeffs-1];
+    for (int j=ncoeffs-2; j>=0; --j) {
+      p = p*x + c[j];
+    }
+    log_svp[s] = p;
+  }
+  Spack result = exp(log_svp);
+
+  // Fall back to the exact formula outside of the table range
+  const Smask outside = !in_table && range_mask;
+  if (outside.any()) {
+    result.set(outside, MurphyKoop_svp(t_atm, ice, range_mask, caller));
+  }
+
+  return result;
+}
+
 template <typename S, typename D>
 KOKKOS_FUNCTION
 typename Functions<S,D>::Spack
@@ -137,7 +227,8 @@ Functions<S,D>::qv_sat_dry(const Spack& t_atm, const Spack& p_atm_dry, const boo
   func_idx is an optional argument to decide which scheme is to be called for saturation vapor pressure
   Currently default is set to "MurphyKoop_svp"
   func_idx = Polysvp1 (=0) --> polysvp1 (Flatau et al. 1992)
-  func_idx = MurphyKoop (=1) --> MurphyKoop_svp (Murphy, D. M., and T. Koop 2005)*/
+  func_idx = MurphyKoop (=1) --> MurphyKoop_svp (Murphy, D. M., and T. Koop 2005)
+  func_idx = MurphyKoopTable (=2) --> MurphyKoop_svp_table (fast fit of MurphyKoop_svp)*/
 
   Spack e_pres; // saturation vapor pressure [Pa]
 
@@ -148,6 +239,9 @@ Functions<S,D>::qv_sat_dry(const Spack& t_atm, const Spack& p_atm_dry, const boo
     case MurphyKoop:
       e_pres = MurphyKoop_svp(t_atm, ice, range_mask, caller);
       break;
+    case MurphyKoopTable:
+      e_pres = MurphyKoop_svp_table(t_atm, ice, range_mask, caller);
+      break;
     default:
       EKAT_KERNEL_ERROR_MSG("Error! Invalid func_idx supplied to qv_sat_dry.");
     }
@@ -171,6 +265,7 @@ Functions<S,D>::qv_sat_wet(const Spack& t_atm, const Spack& p_atm_dry, const boo
   Currently default is set to "MurphyKoop_svp"
   func_idx = Polysvp1 (=0) --> polysvp1 (Flatau et al. 1992)
   func_idx = MurphyKoop (=1) --> MurphyKoop_svp (Murphy, D. M., and T. Koop 2005)
+  func_idx = MurphyKoopTable (=2) --> MurphyKoop_svp_table (fast fit of MurphyKoop_svp)
   dp_wet: pseudo_density
   dp_dry: pseudo_density_dry */
 
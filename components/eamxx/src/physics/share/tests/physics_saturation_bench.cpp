@@ -0,0 +1,141 @@
+#include "physics/share/physics_functions.hpp"
+#include "physics/share/physics_bench_utils.hpp"
+
+#include "share/scream_types.hpp"
+#include "share/scream_session.hpp"
+
+#include "ekat/util/ekat_test_utils.hpp"
+#include "ekat/ekat_assert.hpp"
+
+#include <chrono>
+#include <vector>
+
+namespace {
+using namespace scream;
+namespace bench = scream::physics::bench;
+
+using PF    = scream::physics::Functions<Real, DefaultDevice>;
+using Spack = PF::Spack;
+using Smask = PF::Smask;
+using KT    = KokkosTypes<DefaultDevice>;
+
+/*
+ * physics_saturation_bench times qv_sat_dry with the MurphyKoop and the
+ * MurphyKoopTable saturation functions, for liquid and ice, on n temperatures
+ * spanning the atmospheric range. Results use the same format as p3_bench and
+ * shoc_bench, with ncol being the number of temperatures and nlev=1, so that
+ * cols/s is the number of qv_sat_dry evaluations per second.
+ */
+
+Int run_kernel (const KT::view_1d<Spack>& t, const KT::view_1d<Spack>& qsat,
+                const bool ice, const PF::SaturationFcn func_idx)
+{
+  auto start = std::chrono::steady_clock::now();
+  Kokkos::parallel_for(KT::RangePolicy(0, t.extent_int(0)), KOKKOS_LAMBDA(const Int& k) {
+    qsat(k) = PF::qv_sat_dry(t(k), Spack(1e5), ice, Smask(true), func_idx);
+  });
+  Kokkos::fence();
+  auto finish = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(finish - start).count();
+}
+
+bench::Result run_case (const Int n, const bool ice, const PF::SaturationFcn func_idx,
+                        const Int repeat) {
+  const Int npack = ekat::npack<Spack>(n);
+  KT::view_1d<Spack> t("t",npack), qsat("qsat",npack);
+
+  // Temperatures from 180K to 320K
+  auto t_h = Kokkos::create_mirror_view(t);
+  for (Int i=0; i<npack*Spack::n; ++i) {
+    t_h(i/Spack::n)[i%Spack::n] = 180 + 140*(i%n)/Real(n);
+  }
+  Kokkos::deep_copy(t,t_h);
+
+  Int total_microsec = 0;
+  // r=-1 is the "cold" run, which is not timed
+  for (Int r = -1; r < repeat; ++r) {
+    const Int microsec = run_kernel(t, qsat, ice, func_idx);
+    if (r >= 0) {
+      total_microsec += microsec;
+    }
+  }
+
+  const double seconds = 1e-6*total_microsec / repeat;
+  const double bytes = 2.0*npack*sizeof(Spack);
+  const Int concurrency = Kokkos::DefaultExecutionSpace().concurrency();
+  const std::string name = std::string(func_idx==PF::MurphyKoopTable ? "svp_table" : "svp_mk")
+                         + (ice ? "_ice" : "_liq");
+  return bench::make_result(name, n, 1, SCREAM_SMALL_PACK_SIZE,
+                            concurrency, repeat, seconds, bytes);
+}
+
+void expect_another_arg (int i, int argc) {
+  EKAT_REQUIRE_MSG(i != argc-1, "Expected another cmd-line arg.");
+}
+
+} // namespace anon
+
+int main (int argc, char** argv) {
+  if (argc > 1 && ekat::argv_matches(argv[1], "-h", "--help")) {
+    std::cout <<
+      argv[0] << " [options]\n"
+      "Options:\n"
+      "  -n <npoints>        Comma-separated list of numbers of temperatures. Default=65536,1048576.\n"
+      "  -r <repeat>         Number of timed repetitions per case. Default=10.\n"
+      "  -o <file>           Write results to this JSON file.\n"
+      "  -b <file>           Compare throughput with this JSON baseline file.\n"
+      "  -t <tol>            Relative throughput drop counted as a regression. Default=0.1.\n";
+    return 0;
+  }
+
+  std::vector<Int> npoints = {65536, 1048576};
+  Int repeat = 10;
+  double tol = 0.1;
+  std::string json_fn, baseline_fn;
+  for (int i = 1; i < argc; ++i) {
+    if (ekat::argv_matches(argv[i], "-n", "--npoints")) {
+      expect_another_arg(i, argc);
+      npoints = bench::parse_int_list(argv[++i]);
+    }
+    if (ekat::argv_matches(argv[i], "-r", "--repeat")) {
+      expect_another_arg(i, argc);
+      repeat = std::atoi(argv[++i]);
+      EKAT_REQUIRE_MSG(repeat > 0, "Repeat must be positive");
+    }
+    if (ekat::argv_matches(argv[i], "-o", "--output")) {
+      expect_another_arg(i, argc);
+      json_fn = argv[++i];
+    }
+    if (ekat::argv_matches(argv[i], "-b", "--baseline-file")) {
+      expect_another_arg(i, argc);
+      baseline_fn = argv[++i];
+    }
+    if (ekat::argv_matches(argv[i], "-t", "--tol")) {
+      expect_another_arg(i, argc);
+      tol = std::atof(argv[++i]);
+    }
+  }
+
+  Int nregressions = 0;
+  scream::initialize_scream_session(argc, argv); {
+    std::vector<bench::Result> results;
+    for (const auto n : npoints) {
+      for (const bool ice : {false, true}) {
+        for (const auto func_idx : {PF::MurphyKoop, PF::MurphyKoopTable}) {
+          results.push_back(run_case(n, ice, func_idx, repeat));
+          bench::print(results.back());
+        }
+      }
+    }
+
+    if (json_fn != "") {
+      bench::write_json(json_fn, results);
+    }
+    if (baseline_fn != "") {
+      std::cout << "Comparing with " << baseline_fn << " at tol " << tol << "\n";
+      nregressions = bench::compare(results, bench::read_json(baseline_fn), tol);
+    }
+  } scream::finalize_scream_session();
+
+  return nregressions != 0 ? 1 : 0;
+}
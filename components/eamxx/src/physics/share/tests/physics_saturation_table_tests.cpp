@@ -0,0 +1,100 @@
+#include "catch2/catch.hpp"
+
+#include "physics/share/physics_functions.hpp"
+#include "physics_unit_tests_common.hpp"
+
+#include "share/scream_types.hpp"
+
+#include "ekat/ekat_pack.hpp"
+#include "ekat/kokkos/ekat_kokkos_utils.hpp"
+
+namespace scream {
+namespace physics {
+namespace unit_test {
+
+template <typename D>
+struct UnitWrap::UnitTest<D>::TestSaturationTable
+{
+  // Evaluates MurphyKoop_svp and MurphyKoop_svp_table, as well as qv_sat_dry with
+  // MurphyKoop and MurphyKoopTable, at the temperatures in t (all at pressure p)
+  static void compute (const view_1d<Spack>& t, const Scalar p, const bool ice,
+                       const view_1d<Spack>& svp, const view_1d<Spack>& svp_tab,
+                       const view_1d<Spack>& qsat, const view_1d<Spack>& qsat_tab)
+  {
+    using physics = scream::physics::Functions<Scalar, Device>;
+
+    Kokkos::parallel_for(RangePolicy(0, t.extent_int(0)), KOKKOS_LAMBDA(const Int& k) {
+      const Smask range_mask(true);
+      const Spack pres(p);
+      svp(k)      = physics::MurphyKoop_svp(t(k), ice, range_mask);
+      svp_tab(k)  = physics::MurphyKoop_svp_table(t(k), ice, range_mask);
+      qsat(k)     = physics::qv_sat_dry(t(k), pres, ice, range_mask, physics::MurphyKoop);
+      qsat_tab(k) = physics::qv_sat_dry(t(k), pres, ice, range_mask, physics::MurphyKoopTable);
+    });
+    Kokkos::fence();
+  }
+
+  static void run ()
+  {
+    using physics = scream::physics::Functions<Scalar, Device>;
+
+    // Sweep the table range (and a bit outside of it) with a spacing that does not
+    // align with the table intervals
+    constexpr Scalar tlo = 100, thi = 350, dt = 0.0137;
+    const Int n = static_cast<Int>((thi-tlo)/dt);
+    const Int npack = ekat::npack<Spack>(n);
+
+    view_1d<Spack> t("t",npack), svp("svp",npack), svp_tab("svp_tab",npack),
+                   qsat("qsat",npack), qsat_tab("qsat_tab",npack);
+    auto t_h = Kokkos::create_mirror_view(t);
+    for (Int i=0; i<npack*Spack::n; ++i) {
+      t_h(i/Spack::n)[i%Spack::n] = tlo + std::min(i,n-1)*dt;
+    }
+    Kokkos::deep_copy(t,t_h);
+
+    // The fit has a relative error below 1e-9; in single precision, the rounding
+    // errors of both functions dominate
+    const Scalar tol = std::max(Scalar(1e-9), 1000*C::macheps);
+
+    for (const bool ice : {false, true}) {
+      compute(t, 1e5, ice, svp, svp_tab, qsat, qsat_tab);
+      const auto svp_h      = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), svp);
+      const auto svp_tab_h  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), svp_tab);
+      const auto qsat_h     = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), qsat);
+      const auto qsat_tab_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), qsat_tab);
+
+      Scalar max_err = 0;
+      for (Int i=0; i<n; ++i) {
+        const Int ip = i / Spack::n, iv = i % Spack::n;
+        const Scalar temp = t_h(ip)[iv];
+        const Scalar ref = svp_h(ip)[iv];
+        const Scalar val = svp_tab_h(ip)[iv];
+        REQUIRE(val > 0);
+
+        const bool in_table = temp >= physics::svp_table_tmin && (temp < physics::svp_table_tmax || (ice && temp < C::Tmelt));
+        if (in_table) {
+          max_err = std::max(max_err, std::abs(val-ref)/ref);
+          REQUIRE(std::abs(qsat_tab_h(ip)[iv]-qsat_h(ip)[iv]) <= tol*qsat_h(ip)[iv]);
+        } else {
+          // Outside of the table, the exact formula is used
+          REQUIRE(val == ref);
+          REQUIRE(qsat_tab_h(ip)[iv] == qsat_h(ip)[iv]);
+        }
+      }
+      REQUIRE(max_err <= tol);
+    }
+  }
+};
+
+} // namespace unit_test
+} // namespace physics
+} // namespace scream
+
+namespace {
+
+TEST_CASE("physics_saturation_table", "[physics_saturation]")
+{
+  scream::physics::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestSaturationTable::run();
+}
+
+} // namespace
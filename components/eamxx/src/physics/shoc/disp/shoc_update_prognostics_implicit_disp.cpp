@@ -31,7 +31,8 @@ void Functions<Real,DefaultDevice>
   const view_3d<Spack>&        tracer,
   const view_2d<Spack>&        tke,
   const view_2d<Spack>&        u_wind,
-  const view_2d<Spack>&        v_wind)
+  const view_2d<Spack>&        v_wind,
+  const Int&                   tridiag_solver)
 {
   using ExeSpace = typename KT::ExeSpace;
 
@@ -61,7 +62,8 @@ void Functions<Real,DefaultDevice>
                                 ekat::subview(tracer, i),
                                 ekat::subview(tke, i),
                                 ekat::subview(u_wind, i),
-                                ekat::subview(v_wind, i));
+                                ekat::subview(v_wind, i),
+                                tridiag_solver);
   });
 }
 
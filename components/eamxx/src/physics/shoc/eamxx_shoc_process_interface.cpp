@@ -140,7 +140,7 @@ size_t SHOCMacrophysics::requested_buffer_size_in_bytes() const
   const auto policy       = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nlev_packs);
   const int n_wind_slots  = ekat::npack<Spack>(2)*Spack::n;
   const int n_trac_slots  = ekat::npack<Spack>(m_num_tracers+3)*Spack::n;
-  const size_t wsm_request= WSM::get_total_bytes_needed(nlevi_packs, 14+(n_wind_slots+n_trac_slots), policy);
+  const size_t wsm_request= WSM::get_total_bytes_needed(nlevi_packs, SHF::num_workspace_slots+(n_wind_slots+n_trac_slots), policy);
 
   return interface_request + wsm_request;
 }
@@ -216,7 +216,7 @@ void SHOCMacrophysics::init_buffers(const ATMBufferManager &buffer_manager)
   const auto policy      = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nlev_packs);
   const int n_wind_slots = ekat::npack<Spack>(2)*Spack::n;
   const int n_trac_slots = ekat::npack<Spack>(m_num_tracers+3)*Spack::n;
-  const int wsm_size     = WSM::get_total_bytes_needed(nlevi_packs, 14+(n_wind_slots+n_trac_slots), policy)/sizeof(Spack);
+  const int wsm_size     = WSM::get_total_bytes_needed(nlevi_packs, SHF::num_workspace_slots+(n_wind_slots+n_trac_slots), policy)/sizeof(Spack);
   s_mem += wsm_size;
 
   size_t used_mem = (reinterpret_cast<Real*>(s_mem) - buffer_manager.get_memory())*sizeof(Real);
@@ -239,6 +239,30 @@ void SHOCMacrophysics::initialize_impl (const RunType run_type)
   runtime_options.c_diag_3rd_mom = m_params.get<double>("c_diag_3rd_mom");
   runtime_options.Ckh           = m_params.get<double>("Ckh");
   runtime_options.Ckm           = m_params.get<double>("Ckm");
+
+  // Tridiagonal solver for the implicit diffusion. With "auto", time the available
+  // solvers on our problem size, and pick the fastest. To make sure all ranks use the
+  // same solver, the choice made on the root rank is broadcast.
+  const auto tridiag_solver = m_params.get<std::string>("tridiag_solver","default");
+  if (tridiag_solver=="auto") {
+    Int solver = SHF::tune_tridiag_solver(m_num_cols, m_num_levs, m_num_tracers+3);
+    m_comm.broadcast(&solver,1,m_comm.root_rank());
+    runtime_options.tridiag_solver = solver;
+  } else if (tridiag_solver=="default") {
+    runtime_options.tridiag_solver = SHF::tridiag_default;
+  } else if (tridiag_solver=="bfb") {
+    runtime_options.tridiag_solver = SHF::tridiag_bfb;
+  } else if (tridiag_solver=="cr") {
+    runtime_options.tridiag_solver = SHF::tridiag_cr;
+  } else if (tridiag_solver=="thomas") {
+    runtime_options.tridiag_solver = SHF::tridiag_thomas;
+  } else {
+    EKAT_ERROR_MSG ("Error! Invalid value for tridiag_solver: '" + tridiag_solver + "'.\n"
+                    "       Valid values are: default, auto, bfb, cr, thomas.\n");
+  }
+  m_atm_logger->info("[EAMxx::shoc] tridiagonal solver: "
+                     + SHF::tridiag_solver_name(runtime_options.tridiag_solver)
+                     + (tridiag_solver=="auto" ? " (auto-tuned)" : ""));
   // Initialize all of the structures that are passed to shoc_main in run_impl.
   // Note: Some variables in the structures are not stored in the field manager.  For these
   //       variables a local view is constructed.
@@ -407,7 +431,7 @@ void SHOCMacrophysics::initialize_impl (const RunType run_type)
   const int n_wind_slots = ekat::npack<Spack>(2)*Spack::n;
   const int n_trac_slots = ekat::npack<Spack>(m_num_tracers+3)*Spack::n;
   const auto default_policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nlev_packs);
-  workspace_mgr.setup(m_buffer.wsm_data, nlevi_packs, 14+(n_wind_slots+n_trac_slots), default_policy);
+  workspace_mgr.setup(m_buffer.wsm_data, nlevi_packs, SHF::num_workspace_slots+(n_wind_slots+n_trac_slots), default_policy);
 
   // Calculate pref_mid, and use that to calculate
   // maximum number of levels in pbl from surface
@@ -463,7 +487,6 @@ void SHOCMacrophysics::run_impl (const double dt)
   Kokkos::parallel_for("shoc_preprocess",
                        scan_policy,
                        shoc_preprocess);
-  Kokkos::fence();
 
   if (m_params.get<bool>("apply_tms", false)) {
     apply_turbulent_mountain_stress();
@@ -494,7 +517,11 @@ void SHOCMacrophysics::run_impl (const double dt)
   Kokkos::parallel_for("shoc_postprocess",
                        default_policy,
                        shoc_postprocess);
-  Kokkos::fence();
+
+  // NOTE: no fence here (nor in shoc_main). All SHOC kernels run on the default
+  //       execution space instance, so they are ordered w.r.t. each other and to
+  //       the kernels of the next process, while host accesses to our outputs
+  //       go through deep copies, which fence anyway.
 }
 // =========================================================================================
 void SHOCMacrophysics::finalize_impl()
@@ -85,6 +85,7 @@ void Functions<S,D>::shoc_main_internal(
   const Scalar&                c_diag_3rd_mom,
   const Scalar&                Ckh,
   const Scalar&                Ckm,
+  const Int&                   tridiag_solver,
   // Input Variables
   const Scalar&                dx,
   const Scalar&                dy,
@@ -139,11 +140,21 @@ void Functions<S,D>::shoc_main_internal(
   const uview_1d<Spack>&       isotropy)
 {
 
-  // Define temporary variables
-  uview_1d<Spack> rho_zt, shoc_qv, shoc_tabs, dz_zt, dz_zi;
-  workspace.template take_many_and_reset<5>(
-    {"rho_zt", "shoc_qv", "shoc_tabs", "dz_zt", "dz_zi"},
-    {&rho_zt, &shoc_qv, &shoc_tabs, &dz_zt, &dz_zi});
+  // Define temporary variables. These are used by every routine of every
+  // substep, so they live in team scratch (see shoc_main_scratch_bytes)
+  // rather than in the workspace.
+  const Int nlevi_packs = ekat::npack<Spack>(nlevi);
+  auto scratch = reinterpret_cast<Spack*>(
+    team.team_scratch(0).get_shmem_aligned(num_scratch_arrays*nlevi_packs*sizeof(Spack), alignof(Spack)));
+  const uview_1d<Spack> rho_zt   (scratch + 0*nlevi_packs, nlevi_packs),
+                        shoc_qv  (scratch + 1*nlevi_packs, nlevi_packs),
+                        shoc_tabs(scratch + 2*nlevi_packs, nlevi_packs),
+                        dz_zt    (scratch + 3*nlevi_packs, nlevi_packs),
+                        dz_zi    (scratch + 4*nlevi_packs, nlevi_packs);
+  Kokkos::parallel_for(Kokkos::TeamVectorRange(team, num_scratch_arrays*nlevi_packs), [&] (const Int& k) {
+    scratch[k] = 0;
+  });
+  team.team_barrier();
 
   // Local scalars
   Scalar se_b{0},   ke_b{0},   wv_b{0}, wl_b{0},
@@ -162,19 +173,20 @@ void Functions<S,D>::shoc_main_internal(
   shoc_energy_integrals(team,nlev,host_dse,pdel,qw,shoc_ql,u_wind,v_wind, // Input
                         se_b,ke_b,wv_b,wl_b);                             // Output
 
+  // Define vertical grid arrays needed for
+  // vertical derivatives in SHOC, also
+  // define air density (rho_zt). The inputs
+  // do not change across substeps.
+  shoc_grid(team,nlev,nlevi,      // Input
+            zt_grid,zi_grid,pdel, // Input
+            dz_zt,dz_zi,rho_zt);  // Output
+
   for (Int t=0; t<nadv; ++t) {
     // Check TKE to make sure values lie within acceptable
     // bounds after host model performs horizontal advection
     check_tke(team,nlev, // Input
               tke);      // Input/Output
 
-    // Define vertical grid arrays needed for
-    // vertical derivatives in SHOC, also
-    // define air density (rho_zt)
-    shoc_grid(team,nlev,nlevi,      // Input
-              zt_grid,zi_grid,pdel, // Input
-              dz_zt,dz_zi,rho_zt);  // Output
-
     // Compute the planetary boundary layer height, which is an
     // input needed for the length scale calculation.
 
@@ -232,7 +244,8 @@ void Functions<S,D>::shoc_main_internal(
                                 dz_zi,rho_zt,zt_grid,zi_grid,tk,tkh,uw_sfc, // Input
                                 vw_sfc,wthl_sfc,wqw_sfc,wtracer_sfc,        // Input
                                 workspace,                                  // Workspace
-                                thetal,qw,qtracers,tke,u_wind,v_wind);   // Input/Output
+                                thetal,qw,qtracers,tke,u_wind,v_wind,       // Input/Output
+                                tridiag_solver);                            // Runtime options
 
     // Diagnose the second order moments
     diag_second_shoc_moments(team,nlev,nlevi,
@@ -312,10 +325,6 @@ void Functions<S,D>::shoc_main_internal(
           kbfs,shoc_cldfrac,              // Input
           workspace,                      // Workspace
           pblh);                          // Output
-
-  // Release temporary variables from the workspace
-  workspace.template release_many_contiguous<5>(
-    {&rho_zt, &shoc_qv, &shoc_tabs, &dz_zt, &dz_zi});
 }
 #else
 template<typename S, typename D>
@@ -340,6 +349,7 @@ void Functions<S,D>::shoc_main_internal(
   const Scalar&                c_diag_3rd_mom,
   const Scalar&                Ckh,
   const Scalar&                Ckm,
+  const Int&                   tridiag_solver,
   // Input Variables
   const view_1d<const Scalar>& dx,
   const view_1d<const Scalar>& dy,
@@ -422,19 +432,20 @@ void Functions<S,D>::shoc_main_internal(
   shoc_energy_integrals_disp(shcol,nlev,host_dse,pdel,qw,shoc_ql,u_wind,v_wind,
                              se_b, ke_b, wv_b, wl_b); // Input
 
+  // Define vertical grid arrays needed for
+  // vertical derivatives in SHOC, also
+  // define air density (rho_zt). The inputs
+  // do not change across substeps.
+  shoc_grid_disp(shcol,nlev,nlevi,      // Input
+                 zt_grid,zi_grid,pdel, // Input
+                 dz_zt,dz_zi,rho_zt);  // Output
+
   for (Int t=0; t<nadv; ++t) {
     // Check TKE to make sure values lie within acceptable
     // bounds after host model performs horizontal advection
     check_tke_disp(shcol,nlev, // Input
                    tke);      // Input/Output
 
-    // Define vertical grid arrays needed for
-    // vertical derivatives in SHOC, also
-    // define air density (rho_zt)
-    shoc_grid_disp(shcol,nlev,nlevi,      // Input
-                   zt_grid,zi_grid,pdel, // Input
-                   dz_zt,dz_zi,rho_zt);  // Output
-
     // Compute the planetary boundary layer height, which is an
     // input needed for the length scale calculation.
 
@@ -491,7 +502,8 @@ void Functions<S,D>::shoc_main_internal(
                                      dz_zi,rho_zt,zt_grid,zi_grid,tk,tkh,uw_sfc, // Input
                                      vw_sfc,wthl_sfc,wqw_sfc,wtracer_sfc,        // Input
                                      workspace_mgr,                              // Workspace mgr
-                                     thetal,qw,qtracers,tke,u_wind,v_wind);      // Input/Output
+                                     thetal,qw,qtracers,tke,u_wind,v_wind,       // Input/Output
+                                     tridiag_solver);                            // Runtime options
 
     // Diagnose the second order moments
     diag_second_shoc_moments_disp(shcol,nlev,nlevi,
@@ -591,7 +603,9 @@ Int Functions<S,D>::shoc_main(
 #endif
                               )
 {
-  // Start timer
+  // Start timer. Note: we do not fence at the end, so that SHOC can be
+  // enqueued together with the processes that come before/after it. The
+  // returned time is therefore only the launch time on async backends.
   auto start = std::chrono::steady_clock::now();
 
   // Runtime options
@@ -607,13 +621,15 @@ Int Functions<S,D>::shoc_main(
   const Scalar c_diag_3rd_mom = shoc_runtime.c_diag_3rd_mom;
   const Scalar Ckh           = shoc_runtime.Ckh;
   const Scalar Ckm           = shoc_runtime.Ckm;
+  const Int    tridiag_solver = shoc_runtime.tridiag_solver;
 
 #ifndef SCREAM_SMALL_KERNELS
   using ExeSpace = typename KT::ExeSpace;
 
   // SHOC main loop
   const auto nlev_packs = ekat::npack<Spack>(nlev);
-  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(shcol, nlev_packs);
+  auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(shcol, nlev_packs);
+  policy.set_scratch_size(0, Kokkos::PerTeam(shoc_main_scratch_bytes(nlevi)));
   Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
     const Int i = team.league_rank();
 
@@ -671,7 +687,7 @@ Int Functions<S,D>::shoc_main(
     shoc_main_internal(team, nlev, nlevi, npbl, nadv, num_qtracers, dtime,
 	               lambda_low, lambda_high, lambda_slope, lambda_thresh,  // Runtime options
                        thl2tune, qw2tune, qwthl2tune, w2tune, length_fac,     // Runtime options
-                       c_diag_3rd_mom, Ckh, Ckm,                              // Runtime options
+                       c_diag_3rd_mom, Ckh, Ckm, tridiag_solver,              // Runtime options
                        dx_s, dy_s, zt_grid_s, zi_grid_s,                      // Input
                        pres_s, presi_s, pdel_s, thv_s, w_field_s,             // Input
                        wthl_sfc_s, wqw_sfc_s, uw_sfc_s, vw_sfc_s,             // Input
@@ -689,7 +705,6 @@ Int Functions<S,D>::shoc_main(
     shoc_output.ustar(i) = ustar_s;
     shoc_output.obklen(i) = obklen_s;
   });
-  Kokkos::fence();
 #else
   const auto u_wind_s   = Kokkos::subview(shoc_input_output.horiz_wind, Kokkos::ALL(), 0, Kokkos::ALL());
   const auto v_wind_s   = Kokkos::subview(shoc_input_output.horiz_wind, Kokkos::ALL(), 1, Kokkos::ALL());
@@ -697,7 +712,7 @@ Int Functions<S,D>::shoc_main(
   shoc_main_internal(shcol, nlev, nlevi, npbl, nadv, num_qtracers, dtime,
     lambda_low, lambda_high, lambda_slope, lambda_thresh,  // Runtime options
     thl2tune, qw2tune, qwthl2tune, w2tune, length_fac,     // Runtime options
-    c_diag_3rd_mom, Ckh, Ckm,                              // Runtime options
+    c_diag_3rd_mom, Ckh, Ckm, tridiag_solver,              // Runtime options
     shoc_input.dx, shoc_input.dy, shoc_input.zt_grid, shoc_input.zi_grid, // Input
     shoc_input.pres, shoc_input.presi, shoc_input.pdel, shoc_input.thv, shoc_input.w_field, // Input
     shoc_input.wthl_sfc, shoc_input.wqw_sfc, shoc_input.uw_sfc, shoc_input.vw_sfc, // Input
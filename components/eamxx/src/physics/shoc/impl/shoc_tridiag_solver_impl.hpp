@@ -4,6 +4,9 @@
 #include "shoc_functions.hpp" // for ETI only but harmless for GPU
 #include "ekat/util/ekat_tridiag.hpp"
 
+#include <chrono>
+#include <limits>
+
 namespace scream {
 namespace shoc {
 
@@ -81,18 +84,116 @@ void Functions<S,D>::vd_shoc_solve(
   const uview_1d<Scalar>& du,
   const uview_1d<Scalar>& dl,
   const uview_1d<Scalar>& d,
-  const uview_2d<Spack>&  var)
+  const uview_2d<Spack>&  var,
+  const Int&              solver)
 {
+  switch (solver) {
+    case tridiag_bfb:
+      ekat::tridiag::bfb(team, dl, d, du, var);
+      break;
+    case tridiag_cr:
+      ekat::tridiag::cr(team, dl, d, du, ekat::scalarize(var));
+      break;
+    case tridiag_thomas:
+    {
+      const auto f = [&] () { ekat::tridiag::thomas(dl, d, du, var); };
+      Kokkos::single(Kokkos::PerTeam(team), f);
+      break;
+    }
+    default:
 #ifdef EKAT_DEFAULT_BFB
-  ekat::tridiag::bfb(team, dl, d, du, var);
+      ekat::tridiag::bfb(team, dl, d, du, var);
 #else
 #ifdef EAMXX_ENABLE_GPU
-  ekat::tridiag::cr(team, dl, d, du, ekat::scalarize(var));
+      ekat::tridiag::cr(team, dl, d, du, ekat::scalarize(var));
 #else
-  const auto f = [&] () { ekat::tridiag::thomas(dl, d, du, var); };
-  Kokkos::single(Kokkos::PerTeam(team), f);
+      const auto f = [&] () { ekat::tridiag::thomas(dl, d, du, var); };
+      Kokkos::single(Kokkos::PerTeam(team), f);
 #endif
 #endif
+  }
+}
+
+template<typename S, typename D>
+Int Functions<S,D>::tune_tridiag_solver(
+  const Int& shcol,
+  const Int& nlev,
+  const Int& num_rhs,
+  const Int& ntrials)
+{
+#ifdef EKAT_DEFAULT_BFB
+  // Only the bfb solver gives the same answers on all architectures
+  (void) shcol; (void) nlev; (void) num_rhs; (void) ntrials;
+  return tridiag_bfb;
+#else
+  using ExeSpace = typename KT::ExeSpace;
+
+  // Same layout as the solves in update_prognostics_implicit
+  const Int nlev_packs = ekat::npack<Spack>(nlev);
+  const Int nrhs_packs = ekat::npack<Spack>(num_rhs);
+  view_2d<Scalar> du("du", shcol, nlev), dl("dl", shcol, nlev), d("d", shcol, nlev);
+  view_3d<Spack> rhs("rhs", shcol, nlev, nrhs_packs);
+
+  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(shcol, nlev_packs);
+
+  Int best = tridiag_default;
+  double best_time = std::numeric_limits<double>::max();
+  for (const Int solver : {tridiag_cr, tridiag_thomas}) {
+    double time = 0;
+    // Trial -1 is a warm up, and is not timed
+    for (Int trial = -1; trial < ntrials; ++trial) {
+      Kokkos::fence();
+      const auto start = std::chrono::steady_clock::now();
+      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+        const Int i = team.league_rank();
+        const auto du_i  = ekat::subview(du, i);
+        const auto dl_i  = ekat::subview(dl, i);
+        const auto d_i   = ekat::subview(d, i);
+        const auto rhs_i = Kokkos::subview(rhs, i, Kokkos::ALL(), Kokkos::ALL());
+
+        // The solvers overwrite their inputs, so reset a diagonally dominant
+        // system (like the diffusion one) every time.
+        Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlev), [&] (const Int& k) {
+          du_i(k) = k == nlev-1 ? 0 : -0.5;
+          dl_i(k) = k == 0 ? 0 : -0.5;
+          d_i(k)  = 2;
+          for (Int p = 0; p < nrhs_packs; ++p) {
+            rhs_i(k, p) = 1;
+          }
+        });
+        team.team_barrier();
+
+        vd_shoc_solve(team, du_i, dl_i, d_i, rhs_i, solver);
+      });
+      Kokkos::fence();
+      const auto finish = std::chrono::steady_clock::now();
+      if (trial >= 0) {
+        time += std::chrono::duration<double>(finish - start).count();
+      }
+    }
+
+    if (time < best_time) {
+      best_time = time;
+      best = solver;
+    }
+  }
+
+  return best;
+#endif
+}
+
+template<typename S, typename D>
+std::string Functions<S,D>::tridiag_solver_name(const Int& solver)
+{
+  switch (solver) {
+    case tridiag_default: return "default";
+    case tridiag_bfb:     return "bfb";
+    case tridiag_cr:      return "cr";
+    case tridiag_thomas:  return "thomas";
+    default:
+      EKAT_ERROR_MSG("Error! Invalid tridiagonal solver " + std::to_string(solver) + ".\n");
+  }
+  return "";
 }
 
 } // namespace shoc
@@ -37,7 +37,8 @@ void Functions<S,D>::update_prognostics_implicit(
   const uview_2d<Spack>&       qtracers,
   const uview_1d<Spack>&       tke,
   const uview_1d<Spack>&       u_wind,
-  const uview_1d<Spack>&       v_wind)
+  const uview_1d<Spack>&       v_wind,
+  const Int&                   tridiag_solver)
 {
   // Define temporary variables via the WorkspaceManager
 
@@ -167,7 +168,7 @@ void Functions<S,D>::update_prognostics_implicit(
 
     // Solve
     team.team_barrier();
-    vd_shoc_solve(team, du, dl, d, wind_rhs);
+    vd_shoc_solve(team, du, dl, d, wind_rhs, tridiag_solver);
   }
 
   // march temperature, total water, tke,and tracers one step forward using implicit solver
@@ -179,7 +180,7 @@ void Functions<S,D>::update_prognostics_implicit(
 
     // Solve
     team.team_barrier();
-    vd_shoc_solve(team, du, dl, d, qtracers_rhs);
+    vd_shoc_solve(team, du, dl, d, qtracers_rhs, tridiag_solver);
   }
 
   // Copy RHS values back into output variables
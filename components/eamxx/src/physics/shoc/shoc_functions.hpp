@@ -9,6 +9,8 @@
 #include "ekat/ekat_pack_kokkos.hpp"
 #include "ekat/ekat_workspace.hpp"
 
+#include <string>
+
 namespace scream {
 namespace shoc {
 
@@ -69,6 +71,16 @@ struct Functions
   using WorkspaceMgr = typename ekat::WorkspaceManager<Spack,  Device>;
   using Workspace    = typename WorkspaceMgr::Workspace;
 
+  // Tridiagonal solvers that can be used for the implicit diffusion in
+  // update_prognostics_implicit. tridiag_default is the build-dependent
+  // choice (bfb if EKAT_DEFAULT_BFB, cr on GPU, thomas otherwise).
+  enum TridiagSolver : Int {
+    tridiag_default = 0,
+    tridiag_bfb,
+    tridiag_cr,
+    tridiag_thomas
+  };
+
   // This struct stores runtime options for shoc_main
  struct SHOCRuntime {
    SHOCRuntime() = default;
@@ -85,6 +97,8 @@ struct Functions
    Scalar c_diag_3rd_mom;
    Scalar Ckh;
    Scalar Ckm;
+   // Tridiagonal solver for the implicit diffusion (see TridiagSolver)
+   Int tridiag_solver = tridiag_default;
  };
 
   // This struct stores input views for shoc_main.
@@ -649,7 +663,8 @@ struct Functions
     const uview_2d<Spack>&       tracer,
     const uview_1d<Spack>&       tke,
     const uview_1d<Spack>&       u_wind,
-    const uview_1d<Spack>&       v_wind);
+    const uview_1d<Spack>&       v_wind,
+    const Int&                   tridiag_solver = tridiag_default);
 #ifdef SCREAM_SMALL_KERNELS
   static void update_prognostics_implicit_disp(
     const Int&                   shcol,
@@ -675,7 +690,8 @@ struct Functions
     const view_3d<Spack>&        tracer,
     const view_2d<Spack>&        tke,
     const view_2d<Spack>&        u_wind,
-    const view_2d<Spack>&        v_wind);
+    const view_2d<Spack>&        v_wind,
+    const Int&                   tridiag_solver = tridiag_default);
 #endif
 
   KOKKOS_FUNCTION
@@ -983,7 +999,22 @@ struct Functions
     const Int&                  ntop_shoc,
     const view_1d<const Spack>& pref_mid);
 
+  // Number of workspace slots needed by shoc_main, besides the wind and tracers
+  // macro blocks of update_prognostics_implicit. The rho_zt, shoc_qv, shoc_tabs,
+  // dz_zt and dz_zi arrays are not in the workspace: they are in team scratch
+  // (see shoc_main_scratch_bytes), or in SHOCTemporaries for small kernels.
+  static constexpr int num_workspace_slots = 9;
+
 #ifndef SCREAM_SMALL_KERNELS
+  // Number of level arrays that shoc_main_internal keeps in team scratch
+  static constexpr int num_scratch_arrays = 5;
+
+  // Bytes of (level 0) team scratch needed by shoc_main_internal. The extra
+  // Spack is for the alignment of the scratch pointer.
+  static size_t shoc_main_scratch_bytes(const Int& nlevi) {
+    return (num_scratch_arrays*ekat::npack<Spack>(nlevi) + 1)*sizeof(Spack);
+  }
+
   KOKKOS_FUNCTION
   static void shoc_main_internal(
     const MemberType&            team,
@@ -1006,6 +1037,7 @@ struct Functions
     const Scalar&                c_diag_3rd_mom,
     const Scalar&                Ckh,
     const Scalar&                Ckm,
+    const Int&                   tridiag_solver,
     // Input Variables
     const Scalar&                host_dx,
     const Scalar&                host_dy,
@@ -1080,6 +1112,7 @@ struct Functions
     const Scalar&                c_diag_3rd_mom,
     const Scalar&                Ckh,
     const Scalar&                Ckm,
+    const Int&                   tridiag_solver,
     // Input Variables
     const view_1d<const Scalar>& host_dx,
     const view_1d<const Scalar>& host_dy,
@@ -1151,7 +1184,9 @@ struct Functions
     const view_2d<Spack>& dz_zi);
 #endif
 
-  // Return microseconds elapsed
+  // Return microseconds elapsed. The kernels are NOT fenced, so on async
+  // backends this is only the launch time; to time the kernels, fence
+  // before and after the call (see shoc_main_f).
   static Int shoc_main(
     const Int&               shcol,                // Number of SHOC columns in the array
     const Int&               nlev,                 // Number of levels
@@ -1205,7 +1240,21 @@ struct Functions
     const uview_1d<Scalar>& du,
     const uview_1d<Scalar>& dl,
     const uview_1d<Scalar>& d,
-    const uview_2d<Spack>&  var);
+    const uview_2d<Spack>&  var,
+    const Int&              solver = tridiag_default);
+
+  // Times each non-BFB tridiagonal solver on systems of the size SHOC solves
+  // (nlev rows, num_rhs right hand sides) with the team policy SHOC uses for
+  // shcol columns, and returns the fastest one. If the build is BFB
+  // (EKAT_DEFAULT_BFB), returns tridiag_bfb without timing anything.
+  static Int tune_tridiag_solver(
+    const Int& shcol,
+    const Int& nlev,
+    const Int& num_rhs,
+    const Int& ntrials = 5);
+
+  // Name of a TridiagSolver value, for logging
+  static std::string tridiag_solver_name(const Int& solver);
 
   KOKKOS_FUNCTION
   static void pblintd_surf_temp(const Int& nlev, const Int& nlevi, const Int& npbl,
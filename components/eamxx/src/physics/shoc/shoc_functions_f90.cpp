@@ -9,6 +9,7 @@
 
 #include "share/util/scream_deep_copy.hpp"
 
+#include <chrono>
 #include <random>
 
 using scream::Real;
@@ -2918,15 +2919,21 @@ Int shoc_main_f(Int shcol, Int nlev, Int nlevi, Real dtime, Int nadv, Int npbl,
   // Create local workspace
   const int n_wind_slots = ekat::npack<Spack>(2)*Spack::n;
   const int n_trac_slots = ekat::npack<Spack>(num_qtracers+3)*Spack::n;
-  ekat::WorkspaceManager<Spack, SHF::KT::Device> workspace_mgr(nlevi_packs, 14+(n_wind_slots+n_trac_slots), policy);
-
-  const auto elapsed_microsec = SHF::shoc_main(shcol, nlev, nlevi, npbl, nadv, num_qtracers, dtime,
-                                               workspace_mgr, shoc_runtime_options,
-                                               shoc_input, shoc_input_output, shoc_output, shoc_history_output
+  ekat::WorkspaceManager<Spack, SHF::KT::Device> workspace_mgr(nlevi_packs, SHF::num_workspace_slots+(n_wind_slots+n_trac_slots), policy);
+
+  // shoc_main does not fence, so time it here
+  Kokkos::fence();
+  auto start = std::chrono::steady_clock::now();
+  SHF::shoc_main(shcol, nlev, nlevi, npbl, nadv, num_qtracers, dtime,
+                 workspace_mgr, shoc_runtime_options,
+                 shoc_input, shoc_input_output, shoc_output, shoc_history_output
 #ifdef SCREAM_SMALL_KERNELS
-                                               , shoc_temporaries
+                 , shoc_temporaries
 #endif
-                                               );
+                 );
+  Kokkos::fence();
+  auto finish = std::chrono::steady_clock::now();
+  const Int elapsed_microsec = std::chrono::duration_cast<std::chrono::microseconds>(finish - start).count();
 
   // Copy wind back into separate views and
   // Transpose tracers
@@ -79,6 +79,70 @@ struct UnitWrap::UnitTest<D>::TestVdShocDecompandSolve {
     }
   } // run_bfb
 
+  // Solve a diagonally dominant system with the given solver, return the solution
+  static typename view_3d<Spack>::HostMirror solve(const Int shcol, const Int nlev, const Int n_rhs,
+                                                   const Int solver)
+  {
+    const Int nlev_packs = ekat::npack<Spack>(nlev);
+    const Int nrhs_packs = ekat::npack<Spack>(n_rhs);
+
+    view_2d<Scalar> du("du", shcol, nlev), dl("dl", shcol, nlev), d("d", shcol, nlev);
+    view_3d<Spack> var("var", shcol, nlev, nrhs_packs);
+
+    const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(shcol, nlev_packs);
+    Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+      const Int i = team.league_rank();
+      const auto du_i  = ekat::subview(du, i);
+      const auto dl_i  = ekat::subview(dl, i);
+      const auto d_i   = ekat::subview(d, i);
+      const auto var_i = Kokkos::subview(var, i, Kokkos::ALL(), Kokkos::ALL());
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlev), [&] (const Int& k) {
+        du_i(k) = k == nlev-1 ? 0 : -0.3 - 0.01*i;
+        dl_i(k) = k == 0 ? 0 : -0.4;
+        d_i(k)  = 2 + 0.001*k;
+        for (Int p = 0; p < nrhs_packs; ++p) {
+          var_i(k, p) = ekat::range<Spack>(p*Spack::n) + Scalar(1 + k%7);
+        }
+      });
+      team.team_barrier();
+      Functions::vd_shoc_solve(team, du_i, dl_i, d_i, var_i, solver);
+    });
+
+    auto var_h = Kokkos::create_mirror_view(var);
+    Kokkos::deep_copy(var_h, var);
+    return var_h;
+  }
+
+  // All solvers selectable at runtime must solve the same system to roundoff,
+  // and the auto-tuner must pick one of them.
+  static void run_solvers()
+  {
+    const Int shcol = 3, nlev = 72, n_rhs = 5;
+    const Int nrhs_packs = ekat::npack<Spack>(n_rhs);
+
+    const auto ref = solve(shcol, nlev, n_rhs, Functions::tridiag_default);
+    for (const Int solver : {Functions::tridiag_bfb, Functions::tridiag_cr, Functions::tridiag_thomas}) {
+      const auto var = solve(shcol, nlev, n_rhs, solver);
+      for (Int i = 0; i < shcol; ++i) {
+        for (Int k = 0; k < nlev; ++k) {
+          for (Int p = 0; p < nrhs_packs; ++p) {
+            for (Int s = 0; s < Spack::n && p*Spack::n+s < n_rhs; ++s) {
+              REQUIRE(std::abs(var(i,k,p)[s] - ref(i,k,p)[s]) <= 1e3*std::numeric_limits<Scalar>::epsilon()*std::abs(ref(i,k,p)[s]));
+            }
+          }
+        }
+      }
+    }
+
+    const Int tuned = Functions::tune_tridiag_solver(shcol, nlev, n_rhs, 1);
+#ifdef EKAT_DEFAULT_BFB
+    REQUIRE(tuned == Functions::tridiag_bfb);
+#else
+    REQUIRE((tuned == Functions::tridiag_cr || tuned == Functions::tridiag_thomas));
+#endif
+    REQUIRE(Functions::tridiag_solver_name(tuned) != "");
+  } // run_solvers
+
 };
 
 } // namespace unit_test
@@ -94,4 +158,11 @@ TEST_CASE("vd_shoc_solve_bfb", "[shoc]")
   TestStruct::run_bfb();
 }
 
+TEST_CASE("vd_shoc_solve_solvers", "[shoc]")
+{
+  using TestStruct = scream::shoc::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestVdShocDecompandSolve;
+
+  TestStruct::run_solvers();
+}
+
 } // empty namespace
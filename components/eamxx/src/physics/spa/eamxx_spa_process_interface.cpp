@@ -124,7 +124,15 @@ void SPA::set_grids(const std::shared_ptr<const GridsManager> grids_manager)
     Kokkos::deep_copy(spa_hybm,spa_hybm_h);
   }
 
-  // 4. Create reader for spa data. The reader is either an
+  // 4. Optionally, store all months of spa data, so that data is read only at initialization.
+  //    The monthly data uses reduced precision, but it still has size
+  //    12*ncols*(nlevs+2)*(1+3*nswbands+nlwbands), so this is off by default.
+  m_preload_data = m_params.get<bool>("spa_preload_data",false);
+  if (m_preload_data) {
+    SPAData_months = SPAFunc::SPAMonthlyData(12, m_num_cols, m_num_src_levs+2, m_nswbands, m_nlwbands);
+  }
+
+  // 5. Create reader for spa data. The reader is either an
   //    AtmosphereInput object (for reading into standard
   //    grids) or a SpaFunctions::IOPReader (for reading into
   //    an IOP grid).
@@ -140,6 +148,11 @@ size_t SPA::requested_buffer_size_in_bytes() const
 {
   using PackInfo = ekat::PackInfo<Spack::n>;
 
+  if (m_preload_data) {
+    // We only need the vertical interpolation indices and weights (one Real slot for each index)
+    return 2*m_num_cols*m_num_levs*sizeof(Real);
+  }
+
   // Recall: the quantities in spa_temp defined over vlevs have 1 Real of
   //         padding in each column (at beginning and end).
   //         That's why we have m_num_levs+2
@@ -166,6 +179,21 @@ void SPA::init_buffers(const ATMBufferManager &buffer_manager)
 
   using PackInfo = ekat::PackInfo<Spack::n>;
 
+  if (m_preload_data) {
+    Real* r_mem = reinterpret_cast<Real*>(buffer_manager.get_memory());
+    m_buffer.vert_wgt = decltype(m_buffer.vert_wgt)(r_mem, m_num_cols, m_num_levs);
+    r_mem += m_buffer.vert_wgt.size();
+    m_buffer.vert_idx = decltype(m_buffer.vert_idx)(reinterpret_cast<int*>(r_mem), m_num_cols, m_num_levs);
+    r_mem += m_buffer.vert_idx.size();
+
+    size_t used_mem = (r_mem - buffer_manager.get_memory())*sizeof(Real);
+    EKAT_REQUIRE_MSG(used_mem==requested_buffer_size_in_bytes(),
+        "Error! Used memory != requested memory for SPA.\n"
+        "   - used mem     : " + std::to_string(used_mem) + "\n"
+        "   - requested mem: " + std::to_string(requested_buffer_size_in_bytes()) + "\n");
+    return;
+  }
+
   // Short names make following rows fit on text editor screen
   // Recall: the quantities in spa_temp defined over vlevs have 1 Real of
   //         padding in each column (at beginning and end).
@@ -220,11 +248,22 @@ void SPA::initialize_impl (const RunType /* run_type */)
   SPAData_out.AER_TAU_SW = get_field_out("aero_tau_sw").get_view<Spack***>();
   SPAData_out.AER_TAU_LW = get_field_out("aero_tau_lw").get_view<Spack***>();
 
-  // Load the first month into spa_end.
-  // Note: At the first time step, the data will be moved into spa_beg,
-  //       and spa_end will be reloaded from file with the new month.
-  const int curr_month = timestamp().get_month()-1; // 0-based
-  SPAFunc::update_spa_data_from_file(SPADataReader,SPAIOPDataReader,timestamp(),curr_month,*SPAHorizInterp,SPAData_end);
+  if (m_preload_data) {
+    // Load all months, using spa_end as staging area, then release the beg/end data,
+    // which is no longer needed (but keep the hybrid coordinates in spa_beg).
+    for (int month=0; month<12; ++month) {
+      SPAFunc::update_spa_data_from_file(SPADataReader,SPAIOPDataReader,timestamp(),month,*SPAHorizInterp,SPAData_end);
+      SPAFunc::store_month(SPAData_end,month,SPAData_months);
+    }
+    SPAData_start.data = SPAFunc::SPAData();
+    SPAData_end = SPAFunc::SPAInput();
+  } else {
+    // Load the first month into spa_end.
+    // Note: At the first time step, the data will be moved into spa_beg,
+    //       and spa_end will be reloaded from file with the new month.
+    const int curr_month = timestamp().get_month()-1; // 0-based
+    SPAFunc::update_spa_data_from_file(SPADataReader,SPAIOPDataReader,timestamp(),curr_month,*SPAHorizInterp,SPAData_end);
+  }
 
   // 6. Set property checks for fields in this process
   using Interval = FieldWithinIntervalCheck;
@@ -245,11 +284,19 @@ void SPA::run_impl (const double dt)
   auto ts = timestamp()+dt;
   /* Update the SPATimeState to reflect the current time, note the addition of dt */
   SPATimeState.t_now = ts.frac_of_year_in_days();
+  const auto& pmid_tgt = get_field_in("p_mid").get_view<const Spack**>();
+  if (m_preload_data) {
+    // All months are already in memory, so we only need to update the time state
+    SPAFunc::update_spa_month(ts,SPATimeState);
+    SPAFunc::spa_main_preloaded(SPATimeState, pmid_tgt, SPAData_start.hyam, SPAData_start.hybm,
+                                SPAData_months, m_buffer.vert_idx, m_buffer.vert_wgt, SPAData_out);
+    return;
+  }
+
   /* Update time state and if the month has changed, update the data.*/
     SPAFunc::update_spa_timestate(SPADataReader,SPAIOPDataReader,ts,*SPAHorizInterp,SPATimeState,SPAData_start,SPAData_end);
 
   // Call the main SPA routine to get interpolated aerosol forcings.
-  const auto& pmid_tgt = get_field_in("p_mid").get_view<const Spack**>();
   SPAFunc::spa_main(SPATimeState, pmid_tgt, m_buffer.p_mid_src,
                     SPAData_start,SPAData_end,m_buffer.spa_temp,SPAData_out);
 }
@@ -51,6 +51,10 @@ public:
 
     // Temporary to use
     uview_2d<Spack> p_mid_src;
+
+    // Vertical interpolation indices/weights, for the preloaded data path
+    uview_2d<int>  vert_idx;
+    uview_2d<Real> vert_wgt;
   };
 protected:
 
@@ -90,6 +94,10 @@ protected:
   SPAFunc::SPAInput         SPAData_end;
   SPAFunc::SPAOutput        SPAData_out;
 
+  // If true, all months are read (and remapped) at initialization, and stored in SPAData_months
+  bool                      m_preload_data;
+  SPAFunc::SPAMonthlyData   SPAData_months;
+
   std::shared_ptr<const AbstractGrid>   m_grid;
 }; // class SPA
 
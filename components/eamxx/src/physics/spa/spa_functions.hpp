@@ -44,9 +44,14 @@ struct SPAFunctions
   template <typename S, int N>
   using view_1d_ptr_array = typename KT::template view_1d_ptr_carray<S, N>;
 
+  template <typename S, int N>
+  using view_Nd = typename KT::template view_ND<S,N>;
   template <typename S, int N>
   using view_Nd_host = typename KT::template view_ND<S,N>::HostMirror;
 
+  // Scalar type used to store the preloaded spa data (see SPAMonthlyData)
+  using CacheScalar = float;
+
   template <typename S>
   using view_1d_host = view_Nd_host<S,1>;
   /* ------------------------------------------------------------------------------------------- */
@@ -127,6 +132,34 @@ struct SPAFunctions
     SPAData         data;         // All spa fields
   }; // SPAInput
 
+  // All months of spa data, already horizontally remapped and vertically padded (as in SPAInput),
+  // stored in reduced precision, so that they can be read only once, at initialization.
+  // The variables are stored in the order of get_var_column (ccn3, g_sw, ssa_sw, tau_sw, tau_lw).
+  struct SPAMonthlyData {
+    SPAMonthlyData() = default;
+    SPAMonthlyData(const int nmonths_, const int ncols_, const int nlevs_, const int nswbands_, const int nlwbands_)
+    {
+      nmonths  = nmonths_;
+      ncols    = ncols_;
+      nlevs    = nlevs_;
+      nswbands = nswbands_;
+      nlwbands = nlwbands_;
+
+      const int num_vars = 1+3*nswbands+nlwbands;
+      data = view_Nd<CacheScalar,4>("",nmonths,ncols,num_vars,nlevs);
+      PS   = view_2d<Real>("",nmonths,ncols);
+    }
+
+    int nmonths;
+    int ncols;
+    int nlevs;
+    int nswbands;
+    int nlwbands;
+
+    view_Nd<CacheScalar,4> data;  // dimensions = (nmonths,ncols,num_vars,nlevs)
+    view_2d<Real>          PS;    // dimensions = (nmonths,ncols)
+  }; // SPAMonthlyData
+
   struct IOPReader {
     IOPReader (iop_ptr_type& iop_,
                const std::string file_name_,
@@ -196,6 +229,11 @@ struct SPAFunctions
     AbstractRemapper&                 spa_horiz_interp,
     SPAInput&                         spa_input);
 
+  // Sets the time_state month info to the month of ts. Returns true if the month changed.
+  static bool update_spa_month(
+    const util::TimeStamp&            ts,
+    SPATimeState&                     time_state);
+
   static void update_spa_timestate(
     std::shared_ptr<AtmosphereInput>& scorpio_reader,
     std::shared_ptr<IOPReader>&       iop_reader,
@@ -224,6 +262,38 @@ struct SPAFunctions
       const SPAData&  data_in,
       const SPAData&  data_out);
 
+  // Preloaded data path: all months are stored in a SPAMonthlyData at initialization, and
+  // spa_main_preloaded replaces spa_main. The vertical interpolation weights are computed
+  // once per column (and shared by all variables), then a single kernel performs both
+  // the time and the vertical interpolation of all the variables.
+  static void store_month (
+      const SPAInput&       spa_input,
+      const int             month,  // zero-based
+      const SPAMonthlyData& monthly_data);
+
+  static void spa_main_preloaded(
+    const SPATimeState&         time_state,
+    const view_2d<const Spack>& p_tgt,
+    const view_1d<const Spack>& hyam,     // Padded, as in SPAInput
+    const view_1d<const Spack>& hybm,     // Padded, as in SPAInput
+    const SPAMonthlyData&       monthly_data,
+    const view_2d<int>&         vert_idx, // Temporary
+    const view_2d<Real>&        vert_wgt, // Temporary
+    const SPAOutput&            data_out);
+
+  // For each target level, computes the index k of the source interval [p_src(k),p_src(k+1)]
+  // containing p_tgt, and the weight of p_src(k+1) for linear interpolation
+  static void compute_vertical_interp_weights (
+      const view_1d<const Real>&  ps_beg,
+      const view_1d<const Real>&  ps_end,
+      const Real                  time_fraction,
+      const view_1d<const Spack>& hyam,
+      const view_1d<const Spack>& hybm,
+      const view_2d<const Spack>& p_tgt,
+      const int                   nlevs_src,
+      const view_2d<int>&         vert_idx,
+      const view_2d<Real>&        vert_wgt);
+
   // Return the subcolumn of the proper variable, where ivar
   // is a condensed idx for var and possibly band. In particular:
   //  - ivar=0: return CCN
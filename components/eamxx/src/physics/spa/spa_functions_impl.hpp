@@ -402,6 +402,177 @@ perform_vertical_interpolation(
   Kokkos::fence();
 }
 
+/*-----------------------------------------------------------------*/
+template<typename S, typename D>
+void SPAFunctions<S,D>::
+store_month (
+  const SPAInput&       spa_input,
+  const int             month,
+  const SPAMonthlyData& monthly_data)
+{
+  using ExeSpace = typename KT::ExeSpace;
+  using ESU = ekat::ExeSpaceUtils<ExeSpace>;
+
+  const auto& input = spa_input.data;
+  EKAT_REQUIRE_MSG (month>=0 && month<monthly_data.nmonths,
+      "Error! Invalid month index for SPA monthly data: " + std::to_string(month) + ".\n");
+  EKAT_REQUIRE_MSG (
+      input.ncols==monthly_data.ncols && input.nlevs==monthly_data.nlevs &&
+      input.nswbands==monthly_data.nswbands && input.nlwbands==monthly_data.nlwbands,
+      "Error! SPAInput and SPAMonthlyData structs must have the same sizes.\n");
+
+  const int num_vars = 1+input.nswbands*3+input.nlwbands;
+  const int nlevs = input.nlevs;
+  const auto data = monthly_data.data;
+  const auto ps = monthly_data.PS;
+  const auto ps_in = spa_input.PS;
+  const auto policy = ESU::get_default_team_policy(input.ncols*num_vars, nlevs);
+
+  Kokkos::parallel_for("spa_store_month_loop", policy,
+    KOKKOS_LAMBDA(const MemberType& team) {
+    const int icol = team.league_rank() / num_vars;
+    const int ivar = team.league_rank() % num_vars;
+
+    if (ivar==0) {
+      Kokkos::single(Kokkos::PerTeam(team),[&]{
+        ps(month,icol) = ps_in(icol);
+      });
+    }
+
+    const auto var = get_var_column(input,icol,ivar);
+    Kokkos::parallel_for (Kokkos::TeamVectorRange(team,nlevs), [&] (const int& k) {
+      data(month,icol,ivar,k) = static_cast<CacheScalar>(var(k/Spack::n)[k%Spack::n]);
+    });
+  });
+  Kokkos::fence();
+}
+
+template<typename S, typename D>
+void SPAFunctions<S,D>::
+compute_vertical_interp_weights (
+  const view_1d<const Real>&  ps_beg,
+  const view_1d<const Real>&  ps_end,
+  const Real                  time_fraction,
+  const view_1d<const Spack>& hyam,
+  const view_1d<const Spack>& hybm,
+  const view_2d<const Spack>& p_tgt,
+  const int                   nlevs_src,
+  const view_2d<int>&         vert_idx,
+  const view_2d<Real>&        vert_wgt)
+{
+  using ExeSpace = typename KT::ExeSpace;
+  using ESU = ekat::ExeSpaceUtils<ExeSpace>;
+  using C = scream::physics::Constants<Real>;
+
+  constexpr auto P0 = C::P0;
+
+  const int ncols = vert_idx.extent(0);
+  const int nlevs_tgt = vert_idx.extent(1);
+  const auto hyam_s = ekat::scalarize(hyam);
+  const auto hybm_s = ekat::scalarize(hybm);
+  const auto p_tgt_s = ekat::scalarize(p_tgt);
+  const auto policy = ESU::get_default_team_policy(ncols, nlevs_tgt);
+
+  Kokkos::parallel_for("spa_vert_interp_weights_loop", policy,
+    KOKKOS_LAMBDA (const MemberType& team) {
+    const int icol = team.league_rank();
+    const Real ps = linear_interp(ps_beg(icol),ps_end(icol),time_fraction);
+    auto p_src = [&](const int k) -> Real {
+      return ps * hybm_s(k) + P0 * hyam_s(k);
+    };
+
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nlevs_tgt), [&](const int k) {
+      // Bisection on the source levels. The src data is padded, so that p_src(0)<=p_tgt<p_src(nlevs_src-1)
+      const Real p = p_tgt_s(icol,k);
+      int lo = 0, hi = nlevs_src-1;
+      while (hi-lo>1) {
+        const int mid = (lo+hi) / 2;
+        if (p_src(mid)<=p) {
+          lo = mid;
+        } else {
+          hi = mid;
+        }
+      }
+      const Real dp = p_src(hi) - p_src(lo);
+      const Real w = dp>0 ? (p - p_src(lo)) / dp : 0;
+      vert_idx(icol,k) = lo;
+      vert_wgt(icol,k) = w<0 ? 0 : (w>1 ? 1 : w);
+    });
+  });
+}
+
+template<typename S, typename D>
+void SPAFunctions<S,D>
+::spa_main_preloaded(
+  const SPATimeState&         time_state,
+  const view_2d<const Spack>& p_tgt,
+  const view_1d<const Spack>& hyam,
+  const view_1d<const Spack>& hybm,
+  const SPAMonthlyData&       monthly_data,
+  const view_2d<int>&         vert_idx,
+  const view_2d<Real>&        vert_wgt,
+  const SPAOutput&            data_out)
+{
+  using ExeSpace = typename KT::ExeSpace;
+  using ESU = ekat::ExeSpaceUtils<ExeSpace>;
+
+  EKAT_REQUIRE_MSG (
+      monthly_data.nswbands==data_out.nswbands &&
+      monthly_data.nlwbands==data_out.nlwbands &&
+      monthly_data.ncols==data_out.ncols,
+      "Error! SPAMonthlyData and SPAOutput data structs must have the same number of columns and SW/LW bands.\n");
+  EKAT_REQUIRE_MSG (time_state.current_month>=0,
+      "Error! SPA time state was not initialized.\n");
+
+  auto delta_t_fraction = (time_state.t_now-time_state.t_beg_month) / time_state.days_this_month;
+  EKAT_REQUIRE_MSG (delta_t_fraction>=0 && delta_t_fraction<=1,
+      "Error! Convex interpolation with coefficient out of [0,1].\n"
+      "  t_now  : " + std::to_string(time_state.t_now) + "\n"
+      "  t_beg  : " + std::to_string(time_state.t_beg_month) + "\n"
+      "  delta_t: " + std::to_string(time_state.days_this_month) + "\n");
+
+  const int m_beg = time_state.current_month;
+  const int m_end = (m_beg+1) % monthly_data.nmonths;
+
+  // Step 1. Vertical interpolation weights (shared by all variables)
+  const auto ps_beg = Kokkos::subview(monthly_data.PS,m_beg,Kokkos::ALL());
+  const auto ps_end = Kokkos::subview(monthly_data.PS,m_end,Kokkos::ALL());
+  compute_vertical_interp_weights(ps_beg,ps_end,delta_t_fraction,hyam,hybm,p_tgt,
+                                  monthly_data.nlevs,vert_idx,vert_wgt);
+
+  // Step 2. Time and vertical interpolation of all variables, in one pass
+  const int ncols = data_out.ncols;
+  const int nlevs_tgt = data_out.nlevs;
+  const int num_vars = 1+data_out.nswbands*3+data_out.nlwbands;
+  const int num_vert_packs = ekat::PackInfo<Spack::n>::num_packs(nlevs_tgt);
+  const auto data = monthly_data.data;
+  const auto policy = ESU::get_default_team_policy(ncols*num_vars, num_vert_packs);
+
+  Kokkos::parallel_for("spa_time_vert_interp_loop", policy,
+    KOKKOS_LAMBDA(const MemberType& team) {
+    const int icol = team.league_rank() / num_vars;
+    const int ivar = team.league_rank() % num_vars;
+
+    auto y = [&](const int k) -> Real {
+      return linear_interp(Real(data(m_beg,icol,ivar,k)),Real(data(m_end,icol,ivar,k)),delta_t_fraction);
+    };
+
+    const auto var_out = get_var_column(data_out,icol,ivar);
+    Kokkos::parallel_for (Kokkos::TeamVectorRange(team,num_vert_packs), [&] (const int& kp) {
+      Spack out(0);
+      for (int s=0; s<Spack::n && kp*Spack::n+s<nlevs_tgt; ++s) {
+        const int k = kp*Spack::n+s;
+        const int j = vert_idx(icol,k);
+        const Real w = vert_wgt(icol,k);
+        const Real y0 = y(j);
+        out[s] = y0 + (y(j+1)-y0)*w;
+      }
+      var_out(kp) = out;
+    });
+  });
+  Kokkos::fence();
+}
+
 /*-----------------------------------------------------------------*/
 /* Note: In this routine the SPA source data is padded in the vertical
  * to facilitate the proper behavior at the boundaries when doing the
@@ -564,13 +735,7 @@ void SPAFunctions<S,D>
   // Now we check if we have to update the data that changes monthly
   // NOTE:  This means that SPA assumes monthly data to update.  Not
   //        any other frequency.
-  const auto month = ts.get_month() - 1; // Make it 0-based
-  if (month != time_state.current_month) {
-    // Update the SPA time state information
-    time_state.current_month = month;
-    time_state.t_beg_month = util::TimeStamp({ts.get_year(),month+1,1}, {0,0,0}).frac_of_year_in_days();
-    time_state.days_this_month = util::days_in_month(ts.get_year(),month+1);
-
+  if (update_spa_month(ts,time_state)) {
     // Copy spa_end'data into spa_beg'data, and read in the new spa_end
     std::swap(spa_beg,spa_end);
 
@@ -585,6 +750,24 @@ void SPAFunctions<S,D>
 
 } // END updata_spa_timestate
 
+template<typename S, typename D>
+bool SPAFunctions<S,D>
+::update_spa_month(
+    const util::TimeStamp&            ts,
+    SPATimeState&                     time_state)
+{
+  const auto month = ts.get_month() - 1; // Make it 0-based
+  if (month == time_state.current_month) {
+    return false;
+  }
+
+  // Update the SPA time state information
+  time_state.current_month = month;
+  time_state.t_beg_month = util::TimeStamp({ts.get_year(),month+1,1}, {0,0,0}).frac_of_year_in_days();
+  time_state.days_this_month = util::days_in_month(ts.get_year(),month+1);
+  return true;
+} // END update_spa_month
+
 template<typename S,typename D>
 KOKKOS_INLINE_FUNCTION
 auto SPAFunctions<S,D>::
@@ -349,6 +349,99 @@ TEST_CASE("spa_main")
   std::cout << "  -> vert interp, p_tgt!=p_src and extrapolation needed ... OK!\n\n";
 }
 
+TEST_CASE("spa_main_preloaded")
+{
+  auto engine = setup_random_test ();
+
+  using C = scream::physics::Constants<Real>;
+
+  const int ncols     = IPDF(1,10)(engine);
+  const int nlevs_src = IPDF(5,20)(engine);
+  const int nlevs_tgt = IPDF(5,30)(engine);
+  const int nswbands  = IPDF(10,20)(engine);
+  const int nlwbands  = IPDF(10,20)(engine);
+
+  // Random beg/end data, for the months of January and February
+  SPAFunc::SPAInput     spa_beg(ncols, nlevs_src+2, nswbands, nlwbands);
+  SPAFunc::SPAInput     spa_end(ncols, nlevs_src+2, nswbands, nlwbands);
+  SPAFunc::SPAInput     spa_tmp(ncols, nlevs_src+2, nswbands, nlwbands);
+  SPAFunc::SPAOutput    spa_out_ref(ncols, nlevs_tgt, nswbands, nlwbands);
+  SPAFunc::SPAOutput    spa_out(ncols, nlevs_tgt, nswbands, nlwbands);
+  randomize(spa_beg.data,engine,RPDF(1.0,10.0));
+  randomize(spa_end.data,engine,RPDF(1.0,10.0));
+  ekat::genRandArray(spa_beg.PS,engine,RPDF(9e4,1.1e5));
+  ekat::genRandArray(spa_end.PS,engine,RPDF(9e4,1.1e5));
+
+  // Padded hybrid coordinates (as done in SPA::set_grids)
+  auto hyam_h = Kokkos::create_mirror_view(ekat::scalarize(spa_beg.hyam));
+  auto hybm_h = Kokkos::create_mirror_view(ekat::scalarize(spa_beg.hybm));
+  for (int k=1; k<=nlevs_src; ++k) {
+    hyam_h(k) = 0.01*(nlevs_src-k) / nlevs_src;
+    hybm_h(k) = Real(k) / nlevs_src;
+  }
+  hyam_h(0) = 0;
+  hybm_h(0) = 0;
+  hyam_h(nlevs_src+1) = 1e5;
+  hybm_h(nlevs_src+1) = 0;
+  Kokkos::deep_copy(ekat::scalarize(spa_beg.hyam),hyam_h);
+  Kokkos::deep_copy(ekat::scalarize(spa_beg.hybm),hybm_h);
+
+  // Monotonic target pressure, partly below the surface pressure of the data
+  auto npacks_src = ekat::PackInfo<Spack::n>::num_packs(nlevs_src+2);
+  auto npacks_tgt = ekat::PackInfo<Spack::n>::num_packs(nlevs_tgt);
+  auto p_src = view_2d<Spack>("",ncols,npacks_src);
+  auto p_tgt = view_2d<Spack>("",ncols,npacks_tgt);
+  auto p_tgt_h = Kokkos::create_mirror_view(ekat::scalarize(p_tgt));
+  ekat::genRandArray(p_tgt,engine,RPDF(C::P0*0.001,1.2e5));
+  Kokkos::deep_copy(p_tgt_h, ekat::scalarize(p_tgt));
+  for (int i=0; i<ncols; ++i) {
+    auto col = ekat::subview(p_tgt_h,i);
+    std::sort(col.data(),col.data()+nlevs_tgt);
+  }
+  Kokkos::deep_copy(ekat::scalarize(p_tgt),p_tgt_h);
+
+  // Store beg/end in the monthly data
+  SPAFunc::SPAMonthlyData spa_months(12, ncols, nlevs_src+2, nswbands, nlwbands);
+  SPAFunc::store_month(spa_beg,0,spa_months);
+  SPAFunc::store_month(spa_end,1,spa_months);
+
+  util::TimeStamp t_beg(1900,1,1,0,0,0);
+  util::TimeStamp t_end(1900,2,1,0,0,0);
+  auto t_now = t_beg + static_cast<int>(round((t_end-t_beg) * RPDF(0.0,0.999)(engine)));
+  SPAFunc::SPATimeState time_state;
+  REQUIRE (SPAFunc::update_spa_month(t_now,time_state));
+  REQUIRE (time_state.current_month==0);
+  REQUIRE (not SPAFunc::update_spa_month(t_now,time_state));
+  time_state.t_now = t_now.frac_of_year_in_days();
+
+  SPAFunc::spa_main(time_state,p_tgt,p_src,spa_beg,spa_end,spa_tmp,spa_out_ref);
+
+  view_2d<int>  vert_idx("",ncols,nlevs_tgt);
+  view_2d<Real> vert_wgt("",ncols,nlevs_tgt);
+  SPAFunc::spa_main_preloaded(time_state,p_tgt,spa_beg.hyam,spa_beg.hybm,
+                              spa_months,vert_idx,vert_wgt,spa_out);
+
+  // The monthly data is stored in single precision
+  const Real tol = 10*10*std::numeric_limits<float>::epsilon();
+  SPADataHost ref_h(spa_out_ref);
+  SPADataHost out_h(spa_out);
+  ref_h.copy_from_dev(spa_out_ref);
+  out_h.copy_from_dev(spa_out);
+  for (int i=0; i<ncols; ++i) {
+    for (int k=0; k<nlevs_tgt; ++k) {
+      REQUIRE (std::abs(out_h.ccn3(i,k)-ref_h.ccn3(i,k)) <= tol);
+      for (int n=0; n<nswbands; ++n) {
+        REQUIRE (std::abs(out_h.aer_g_sw(i,n,k)-ref_h.aer_g_sw(i,n,k)) <= tol);
+        REQUIRE (std::abs(out_h.aer_ssa_sw(i,n,k)-ref_h.aer_ssa_sw(i,n,k)) <= tol);
+        REQUIRE (std::abs(out_h.aer_tau_sw(i,n,k)-ref_h.aer_tau_sw(i,n,k)) <= tol);
+      }
+      for (int n=0; n<nlwbands; ++n) {
+        REQUIRE (std::abs(out_h.aer_tau_lw(i,n,k)-ref_h.aer_tau_lw(i,n,k)) <= tol);
+      }
+    }
+  }
+}
+
 // Compute min/max of input over [start,end) indices
 std::pair<Real,Real> compute_min_max(const view_1d<Real>::HostMirror& input, const int start, const int end)
 {
@@ -64,6 +64,8 @@ AtmosphereProcess (const ekat::Comm& comm, const ekat::ParameterList& params)
       m_params.get<bool>("enable_column_conservation_checks", false);
 
   m_internal_diagnostics_level = m_params.get<int>("internal_diagnostics_level", 0);
+
+  m_auto_bundle_groups = m_params.get<bool>("auto_bundle_groups", false);
 }
 
 void AtmosphereProcess::initialize (const TimeStamp& t0, const RunType run_type) {
@@ -94,6 +96,11 @@ void AtmosphereProcess::run (const double dt) {
     run_precondition_checks();
   }
 
+  // Poison fields whose memory was used by other fields since our last run
+  for (auto& f : m_fields_to_poison) {
+    f.deep_copy(ekat::ScalarTraits<Real>::invalid());
+  }
+
   // Let the derived class do the actual run
   auto dt_sub = dt / m_num_subcycles;
 
@@ -570,6 +577,21 @@ bool AtmosphereProcess::has_computed_group (const std::string& name, const std::
   return false;
 }
 
+void AtmosphereProcess::set_field_persistent (const std::string& name, const std::string& grid_name) {
+  EKAT_REQUIRE_MSG (has_computed_field(name,grid_name),
+      "Error! Only computed fields can be marked as persistent.\n"
+      "  - atm proc name: " + this->name() + "\n"
+      "  - field name   : " + name + "\n"
+      "  - grid name    : " + grid_name + "\n");
+  m_persistent_fields.emplace(grid_name,name);
+}
+
+void AtmosphereProcess::set_computed_fields_persistent () {
+  for (const auto& it : m_computed_field_requests) {
+    m_persistent_fields.emplace(it.fid.get_grid_name(),it.fid.name());
+  }
+}
+
 void AtmosphereProcess::log (const LogLevel lev, const std::string& msg) const {
   m_atm_logger->log(lev,msg);
 }
@@ -287,12 +287,47 @@ public:
     return m_atm_logger;
   }
 
+  int get_num_subcycles () const { return m_num_subcycles; }
+
+  // Computed fields that share memory with other fields (see FieldManager::set_transient_field),
+  // and that must be filled with NaN at the beginning of run. This helps catching atm procs that
+  // read such fields before computing them, or that compute only part of them.
+  void add_field_to_poison (const Field& f) { m_fields_to_poison.push_back(f); }
+
+  // Computed fields that this atm proc does not recompute every time it runs (e.g., because
+  // it updates them only every N steps), as (grid name, field name) pairs. Their value must
+  // survive across time steps, so they can never share memory with other fields.
+  const std::set<std::pair<std::string,std::string>>& get_persistent_fields () const { return m_persistent_fields; }
+
+  // Complete any work still pending from a previous run call (e.g., an asynchronous
+  // computation), and store its results in the computed fields. The AD calls this
+  // before writing model restart files, since the pending work is not saved in them.
+  virtual void complete_pending_work () {}
+
+  // Number of time steps between updates of this atm proc (at the first step and at the
+  // multiples of it), or 0 if not specified. The computed fields are held in between. If
+  // the frequency N>1, the AD errors out if an atm proc with a specified frequency requires
+  // some of these fields, and its frequency is not a multiple of N, since it would use stale values.
+  virtual int get_update_frequency () const { return 0; }
+
+  // The types of other atm procs whose work is done by this atm proc as well (if any).
+  // The group containing this atm proc errors out if any of them is also in its list
+  // of processes. If the group has parameters for one of them (even if it is not in
+  // the list), they are passed to set_fused_process_params.
+  virtual std::vector<std::string> get_fused_processes () const { return {}; }
+  virtual void set_fused_process_params (const std::string& /* type */,
+                                         const ekat::ParameterList& /* params */) {}
+
 protected:
 
+  // Mark a computed field (or all of them) as persistent (see get_persistent_fields).
+  // NOTE: must be called after the corresponding field requests are added
+  void set_field_persistent (const std::string& name, const std::string& grid_name);
+  void set_computed_fields_persistent ();
+
   // Sends a message to the atm log
   void log (const LogLevel lev, const std::string& msg) const;
 
-  int get_num_subcycles () const { return m_num_subcycles; }
   int get_subcycle_iter () const { return m_subcycle_iter; }
   bool do_update_time_stamp () const { return m_update_time_stamps; }
 
@@ -581,12 +616,22 @@ private:
   // Whether this atm proc should compute tendencies for any of its updated fields
   bool m_compute_proc_tendencies = false;
 
+  // Fields to fill with NaN at the beginning of run (see add_field_to_poison)
+  std::list<Field> m_fields_to_poison;
+
+  // Computed fields that must keep their value across time steps (see get_persistent_fields)
+  std::set<std::pair<std::string,std::string>> m_persistent_fields;
+
   // Log level for when property checks perform a repair
   ekat::logger::LogLevel  m_repair_log_level;
 
   // Controls global hashing output for debugging non-BFBness.
   int m_internal_diagnostics_level;
 
+  // Whether the driver bundles all groups (driver_options::auto_bundle_groups).
+  // If so, bundled groups are hashed as a whole.
+  bool m_auto_bundle_groups;
+
 protected:
 
   // IOP object
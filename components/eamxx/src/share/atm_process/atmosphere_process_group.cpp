@@ -75,10 +75,35 @@ AtmosphereProcessGroup (const ekat::Comm& comm, const ekat::ParameterList& param
     // Set logger in this ap params
     params_i.set("Logger",this->m_atm_logger);
 
+    // Forward the group bundling setting of the driver
+    params_i.set("auto_bundle_groups",m_params.get<bool>("auto_bundle_groups",false));
+
     // Create the atm proc
     auto ap = apf.create(ap_type,proc_comm,params_i);
     m_atm_processes.push_back(ap);
 
+    // If this atm proc does the work of other atm procs, make sure they are not
+    // also in the group, and give it their parameters (if any), so that they are
+    // not silently ignored.
+    auto get_type = [&](const std::string& name) {
+      const auto& pl = m_params.sublist(name);
+      return ekat::upper_case(pl.isParameter("Type") ? pl.get<std::string>("Type") : name);
+    };
+    for (const auto& fused_type : ap->get_fused_processes()) {
+      const auto fused_type_ci = ekat::upper_case(fused_type);
+      for (const auto& other_name : group_list) {
+        EKAT_REQUIRE_MSG (get_type(other_name)!=fused_type_ci,
+            "Error! Atm proc '" + ap_name + "' also does the work of '" + fused_type + "',\n"
+            "       but the latter is in the same group ('" + m_group_name + "').\n"
+            "       Remove '" + other_name + "' from the atm_procs_list.\n");
+      }
+      for (auto it=m_params.sublists_names_cbegin(); it!=m_params.sublists_names_cend(); ++it) {
+        if (get_type(*it)==fused_type_ci) {
+          ap->set_fused_process_params(fused_type,m_params.sublist(*it));
+        }
+      }
+    }
+
     // NOTE: the shared_ptr of the new atmosphere process *MUST* have been created correctly.
     //       Namely, the creation process must have set up enable_shared_from_this's status correctly.
     //       This is done by the library-provided templated function 'create_atm_process<T>.
@@ -105,10 +105,21 @@ void hash (const std::list<Field>& fs, HashType& accum) {
     hash(f, accum);
 }
 
-void hash (const std::list<FieldGroup>& fgs, HashType& accum) {
-  for (const auto& g : fgs)
+void hash (const std::list<FieldGroup>& fgs, HashType& accum, const bool whole_bundles) {
+  for (const auto& g : fgs) {
+    // If requested, and the group is a whole bundle, hash all its fields in one launch.
+    // NOTE: this changes the order in which values are accumulated, so the hash
+    //       differs from the one computed field by field.
+    if (whole_bundles and g.m_info->m_bundled) {
+      const auto b = g.get_bundled_field();
+      if (b.get_header().get_alloc_properties().contiguous()) {
+        hash(b, accum);
+        continue;
+      }
+    }
     for (const auto& e : g.m_fields)
       hash(*e.second, accum);
+  }
 }
 
 } // namespace anon
@@ -119,9 +130,9 @@ void AtmosphereProcess
   static constexpr int nslot = 3;
   HashType laccum[nslot] = {0};
   hash(m_fields_in, laccum[0]);
-  hash(m_groups_in, laccum[0]);
+  hash(m_groups_in, laccum[0], m_auto_bundle_groups);
   hash(m_fields_out, laccum[1]);
-  hash(m_groups_out, laccum[1]);
+  hash(m_groups_out, laccum[1], m_auto_bundle_groups);
   hash(m_internal_fields, laccum[2]);
   HashType gaccum[nslot];
   bfbhash::all_reduce_HashType(m_comm.mpi_comm(), laccum, gaccum, nslot);
@@ -226,4 +226,35 @@ void Field::allocate_view ()
   m_data.h_view = Kokkos::create_mirror_view(m_data.d_view);
 }
 
+void Field::allocate_view (const Field& pool)
+{
+  EKAT_REQUIRE_MSG(!is_allocated(), "Error! View was already allocated.\n");
+  EKAT_REQUIRE_MSG(pool.is_allocated(),
+      "Error! Cannot allocate a field on the memory of a non-allocated field.\n"
+      "  - field name: " + name() + "\n"
+      "  - pool name : " + pool.name() + "\n");
+
+  // Short names
+  const auto& id     = m_header->get_identifier();
+  const auto& layout = id.get_layout();
+  auto& alloc_prop   = m_header->get_alloc_properties();
+
+  // Commit the allocation properties
+  alloc_prop.commit(layout);
+
+  const auto view_dim = alloc_prop.get_alloc_size();
+  const long long pool_dim = pool.m_data.d_view.extent(0);
+  EKAT_REQUIRE_MSG (view_dim<=pool_dim,
+      "Error! Input pool field is not large enough to host this field.\n"
+      "  - field name: " + name() + "\n"
+      "  - pool name : " + pool.name() + "\n"
+      "  - field alloc size: " + std::to_string(view_dim) + "\n"
+      "  - pool alloc size : " + std::to_string(pool_dim) + "\n");
+
+  // Both device and host views alias the (beginning of the) pool views
+  const Kokkos::pair<long long,long long> range(0,view_dim);
+  m_data.d_view = Kokkos::subview(pool.m_data.d_view,range);
+  m_data.h_view = Kokkos::subview(pool.m_data.h_view,range);
+}
+
 } // namespace scream
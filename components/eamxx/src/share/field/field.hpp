@@ -200,7 +200,9 @@ public:
   template<typename T, HostOrDevice HD = Device>
   void deep_copy (const T value);
 
-  // Copy the data from one field to this field
+  // Copy the data from one field to this field.
+  // NOTE: the two fields can have different floating point data types,
+  //       which allows to access fields stored with reduced precision.
   template<HostOrDevice HD = Device>
   void deep_copy (const Field& src);
 
@@ -278,6 +280,12 @@ public:
   // Allocate the actual view
   void allocate_view ();
 
+  // Allocate the view on (the beginning of) the memory of another, already
+  // allocated, field. This is used by the FieldManager to let fields with
+  // disjoint live ranges share the same memory.
+  // NOTE: the memory of the input field must be large enough to host this field.
+  void allocate_view (const Field& pool);
+
 #ifndef KOKKOS_ENABLE_CUDA
   // Cuda requires methods enclosing __device__ lambda's to be public
 protected:
@@ -285,7 +293,7 @@ protected:
   template<HostOrDevice HD, typename ST>
   void deep_copy_impl (const ST value);
 
-  template<HostOrDevice HD, typename ST>
+  template<HostOrDevice HD, typename ST, typename SrcST = ST>
   void deep_copy_impl (const Field& src);
 
   template<CombineMode CM, HostOrDevice HD, typename ST>
@@ -1,5 +1,7 @@
 #include "share/field/field_group.hpp"
 
+#include <algorithm>
+
 namespace scream {
 
 FieldGroup::FieldGroup (const std::string& name)
@@ -40,6 +42,75 @@ const std::string& FieldGroup::grid_name () const {
   }
 }
 
+Field FieldGroup::get_bundled_field () const {
+  EKAT_REQUIRE_MSG (m_info->m_bundled and m_bundle!=nullptr,
+      "Error! Cannot get the bundled field of a group that is not bundled.\n"
+      "  - group name: " + m_info->m_group_name + "\n");
+
+  const int idim = m_info->m_subview_dim;
+  const int size = m_info->size();
+  const auto& layout = m_bundle->get_header().get_identifier().get_layout();
+  if (layout.dim(idim)==size) {
+    return *m_bundle;
+  }
+
+  // The fields of this group are a contiguous range of slices of the bundle
+  int beg = layout.dim(idim);
+  for (const auto& fn : m_info->m_fields_names) {
+    beg = std::min(beg,m_info->m_subview_idx.at(fn));
+  }
+  return m_bundle->subfield(m_info->m_group_name,idim,beg,beg+size);
+}
+
+namespace {
+// Two groups can be processed via their bundled fields only if
+// both are bundled, and store the fields in the same order
+bool same_bundling (const FieldGroup& lhs, const FieldGroup& rhs) {
+  return lhs.m_info->m_bundled and rhs.m_info->m_bundled and
+         lhs.m_info->m_fields_names==rhs.m_info->m_fields_names;
+}
+} // anonymous namespace
+
+void FieldGroup::deep_copy (const Real value) {
+  if (m_info->m_bundled) {
+    get_bundled_field().deep_copy(value);
+  } else {
+    for (auto& it : m_fields) {
+      it.second->deep_copy(value);
+    }
+  }
+}
+
+void FieldGroup::deep_copy (const FieldGroup& src) {
+  if (same_bundling(*this,src)) {
+    get_bundled_field().deep_copy(src.get_bundled_field());
+  } else {
+    for (const auto& fn : m_info->m_fields_names) {
+      m_fields.at(fn)->deep_copy(*src.m_fields.at(fn));
+    }
+  }
+}
+
+void FieldGroup::scale (const Real beta) {
+  if (m_info->m_bundled) {
+    get_bundled_field().scale(beta);
+  } else {
+    for (auto& it : m_fields) {
+      it.second->scale(beta);
+    }
+  }
+}
+
+void FieldGroup::update (const FieldGroup& x, const Real alpha, const Real beta) {
+  if (same_bundling(*this,x)) {
+    get_bundled_field().update(x.get_bundled_field(),alpha,beta);
+  } else {
+    for (const auto& fn : m_info->m_fields_names) {
+      m_fields.at(fn)->update(*x.m_fields.at(fn),alpha,beta);
+    }
+  }
+}
+
 void FieldGroup::copy_fields (const FieldGroup& src) {
   m_bundle = src.m_bundle;
   for (auto it : src.m_fields) {
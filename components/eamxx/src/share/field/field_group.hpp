@@ -56,6 +56,20 @@ struct FieldGroup {
 
   const std::string& grid_name () const;
 
+  // If the group is bundled, returns a field spanning *exactly* the fields of
+  // this group. This is m_bundle itself, unless the bundle was allocated to
+  // accommodate several groups, in which case it is a multi-slice subfield of it.
+  Field get_bundled_field () const;
+
+  // Multi-field operations, analogue to the corresponding Field methods.
+  // If the group(s) are bundled (with the same ordering of fields), they
+  // are performed on the bundled field, with a single kernel launch.
+  // Otherwise, they are performed field by field.
+  void deep_copy (const Real value);
+  void deep_copy (const FieldGroup& src);
+  void scale (const Real beta);
+  void update (const FieldGroup& x, const Real alpha, const Real beta);
+
   // The fields in this group
   std::map<ci_string,std::shared_ptr<Field>> m_fields;
 
@@ -228,10 +228,25 @@ deep_copy (const Field& src) {
   EKAT_REQUIRE_MSG (not m_is_read_only,
       "Error! Cannot call deep_copy on read-only fields.\n");
 
-  EKAT_REQUIRE_MSG (data_type()==src.data_type(),
-      "Error! Cannot copy fields with different data type.\n");
+  const auto dt     = data_type();
+  const auto src_dt = src.data_type();
+  if (dt!=src_dt) {
+    // Mixed precision copy, to move data in/out of fields stored with reduced precision
+    if (dt==DataType::FloatType and src_dt==DataType::DoubleType) {
+      deep_copy_impl<HD,float,double>(src);
+    } else if (dt==DataType::DoubleType and src_dt==DataType::FloatType) {
+      deep_copy_impl<HD,double,float>(src);
+    } else {
+      EKAT_ERROR_MSG ("Error! Cannot copy fields with different data type.\n"
+                      " - src name: " + src.name() + "\n"
+                      " - tgt name: " + name() + "\n"
+                      " - src data type: " + e2str(src_dt) + "\n"
+                      " - tgt data type: " + e2str(dt) + "\n");
+    }
+    return;
+  }
 
-  switch (data_type()) {
+  switch (dt) {
     case DataType::IntType:
       deep_copy_impl<HD,int>(src);
       break;
@@ -280,7 +295,7 @@ deep_copy (const ST value) {
   }
 }
 
-template<HostOrDevice HD, typename ST>
+template<HostOrDevice HD, typename ST, typename SrcST>
 void Field::
 deep_copy_impl (const Field& src) {
 
@@ -294,7 +309,7 @@ deep_copy_impl (const Field& src) {
   // For rank 0 view, we only need to copy a single value and return
   if (rank == 0) {
     auto v     =     get_view<      ST,HD>();
-    auto v_src = src.get_view<const ST,HD>();
+    auto v_src = src.get_view<const SrcST,HD>();
     v() = v_src();
     return;
   }
@@ -322,13 +337,13 @@ deep_copy_impl (const Field& src) {
       {
         if (src_alloc_props.contiguous() and tgt_alloc_props.contiguous()) {
           auto v     =     get_view<      ST*,HD>();
-          auto v_src = src.get_view<const ST*,HD>();
+          auto v_src = src.get_view<const SrcST*,HD>();
           Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int idx) {
               v(idx) = v_src(idx);
             });
         } else {
           auto v     =     get_strided_view<      ST*,HD>();
-          auto v_src = src.get_strided_view<const ST*,HD>();
+          auto v_src = src.get_strided_view<const SrcST*,HD>();
           Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int idx) {
               v(idx) = v_src(idx);
             });
@@ -339,7 +354,7 @@ deep_copy_impl (const Field& src) {
       {
         if (src_alloc_props.contiguous() and tgt_alloc_props.contiguous()) {
           auto v     =     get_view<      ST**,HD>();
-          auto v_src = src.get_view<const ST**,HD>();
+          auto v_src = src.get_view<const SrcST**,HD>();
           Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int idx) {
             int i,j;
             unflatten_idx(idx,ext,i,j);
@@ -348,7 +363,7 @@ deep_copy_impl (const Field& src) {
         }
         else {
           auto v     =     get_strided_view<      ST**,HD>();
-          auto v_src = src.get_strided_view<const ST**,HD>();
+          auto v_src = src.get_strided_view<const SrcST**,HD>();
           Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int idx) {
             int i,j;
             unflatten_idx(idx,ext,i,j);
@@ -361,7 +376,7 @@ deep_copy_impl (const Field& src) {
       {
         if (src_alloc_props.contiguous() and tgt_alloc_props.contiguous()) {
           auto v     =     get_view<      ST***,HD>();
-          auto v_src = src.get_view<const ST***,HD>();
+          auto v_src = src.get_view<const SrcST***,HD>();
           Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int idx) {
             int i,j,k;
             unflatten_idx(idx,ext,i,j,k);
@@ -369,7 +384,7 @@ deep_copy_impl (const Field& src) {
           });
         } else {
           auto v     =     get_strided_view<      ST***,HD>();
-          auto v_src = src.get_strided_view<const ST***,HD>();
+          auto v_src = src.get_strided_view<const SrcST***,HD>();
           Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int idx) {
             int i,j,k;
             unflatten_idx(idx,ext,i,j,k);
@@ -382,7 +397,7 @@ deep_copy_impl (const Field& src) {
       {
         if (src_alloc_props.contiguous() and tgt_alloc_props.contiguous()) {
           auto v     =     get_view<      ST****,HD>();
-          auto v_src = src.get_view<const ST****,HD>();
+          auto v_src = src.get_view<const SrcST****,HD>();
           Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int idx) {
             int i,j,k,l;
             unflatten_idx(idx,ext,i,j,k,l);
@@ -390,7 +405,7 @@ deep_copy_impl (const Field& src) {
           });
         } else {
           auto v     =     get_strided_view<      ST****,HD>();
-          auto v_src = src.get_strided_view<const ST****,HD>();
+          auto v_src = src.get_strided_view<const SrcST****,HD>();
           Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int idx) {
             int i,j,k,l;
             unflatten_idx(idx,ext,i,j,k,l);
@@ -403,7 +418,7 @@ deep_copy_impl (const Field& src) {
       {
         if (src_alloc_props.contiguous() and tgt_alloc_props.contiguous()) {
           auto v     =     get_view<      ST*****,HD>();
-          auto v_src = src.get_view<const ST*****,HD>();
+          auto v_src = src.get_view<const SrcST*****,HD>();
           Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int idx) {
             int i,j,k,l,m;
             unflatten_idx(idx,ext,i,j,k,l,m);
@@ -411,7 +426,7 @@ deep_copy_impl (const Field& src) {
           });
         } else {
           auto v     =     get_view<      ST*****,HD>();
-          auto v_src = src.get_view<const ST*****,HD>();
+          auto v_src = src.get_view<const SrcST*****,HD>();
           Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int idx) {
             int i,j,k,l,m;
             unflatten_idx(idx,ext,i,j,k,l,m);
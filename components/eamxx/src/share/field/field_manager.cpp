@@ -1,5 +1,8 @@
 #include "share/field/field_manager.hpp"
 
+#include <algorithm>
+#include <cstdlib>
+
 namespace scream
 {
 
@@ -34,9 +37,16 @@ void FieldManager::register_field (const FieldRequest& req)
   } else {
     if (!has_field(id.name())) {
 
-      EKAT_REQUIRE_MSG (id.data_type()==field_valid_data_types().at<Real>(),
-          "Error! While refactoring, we only allow the Field data type to be Real.\n"
-          "       If you're done with refactoring, go back and fix things.\n");
+      // Besides Real, we allow floating point types with a different precision, which
+      // can be used to store some fields (e.g., diagnostics or forcing data) with
+      // reduced precision. Such fields cannot be part of groups though, since groups
+      // may be bundled in a single Real field.
+      EKAT_REQUIRE_MSG (id.data_type()==DataType::FloatType or id.data_type()==DataType::DoubleType,
+          "Error! We only allow floating point data types for fields in the FieldManager.\n"
+          "  - field id: " + id.get_id_string() + "\n");
+      EKAT_REQUIRE_MSG (id.data_type()==DataType::RealType or req.groups.size()==0,
+          "Error! Fields with non-Real data type cannot be added to a group.\n"
+          "  - field id: " + id.get_id_string() + "\n");
       m_fields[id.name()] = std::make_shared<Field>(id);
     } else {
       // Make sure the input field has the same layout and units as the field already stored.
@@ -50,6 +60,15 @@ void FieldManager::register_field (const FieldRequest& req)
           "         - stored field units: " + id0.get_units().to_string() + "\n"
           "       Please, check and make sure all atmosphere processes use the same units.\n");
 
+      EKAT_REQUIRE_MSG(id.data_type()==id0.data_type(),
+          "Error! Field '" + id.name() + "' already registered with different data type:\n"
+          "         - input field data type:  " + e2str(id.data_type()) + "\n"
+          "         - stored field data type: " + e2str(id0.data_type()) + "\n"
+          "       Please, check and make sure all atmosphere processes use the same data type.\n");
+      EKAT_REQUIRE_MSG(id0.data_type()==DataType::RealType or req.groups.size()==0,
+          "Error! Fields with non-Real data type cannot be added to a group.\n"
+          "  - field id: " + id.get_id_string() + "\n");
+
       EKAT_REQUIRE_MSG(id.get_layout()==id0.get_layout(),
           "Error! Field '" + id.name() + "' already registered with different layout:\n"
           "         - input id:  " + id.get_id_string() + "\n"
@@ -223,6 +242,27 @@ init_fields_time_stamp (const util::TimeStamp& t0)
   }
 }
 
+void FieldManager::set_auto_bundle_groups (const bool auto_bundle)
+{
+  EKAT_REQUIRE_MSG (m_repo_state!=RepoState::Closed,
+      "Error! Cannot change the auto-bundling setting after registration has ended.\n");
+
+  m_auto_bundle_groups = auto_bundle;
+}
+
+void FieldManager::
+set_transient_field (const std::string& name, const int first_use, const int last_use)
+{
+  EKAT_REQUIRE_MSG (m_repo_state!=RepoState::Closed,
+      "Error! Cannot declare transient fields after registration has ended.\n");
+  EKAT_REQUIRE_MSG (first_use>=0 and first_use<=last_use,
+      "Error! Invalid live range for transient field.\n"
+      "  - field name: " + name + "\n"
+      "  - live range: [" + std::to_string(first_use) + "," + std::to_string(last_use) + "]\n");
+
+  m_transient_fields[name] = std::make_pair(first_use,last_use);
+}
+
 void FieldManager::registration_begins ()
 {
   // Update the state of the repo
@@ -309,7 +349,26 @@ void FieldManager::registration_ends ()
   // Gather a list of groups to be bundled
   // NOTE: copied groups are always created bundled, but in a second phase,
   //       without creating individual subfields.
-  std::list<std::string> groups_to_bundle, copied_groups;
+  // NOTE: if auto-bundling is on, groups with no request for bundling are bundled
+  //       too, as long as they can be (2+ fields, all with the same 3d scalar layout).
+  //       Since no request requires it, they are removed later if the bundling fails.
+  auto can_auto_bundle = [&](const std::string& gname) {
+    const auto& fnames = m_field_groups.at(gname)->m_fields_names;
+    if (fnames.size()<2) {
+      return false;
+    }
+    const auto& l0 = m_fields.at(fnames.front())->get_header().get_identifier().get_layout();
+    if (l0.type()!=LayoutType::Scalar3D) {
+      return false;
+    }
+    for (const auto& fn : fnames) {
+      if (not (m_fields.at(fn)->get_header().get_identifier().get_layout()==l0)) {
+        return false;
+      }
+    }
+    return true;
+  };
+  std::list<std::string> groups_to_bundle, copied_groups, auto_bundled_groups;
   for (const auto& greqs : m_group_requests) {
     for (const auto& r : greqs.second) {
       if (r.derived_type!=DerivationType::Copy && r.bundling!=Bundling::NotNeeded) {
@@ -320,6 +379,16 @@ void FieldManager::registration_ends ()
       }
     }
   }
+  if (m_auto_bundle_groups) {
+    for (const auto& greqs : m_group_requests) {
+      if (not ekat::contains(copied_groups,greqs.first) &&
+          not ekat::contains(groups_to_bundle,greqs.first) &&
+          can_auto_bundle(greqs.first)) {
+        auto_bundled_groups.push_back(greqs.first);
+      }
+    }
+    groups_to_bundle.insert(groups_to_bundle.end(),auto_bundled_groups.begin(),auto_bundled_groups.end());
+  }
   ::scream::sort(groups_to_bundle);
   ::scream::sort(copied_groups);
   groups_to_bundle.unique();
@@ -410,27 +479,30 @@ void FieldManager::registration_ends ()
 
       auto cluster_ordered_fields = contiguous_superset(groups_fields);
       while (cluster_ordered_fields.size()==0) {
-        // Try to see if there's a group we can remove, that is, a group
-        // for which bundling is only Preferred. If there's no such group,
+        // Try to see if there's a group we can remove. We first remove groups
+        // that no one asked to bundle (added by auto-bundling), and only then
+        // groups for which bundling is only Preferred. If there's no such group,
         // we break the loop, and we will crap out.
 
-        std::list<std::string>::iterator it = cluster.end();
-        for (const auto& gn : cluster) {
-          const auto& reqs = m_group_requests.at(gn);
-          bool remove_this = true;
-          for (const auto& r : reqs) {
-            if (r.bundling==Bundling::Required) {
-              // Can't remove this group, cause at least one request "requires" bundling
-              remove_this = false;
-              break;
+        auto it = std::find_if(cluster.begin(),cluster.end(),
+                               [&](const std::string& gn) {
+                                 return ekat::contains(auto_bundled_groups,gn);
+                               });
+        if (it==cluster.end()) {
+          it = std::find_if(cluster.begin(),cluster.end(),
+                            [&](const std::string& gn) {
+            // Note: the fake __qv__ group has no requests, and can't be removed
+            if (m_group_requests.count(gn)==0) {
+              return false;
             }
-          }
-
-          if (remove_this) {
-            // It's ok to try and remove this group from the cluster
-            it = ekat::find(cluster,gn);
-            break;
-          }
+            for (const auto& r : m_group_requests.at(gn)) {
+              if (r.bundling==Bundling::Required) {
+                // Can't remove this group, cause at least one request "requires" bundling
+                return false;
+              }
+            }
+            return true;
+          });
         }
 
         if (it==cluster.end()) {
@@ -689,9 +761,13 @@ void FieldManager::registration_ends ()
     info.m_bundled = true;
   }
 
+  // Let transient fields with disjoint live ranges share memory
+  allocate_transient_fields ();
+
   for (auto& it : m_fields) {
     if (it.second->is_allocated()) {
-      // If the field has been already allocated, then it was in a bunlded group, so skip it.
+      // If the field has been already allocated, then it was in a bunlded group
+      // (or it shares memory with other transient fields), so skip it.
       continue;
     }
     // A brand new field. Allocate it
@@ -717,10 +793,109 @@ void FieldManager::registration_ends ()
   m_repo_state = RepoState::Closed;
 }
 
+void FieldManager::allocate_transient_fields ()
+{
+  // Fields that belong to a group, or that are involved in a subfield request,
+  // are accessed by other means than their name, so keep them out of this.
+  auto can_share = [&](const std::string& name) {
+    if (not has_field(name) or m_fields.at(name)->is_allocated()) {
+      return false;
+    }
+    for (const auto& it : m_field_groups) {
+      if (ekat::contains(it.second->m_fields_names,name)) {
+        return false;
+      }
+    }
+    for (const auto& it : m_subfield_requests) {
+      if (it.first==name or it.second.parent_name==name) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  using range_t = std::pair<int,int>;
+  std::vector<std::pair<std::string,range_t>> transient;
+  for (const auto& it : m_transient_fields) {
+    if (can_share(it.first)) {
+      transient.push_back(it);
+    }
+  }
+
+  // Process fields by increasing first use: assigning each field to any pool
+  // that is no longer busy gives the minimum number of pools (like in the
+  // classic interval partitioning problem). Among free pools, pick the one
+  // whose size is closest to the field size, to limit wasted memory.
+  std::stable_sort(transient.begin(),transient.end(),
+                   [](const std::pair<std::string,range_t>& a,
+                      const std::pair<std::string,range_t>& b) {
+                     return a.second.first<b.second.first;
+                   });
+
+  struct Pool {
+    std::vector<std::string> fields;
+    int       busy_until;
+    long long size;
+  };
+  std::vector<Pool> pools;
+  for (const auto& it : transient) {
+    auto& header = m_fields.at(it.first)->get_header();
+    auto& ap = header.get_alloc_properties();
+    ap.commit(header.get_identifier().get_layout());
+    const auto size = ap.get_alloc_size();
+
+    int ipool = -1;
+    for (int i=0; i<static_cast<int>(pools.size()); ++i) {
+      const auto& p = pools[i];
+      if (p.busy_until>=it.second.first) {
+        continue;
+      }
+      if (ipool==-1 or std::llabs(p.size-size)<std::llabs(pools[ipool].size-size)) {
+        ipool = i;
+      }
+    }
+    if (ipool==-1) {
+      ipool = pools.size();
+      pools.push_back(Pool{{},-1,0});
+    }
+    auto& pool = pools[ipool];
+    pool.fields.push_back(it.first);
+    pool.busy_until = it.second.second;
+    pool.size = std::max(pool.size,size);
+  }
+
+  // Allocate the pools used by 2+ fields (the others can simply be allocated
+  // as regular fields), and allocate their fields on the pool memory.
+  using namespace ShortFieldTagsNames;
+  const auto nondim = ekat::units::Units::nondimensional();
+  int num_shared_pools = 0;
+  m_shared_memory_savings = 0;
+  for (const auto& p : pools) {
+    if (p.fields.size()<2) {
+      continue;
+    }
+    const int pool_size = (p.size + sizeof(Real) - 1) / sizeof(Real);
+    FieldIdentifier pool_fid("__transient_pool_" + std::to_string(num_shared_pools++) + "__",
+                             FieldLayout({CMP},{pool_size}),nondim,m_grid->name());
+    Field pool(pool_fid);
+    pool.allocate_view();
+    for (const auto& fn : p.fields) {
+      auto& f = *m_fields.at(fn);
+      f.allocate_view(pool);
+      m_shared_memory_fields[fn] = m_transient_fields.at(fn);
+      m_shared_memory_savings += f.get_header().get_alloc_properties().get_alloc_size();
+    }
+    m_shared_memory_savings -= pool.get_header().get_alloc_properties().get_alloc_size();
+  }
+}
+
 void FieldManager::clean_up() {
   // Clear the maps
   m_fields.clear();
   m_field_groups.clear();
+  m_transient_fields.clear();
+  m_shared_memory_fields.clear();
+  m_shared_memory_savings = 0;
 
   // Reset repo state
   m_repo_state = RepoState::Clean;
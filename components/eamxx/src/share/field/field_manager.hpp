@@ -56,6 +56,34 @@ public:
   void registration_ends ();
   void clean_up ();
 
+  // If enabled, every group is bundled if possible, even if no request asked
+  // for it. Groups requested with Bundling::NotNeeded are treated as if their
+  // bundling was Preferred, provided that they contain 2+ fields, all with
+  // the same 3d scalar layout. This allows multi-field kernels (see FieldGroup) to
+  // process the whole group in a single launch. If the groups cannot be all bundled,
+  // the ones added by this option are dropped first, and then the Preferred ones.
+  // NOTE: only FieldGroup ops (deep_copy, scale, update) and the atm procs hashes
+  //       use the bundle. Remappers, TimeInterpolation and output accumulation
+  //       still process the group fields one at a time.
+  // NOTE: must be called before registration ends
+  void set_auto_bundle_groups (const bool auto_bundle);
+  bool get_auto_bundle_groups () const { return m_auto_bundle_groups; }
+
+  // Declare a field as transient: it carries no information across time steps,
+  // and it must hold valid data only in the stages [first_use,last_use] of the
+  // time step, being fully recomputed at stage first_use. The meaning of "stage"
+  // is up to the caller (the AD uses the index of atm procs in execution order).
+  // At registration_ends, transient fields with disjoint live ranges are allocated
+  // on the same memory, unless they belong to a group or to a subfield request.
+  // NOTE: must be called before registration ends
+  void set_transient_field (const std::string& name, const int first_use, const int last_use);
+
+  // The transient fields that ended up sharing memory with other fields, with
+  // their live range, and the memory saved by doing so (in bytes).
+  // NOTE: only meaningful after registration ends
+  const std::map<std::string,std::pair<int,int>>& get_shared_memory_fields () const { return m_shared_memory_fields; }
+  long long get_shared_memory_savings () const { return m_shared_memory_savings; }
+
   // Adds an externally-constructed field to the FieldManager. Allows the FM
   // to make the field available as if it had been built with the usual
   // registration procedures.
@@ -108,6 +136,7 @@ protected:
   std::shared_ptr<Field> get_field_ptr(const identifier_type& id) const;
 
   void pre_process_group_requests ();
+  void allocate_transient_fields ();
 
   // The state of the repository
   RepoState           m_repo_state;
@@ -137,6 +166,15 @@ protected:
   // we 'skip' them, hoping that some other request will contain the right specs.
   // If no complete request is given for that field, we need to error out
   std::list<std::pair<std::string,std::string>> m_incomplete_requests;
+
+  // Whether to bundle groups even if not requested (see set_auto_bundle_groups)
+  bool m_auto_bundle_groups = false;
+
+  // Live ranges of transient fields (see set_transient_field), and the subset
+  // of them that actually shares memory with other fields
+  std::map<std::string,std::pair<int,int>> m_transient_fields;
+  std::map<std::string,std::pair<int,int>> m_shared_memory_fields;
+  long long m_shared_memory_savings = 0;
 };
 
 } // namespace scream
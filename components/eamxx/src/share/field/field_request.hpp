@@ -240,6 +240,14 @@ struct FieldRequest {
    : FieldRequest(FID(name,layout,u,grid),std::list<std::string>{group},ps)
   { /* Nothing to do here */ }
 
+  // Request a field stored with a precision different from Real (e.g., float for
+  // diagnostics or slowly varying forcing data). Such fields cannot belong to groups,
+  // and can be accessed with Real precision by deep copying them into a Real field.
+  FieldRequest (const std::string& name, const FieldLayout& layout, const Units& u, const std::string& grid,
+                const DataType storage_type, const int ps = 1)
+   : FieldRequest(FID(name,layout,u,grid,storage_type),std::list<std::string>{},ps)
+  { /* Nothing to do here */ }
+
   FieldRequest (const FID& fid, const FieldRequest& parent, int idim, int k, bool dynamic)
    : FieldRequest (fid)
   {
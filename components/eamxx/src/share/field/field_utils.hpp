@@ -172,6 +172,64 @@ ST field_min(const Field& f, const ekat::Comm* comm = nullptr)
   return impl::field_min<ST>(f,comm);
 }
 
+// Multi-field versions of the reductions above: all fields are reduced in a single
+// kernel, and (if comm is not null) with a single MPI reduction. This is much cheaper
+// than reducing one field at a time when many (small) fields need to be reduced,
+// e.g., in runtime monitoring or property checks.
+// NOTE: all fields must have data type compatible with ST.
+template<typename ST>
+std::vector<ST> frobenius_norm(const std::vector<Field>& fields, const ekat::Comm* comm = nullptr)
+{
+  for (const auto& f : fields) {
+    EKAT_REQUIRE_MSG (get_data_type<ST>()==f.data_type() and
+                      (f.data_type()==DataType::FloatType || f.data_type()==DataType::DoubleType),
+        "Error! Field data type incompatible with template argument.\n"
+        "  - field name: " + f.name() + "\n");
+  }
+
+  auto norms = impl::fields_reduce<ST>(fields,impl::FieldReduction::SquaredSum,comm);
+  for (auto& n : norms) {
+    n = std::sqrt(n);
+  }
+  return norms;
+}
+
+template<typename ST>
+std::vector<ST> field_sum(const std::vector<Field>& fields, const ekat::Comm* comm = nullptr)
+{
+  for (const auto& f : fields) {
+    EKAT_REQUIRE_MSG (get_data_type<ST>()==f.data_type(),
+        "Error! Field data type incompatible with template argument.\n"
+        "  - field name: " + f.name() + "\n");
+  }
+
+  return impl::fields_reduce<ST>(fields,impl::FieldReduction::Sum,comm);
+}
+
+template<typename ST>
+std::vector<ST> field_max(const std::vector<Field>& fields, const ekat::Comm* comm = nullptr)
+{
+  for (const auto& f : fields) {
+    EKAT_REQUIRE_MSG (get_data_type<ST>()==f.data_type(),
+        "Error! Field data type incompatible with template argument.\n"
+        "  - field name: " + f.name() + "\n");
+  }
+
+  return impl::fields_reduce<ST>(fields,impl::FieldReduction::Max,comm);
+}
+
+template<typename ST>
+std::vector<ST> field_min(const std::vector<Field>& fields, const ekat::Comm* comm = nullptr)
+{
+  for (const auto& f : fields) {
+    EKAT_REQUIRE_MSG (get_data_type<ST>()==f.data_type(),
+        "Error! Field data type incompatible with template argument.\n"
+        "  - field name: " + f.name() + "\n");
+  }
+
+  return impl::fields_reduce<ST>(fields,impl::FieldReduction::Min,comm);
+}
+
 // Prints the value of a field at a certain location, specified by tags and indices.
 // If the field layout contains all the location tags, we will slice the field along
 // those tags, and print it. E.g., f might be a <COL,LEV> field, and the tags/indices
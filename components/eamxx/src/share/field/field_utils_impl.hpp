@@ -7,126 +7,114 @@
 
 #include <limits>
 #include <type_traits>
+#include <vector>
 
 namespace scream {
 
-// Check that two fields store the same entries.
-// NOTE: if the field is padded, padding entries are NOT checked.
 namespace impl {
 
+// A trivially copyable accessor to the entries of a field on device. Entries are
+// accessed via a flat index (as if the field was a LayoutRight array), which allows
+// to run all reductions with a single loop, regardless of the field rank.
+// Since strides are taken from the field strided view, padding entries are skipped,
+// and multi-slice subfields are supported.
+// NOTE: being trivially copyable, we can store these in a device view, and
+//       process several fields in the same kernel.
 template<typename ST>
-bool views_are_equal(const Field& f1, const Field& f2, const ekat::Comm* comm)
+struct FieldEntries {
+  static constexpr int max_rank = 6;
+
+  const ST* data = nullptr;
+  int rank = 0;
+  int size = 0;
+  int extents[max_rank];
+  long long strides[max_rank];
+
+  KOKKOS_INLINE_FUNCTION
+  const ST& operator() (int idx) const {
+    long long offset = 0;
+    for (int d=rank-1; d>=0; --d) {
+      offset += (idx % extents[d])*strides[d];
+      idx /= extents[d];
+    }
+    return data[offset];
+  }
+};
+
+template<typename ST, typename ViewT>
+void set_field_entries_strides (FieldEntries<ST>& fe, const ViewT& v)
 {
-  // Get physical layout (shoudl be the same for both fields)
-  const auto& l1 = f1.get_header().get_identifier().get_layout();
-  const auto& l2 = f2.get_header().get_identifier().get_layout();
-  EKAT_REQUIRE_MSG (l1==l2,
-      "Error! Input fields have different layouts.\n");
+  fe.data = v.data();
+  for (int d=0; d<fe.rank; ++d) {
+    fe.extents[d] = v.extent_int(d);
+    fe.strides[d] = v.stride(d);
+  }
+}
 
-  // For simplicity, we perform the check on Host only. This is not a big
-  // limitation, since this code is likely used only in testing.
-  f1.sync_to_host();
-  f2.sync_to_host();
-
-  // Reshape based on the rank, then loop over all entries.
-  // NOTE: because views_are_equal() is only used for testing, we generalize by
-  // always calling get_strided_view(), even if it could be contiguous.
-  // This allows us to call this function on any type of field,
-  // including multi-slice subfields
-  bool same_locally = true;
-  const auto& dims = l1.dims();
-  switch (l1.rank()) {
+template<typename ST>
+FieldEntries<ST> get_field_entries (const Field& f)
+{
+  EKAT_REQUIRE_MSG (f.is_allocated(),
+      "Error! Cannot access the entries of a field not yet allocated.\n"
+      "  - field name: " + f.name() + "\n");
+
+  const auto& fl = f.get_header().get_identifier().get_layout();
+  FieldEntries<ST> fe;
+  fe.rank = fl.rank();
+  fe.size = fl.size();
+  switch (fe.rank) {
+    case 0:
+      fe.data = f.template get_strided_view<const ST,Device>().data();
+      break;
     case 1:
-      {
-        auto v1 = f1.template get_strided_view<ST*,Host>();
-        auto v2 = f2.template get_strided_view<ST*,Host>();
-        for (int i=0; i<dims[0]; ++i) {
-          if (v1(i) != v2(i)) {
-            same_locally = false;
-            break;
-          }
-        }
-      }
+      set_field_entries_strides(fe,f.template get_strided_view<const ST*,Device>());
       break;
     case 2:
-      {
-        auto v1 = f1.template get_strided_view<ST**,Host>();
-        auto v2 = f2.template get_strided_view<ST**,Host>();
-        for (int i=0; same_locally && i<dims[0]; ++i) {
-          for (int j=0; j<dims[1]; ++j) {
-            if (v1(i,j) != v2(i,j)) {
-              same_locally = false;
-              break;
-            }
-        }}
-      }
+      set_field_entries_strides(fe,f.template get_strided_view<const ST**,Device>());
       break;
     case 3:
-      {
-        auto v1 = f1.template get_strided_view<ST***,Host>();
-        auto v2 = f2.template get_strided_view<ST***,Host>();
-        for (int i=0; same_locally && i<dims[0]; ++i) {
-          for (int j=0; same_locally && j<dims[1]; ++j) {
-            for (int k=0; k<dims[2]; ++k) {
-              if (v1(i,j,k) != v2(i,j,k)) {
-                same_locally = false;
-                break;
-              }
-        }}}
-      }
+      set_field_entries_strides(fe,f.template get_strided_view<const ST***,Device>());
       break;
     case 4:
-      {
-        auto v1 = f1.template get_strided_view<ST****,Host>();
-        auto v2 = f2.template get_strided_view<ST****,Host>();
-        for (int i=0; same_locally && i<dims[0]; ++i) {
-          for (int j=0; same_locally && j<dims[1]; ++j) {
-            for (int k=0; same_locally && k<dims[2]; ++k) {
-              for (int l=0; l<dims[3]; ++l) {
-                if (v1(i,j,k,l) != v2(i,j,k,l)) {
-                  same_locally = false;
-                  break;
-                }
-        }}}}
-      }
+      set_field_entries_strides(fe,f.template get_strided_view<const ST****,Device>());
       break;
     case 5:
-      {
-        auto v1 = f1.template get_strided_view<ST*****,Host>();
-        auto v2 = f2.template get_strided_view<ST*****,Host>();
-        for (int i=0; same_locally && i<dims[0]; ++i) {
-          for (int j=0; same_locally && j<dims[1]; ++j) {
-            for (int k=0; same_locally && k<dims[2]; ++k) {
-              for (int l=0; same_locally && l<dims[3]; ++l) {
-                for (int m=0; m<dims[4]; ++m) {
-                  if (v1(i,j,k,l,m) != v2(i,j,k,l,m)) {
-                    same_locally = false;
-                    break;
-                  }
-        }}}}}
-      }
+      set_field_entries_strides(fe,f.template get_strided_view<const ST*****,Device>());
       break;
     case 6:
-      {
-        auto v1 = f1.template get_strided_view<ST******,Host>();
-        auto v2 = f2.template get_strided_view<ST******,Host>();
-        for (int i=0; same_locally && i<dims[0]; ++i) {
-          for (int j=0; same_locally && j<dims[1]; ++j) {
-            for (int k=0; same_locally && k<dims[2]; ++k) {
-              for (int l=0; same_locally && l<dims[3]; ++l) {
-                for (int m=0; same_locally && m<dims[4]; ++m) {
-                  for (int n=0; n<dims[5]; ++n) {
-                    if (v1(i,j,k,l,m,n) != v2(i,j,k,l,m,n)) {
-                      same_locally = false;
-                      break;
-                    }
-        }}}}}}
-      }
+      set_field_entries_strides(fe,f.template get_strided_view<const ST******,Device>());
       break;
     default:
       EKAT_ERROR_MSG ("Error! Unsupported field rank.\n");
   }
+  return fe;
+}
 
+// Check that two fields store the same entries.
+// NOTE: if the field is padded, padding entries are NOT checked.
+template<typename ST>
+bool views_are_equal(const Field& f1, const Field& f2, const ekat::Comm* comm)
+{
+  // Get physical layout (shoudl be the same for both fields)
+  const auto& l1 = f1.get_header().get_identifier().get_layout();
+  const auto& l2 = f2.get_header().get_identifier().get_layout();
+  EKAT_REQUIRE_MSG (l1==l2,
+      "Error! Input fields have different layouts.\n");
+
+  using nonconst_ST = typename std::remove_const<ST>::type;
+  using RangePolicy = typename KokkosTypes<DefaultDevice>::RangePolicy;
+
+  const auto e1 = get_field_entries<nonconst_ST>(f1);
+  const auto e2 = get_field_entries<nonconst_ST>(f2);
+  int num_diffs = 0;
+  Kokkos::parallel_reduce(RangePolicy(0,e1.size),
+                          KOKKOS_LAMBDA(const int idx, int& n) {
+    if (e1(idx)!=e2(idx)) {
+      ++n;
+    }
+  },num_diffs);
+
+  bool same_locally = num_diffs==0;
   if (comm) {
     bool same_globally;
     comm->all_reduce(&same_locally,&same_globally,1,MPI_LAND);
@@ -283,104 +271,148 @@ void perturb (const Field& f,
   }
 }
 
+// The types of reductions supported by fields_reduce
+enum class FieldReduction {
+  Sum,
+  SquaredSum,
+  Max,
+  Min
+};
+
+// Reduce all the entries of a field on device
 template<typename ST>
-ST frobenius_norm(const Field& f, const ekat::Comm* comm)
+ST field_reduce (const Field& f, const FieldReduction op)
 {
-  const auto& fl = f.get_header().get_identifier().get_layout();
+  using RangePolicy = typename KokkosTypes<DefaultDevice>::RangePolicy;
+
+  const auto e = get_field_entries<ST>(f);
+  const auto policy = RangePolicy(0,e.size);
+  ST result = 0;
+  switch (op) {
+    case FieldReduction::Sum:
+      Kokkos::parallel_reduce(policy,KOKKOS_LAMBDA(const int idx, ST& sum) {
+        sum += e(idx);
+      },Kokkos::Sum<ST>(result));
+      break;
+    case FieldReduction::SquaredSum:
+      Kokkos::parallel_reduce(policy,KOKKOS_LAMBDA(const int idx, ST& sum) {
+        sum += e(idx)*e(idx);
+      },Kokkos::Sum<ST>(result));
+      break;
+    case FieldReduction::Max:
+      Kokkos::parallel_reduce(policy,KOKKOS_LAMBDA(const int idx, ST& max) {
+        max = max>e(idx) ? max : e(idx);
+      },Kokkos::Max<ST>(result));
+      break;
+    case FieldReduction::Min:
+      Kokkos::parallel_reduce(policy,KOKKOS_LAMBDA(const int idx, ST& min) {
+        min = min<e(idx) ? min : e(idx);
+      },Kokkos::Min<ST>(result));
+      break;
+    default:
+      EKAT_ERROR_MSG ("Error! Unsupported field reduction.\n");
+  }
+  return result;
+}
 
-  // TODO: compute directly on device
-  f.sync_to_host();
+// Reduce all the entries of each field in a list with a single kernel
+// launch (one team per field) and a single MPI reduction.
+template<typename ST>
+std::vector<ST> fields_reduce (const std::vector<Field>& fields,
+                               const FieldReduction op,
+                               const ekat::Comm* comm)
+{
+  using KT = KokkosTypes<DefaultDevice>;
+  using MemberType = typename KT::MemberType;
+  using TeamPolicy = typename KT::TeamPolicy;
+
+  const int nfields = fields.size();
+  std::vector<ST> results(nfields);
+  if (nfields==0) {
+    return results;
+  }
 
-  // Note: use Kahan algorithm to increase accuracy
-  ST norm = 0;
-  ST c = 0;
-  ST temp,y;
-  switch (fl.rank()) {
-    case 1:
-      {
-        auto v = f.template get_strided_view<const ST*,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          y = std::pow(v(i),2) - c;
-          temp = norm + y;
-          c = (temp - norm) - y;
-          norm = temp;
-        }
-      }
-      break;
-    case 2:
-      {
-        auto v = f.template get_strided_view<const ST**,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            y = std::pow(v(i,j),2) - c;
-            temp = norm + y;
-            c = (temp - norm) - y;
-            norm = temp;
-        }}
-      }
-      break;
-    case 3:
-      {
-        auto v = f.template get_strided_view<const ST***,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            for (int k=0; k<fl.dim(2); ++k) {
-              y = std::pow(v(i,j,k),2) - c;
-              temp = norm + y;
-              c = (temp - norm) - y;
-              norm = temp;
-        }}}
-      }
-      break;
-    case 4:
-      {
-        auto v = f.template get_strided_view<const ST****,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            for (int k=0; k<fl.dim(2); ++k) {
-              for (int l=0; l<fl.dim(3); ++l) {
-                y = std::pow(v(i,j,k,l),2) - c;
-                temp = norm + y;
-                c = (temp - norm) - y;
-                norm = temp;
-        }}}}
-      }
-      break;
-    case 5:
-      {
-        auto v = f.template get_strided_view<const ST*****,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            for (int k=0; k<fl.dim(2); ++k) {
-              for (int l=0; l<fl.dim(3); ++l) {
-                for (int m=0; m<fl.dim(4); ++m) {
-                  y = std::pow(v(i,j,k,l,m),2) - c;
-                  temp = norm + y;
-                  c = (temp - norm) - y;
-                  norm = temp;
-        }}}}}
-      }
+  typename KT::template view_1d<FieldEntries<ST>> entries ("",nfields);
+  typename KT::template view_1d<ST> results_d ("",nfields);
+  auto entries_h = Kokkos::create_mirror_view(entries);
+  for (int i=0; i<nfields; ++i) {
+    entries_h(i) = get_field_entries<ST>(fields[i]);
+  }
+  Kokkos::deep_copy(entries,entries_h);
+
+  const auto policy = TeamPolicy(nfields,Kokkos::AUTO);
+  switch (op) {
+    case FieldReduction::Sum:
+    case FieldReduction::SquaredSum:
+    {
+      const bool squared = op==FieldReduction::SquaredSum;
+      Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const MemberType& team) {
+        const int ifield = team.league_rank();
+        const auto& e = entries(ifield);
+        ST sum = 0;
+        Kokkos::parallel_reduce(Kokkos::TeamThreadRange(team,e.size),
+                                [&](const int idx, ST& lsum) {
+          lsum += squared ? e(idx)*e(idx) : e(idx);
+        },Kokkos::Sum<ST>(sum));
+        Kokkos::single(Kokkos::PerTeam(team),[&]() {
+          results_d(ifield) = sum;
+        });
+      });
       break;
-    case 6:
-      {
-        auto v = f.template get_strided_view<const ST******,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            for (int k=0; k<fl.dim(2); ++k) {
-              for (int l=0; l<fl.dim(3); ++l) {
-                for (int m=0; m<fl.dim(4); ++m) {
-                  for (int n=0; n<fl.dim(5); ++n) {
-                    y = std::pow(v(i,j,k,l,m,n),2) - c;
-                    temp = norm + y;
-                    c = (temp - norm) - y;
-                    norm = temp;
-        }}}}}}
-      }
+    }
+    case FieldReduction::Max:
+      Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const MemberType& team) {
+        const int ifield = team.league_rank();
+        const auto& e = entries(ifield);
+        ST max;
+        Kokkos::parallel_reduce(Kokkos::TeamThreadRange(team,e.size),
+                                [&](const int idx, ST& lmax) {
+          lmax = lmax>e(idx) ? lmax : e(idx);
+        },Kokkos::Max<ST>(max));
+        Kokkos::single(Kokkos::PerTeam(team),[&]() {
+          results_d(ifield) = max;
+        });
+      });
+      break;
+    case FieldReduction::Min:
+      Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const MemberType& team) {
+        const int ifield = team.league_rank();
+        const auto& e = entries(ifield);
+        ST min;
+        Kokkos::parallel_reduce(Kokkos::TeamThreadRange(team,e.size),
+                                [&](const int idx, ST& lmin) {
+          lmin = lmin<e(idx) ? lmin : e(idx);
+        },Kokkos::Min<ST>(min));
+        Kokkos::single(Kokkos::PerTeam(team),[&]() {
+          results_d(ifield) = min;
+        });
+      });
       break;
     default:
-      EKAT_ERROR_MSG ("Error! Unsupported field rank.\n");
+      EKAT_ERROR_MSG ("Error! Unsupported field reduction.\n");
+  }
+
+  auto results_h = Kokkos::create_mirror_view(results_d);
+  Kokkos::deep_copy(results_h,results_d);
+  for (int i=0; i<nfields; ++i) {
+    results[i] = results_h(i);
   }
 
+  if (comm) {
+    const auto mpi_op = op==FieldReduction::Max ? MPI_MAX
+                      : (op==FieldReduction::Min ? MPI_MIN : MPI_SUM);
+    std::vector<ST> global_results(nfields);
+    comm->all_reduce(results.data(),global_results.data(),nfields,mpi_op);
+    return global_results;
+  }
+  return results;
+}
+
+template<typename ST>
+ST frobenius_norm(const Field& f, const ekat::Comm* comm)
+{
+  ST norm = field_reduce<ST>(f,FieldReduction::SquaredSum);
+
   if (comm) {
     ST global_norm;
     comm->all_reduce(&norm,&global_norm,1,MPI_SUM);
@@ -393,100 +425,7 @@ ST frobenius_norm(const Field& f, const ekat::Comm* comm)
 template<typename ST>
 ST field_sum(const Field& f, const ekat::Comm* comm)
 {
-  const auto& fl = f.get_header().get_identifier().get_layout();
-
-  // TODO: compute directly on device
-  f.sync_to_host();
-
-  // Note: use Kahan algorithm to increase accuracy
-  ST sum = 0;
-  ST c = 0;
-  ST temp,y;
-  switch (fl.rank()) {
-    case 1:
-      {
-        auto v = f.template get_strided_view<const ST*,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          y = v(i) - c;
-          temp = sum + y;
-          c = (temp - sum) - y;
-          sum = temp;
-        }
-      }
-      break;
-    case 2:
-      {
-        auto v = f.template get_strided_view<const ST**,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            y = v(i,j) - c;
-            temp = sum + y;
-            c = (temp - sum) - y;
-            sum = temp;
-        }}
-      }
-      break;
-    case 3:
-      {
-        auto v = f.template get_strided_view<const ST***,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            for (int k=0; k<fl.dim(2); ++k) {
-              y = v(i,j,k) - c;
-              temp = sum + y;
-              c = (temp - sum) - y;
-              sum = temp;
-        }}}
-      }
-      break;
-    case 4:
-      {
-        auto v = f.template get_strided_view<const ST****,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            for (int k=0; k<fl.dim(2); ++k) {
-              for (int l=0; l<fl.dim(3); ++l) {
-                y = v(i,j,k,l) - c;
-                temp = sum + y;
-                c = (temp - sum) - y;
-                sum = temp;
-        }}}}
-      }
-      break;
-    case 5:
-      {
-        auto v = f.template get_strided_view<const ST*****,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            for (int k=0; k<fl.dim(2); ++k) {
-              for (int l=0; l<fl.dim(3); ++l) {
-                for (int m=0; m<fl.dim(4); ++m) {
-                  y = v(i,j,k,l,m) - c;
-                  temp = sum + y;
-                  c = (temp - sum) - y;
-                  sum = temp;
-        }}}}}
-      }
-      break;
-    case 6:
-      {
-        auto v = f.template get_strided_view<const ST******,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            for (int k=0; k<fl.dim(2); ++k) {
-              for (int l=0; l<fl.dim(3); ++l) {
-                for (int m=0; m<fl.dim(4); ++m) {
-                  for (int n=0; n<fl.dim(5); ++n) {
-                    y = v(i,j,k,l,m,n) - c;
-                    temp = sum + y;
-                    c = (temp - sum) - y;
-                    sum = temp;
-        }}}}}}
-      }
-      break;
-    default:
-      EKAT_ERROR_MSG ("Error! Unsupported field rank.\n");
-  }
+  ST sum = field_reduce<ST>(f,FieldReduction::Sum);
 
   if (comm) {
     ST global_sum;
@@ -500,79 +439,7 @@ ST field_sum(const Field& f, const ekat::Comm* comm)
 template<typename ST>
 ST field_max(const Field& f, const ekat::Comm* comm)
 {
-  const auto& fl = f.get_header().get_identifier().get_layout();
-
-  // TODO: compute directly on device
-  f.sync_to_host();
-
-  ST max = std::numeric_limits<ST>::lowest();
-  switch (fl.rank()) {
-    case 1:
-      {
-        auto v = f.template get_strided_view<const ST*,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          max = std::max(max,v(i));
-        }
-      }
-      break;
-    case 2:
-      {
-        auto v = f.template get_strided_view<const ST**,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            max = std::max(max,v(i,j));
-        }}
-      }
-      break;
-    case 3:
-      {
-        auto v = f.template get_strided_view<const ST***,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            for (int k=0; k<fl.dim(2); ++k) {
-              max = std::max(max,v(i,j,k));
-        }}}
-      }
-      break;
-    case 4:
-      {
-        auto v = f.template get_strided_view<const ST****,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            for (int k=0; k<fl.dim(2); ++k) {
-              for (int l=0; l<fl.dim(3); ++l) {
-                max = std::max(max,v(i,j,k,l));
-        }}}}
-      }
-      break;
-    case 5:
-      {
-        auto v = f.template get_strided_view<const ST*****,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            for (int k=0; k<fl.dim(2); ++k) {
-              for (int l=0; l<fl.dim(3); ++l) {
-                for (int m=0; m<fl.dim(4); ++m) {
-                  max = std::max(max,v(i,j,k,l,m));
-        }}}}}
-      }
-      break;
-    case 6:
-      {
-        auto v = f.template get_strided_view<const ST******,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            for (int k=0; k<fl.dim(2); ++k) {
-              for (int l=0; l<fl.dim(3); ++l) {
-                for (int m=0; m<fl.dim(4); ++m) {
-                  for (int n=0; n<fl.dim(5); ++n) {
-                    max = std::max(max,v(i,j,k,l,m,n));
-        }}}}}}
-      }
-      break;
-    default:
-      EKAT_ERROR_MSG ("Error! Unsupported field rank.\n");
-  }
+  ST max = field_reduce<ST>(f,FieldReduction::Max);
 
   if (comm) {
     ST global_max;
@@ -586,79 +453,7 @@ ST field_max(const Field& f, const ekat::Comm* comm)
 template<typename ST>
 ST field_min(const Field& f, const ekat::Comm* comm)
 {
-  const auto& fl = f.get_header().get_identifier().get_layout();
-
-  // TODO: compute directly on device
-  f.sync_to_host();
-
-  ST min = std::numeric_limits<ST>::max();
-  switch (fl.rank()) {
-    case 1:
-      {
-        auto v = f.template get_strided_view<const ST*,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          min = std::min(min,v(i));
-        }
-      }
-      break;
-    case 2:
-      {
-        auto v = f.template get_strided_view<const ST**,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            min = std::min(min,v(i,j));
-        }}
-      }
-      break;
-    case 3:
-      {
-        auto v = f.template get_strided_view<const ST***,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            for (int k=0; k<fl.dim(2); ++k) {
-              min = std::min(min,v(i,j,k));
-        }}}
-      }
-      break;
-    case 4:
-      {
-        auto v = f.template get_strided_view<const ST****,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            for (int k=0; k<fl.dim(2); ++k) {
-              for (int l=0; l<fl.dim(3); ++l) {
-                min = std::min(min,v(i,j,k,l));
-        }}}}
-      }
-      break;
-    case 5:
-      {
-        auto v = f.template get_strided_view<const ST*****,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            for (int k=0; k<fl.dim(2); ++k) {
-              for (int l=0; l<fl.dim(3); ++l) {
-                for (int m=0; m<fl.dim(4); ++m) {
-                  min = std::min(min,v(i,j,k,l,m));
-        }}}}}
-      }
-      break;
-    case 6:
-      {
-        auto v = f.template get_strided_view<const ST******,Host>();
-        for (int i=0; i<fl.dim(0); ++i) {
-          for (int j=0; j<fl.dim(1); ++j) {
-            for (int k=0; k<fl.dim(2); ++k) {
-              for (int l=0; l<fl.dim(3); ++l) {
-                for (int m=0; m<fl.dim(4); ++m) {
-                  for (int n=0; n<fl.dim(5); ++n) {
-                    min = std::min(min,v(i,j,k,l,m,n));
-        }}}}}}
-      }
-      break;
-    default:
-      EKAT_ERROR_MSG ("Error! Unsupported field rank.\n");
-  }
+  ST min = field_reduce<ST>(f,FieldReduction::Min);
 
   if (comm) {
     ST global_min;
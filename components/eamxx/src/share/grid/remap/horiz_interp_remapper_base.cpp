@@ -70,6 +70,22 @@ HorizInterpRemapperBase (const grid_ptr_type& fine_grid,
   }
 }
 
+bool HorizInterpRemapperBase::is_injection () const
+{
+  auto row_offsets = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),m_row_offsets);
+  auto weights     = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),m_weights);
+  const int nrows = static_cast<int>(row_offsets.extent(0))-1;
+  int injection = 1;
+  for (int i=0; injection && i<nrows; ++i) {
+    const int beg = row_offsets(i);
+    const int end = row_offsets(i+1);
+    injection = (end-beg)==1 && weights(beg)==1;
+  }
+  int global_injection;
+  m_comm.all_reduce(&injection,&global_injection,1,MPI_MIN);
+  return global_injection==1;
+}
+
 HorizInterpRemapperBase::
 ~HorizInterpRemapperBase ()
 {
@@ -38,6 +38,10 @@ public:
     return src.clone().strip_dim(COL).congruent(tgt.clone().strip_dim(COL));
   }
 
+  // True if each row of the map has exactly one entry, with weight 1, on all ranks.
+  // For a refining map, this means that each fine dof gets the value of one coarse dof.
+  bool is_injection () const;
+
 protected:
 
   FieldLayout create_layout (const FieldLayout& fl_in,
@@ -11,6 +11,7 @@
 #include <ekat/kokkos/ekat_kokkos_utils.hpp>
 #include <ekat/ekat_pack_utils.hpp>
 #include <ekat/ekat_pack_kokkos.hpp>
+#include <ekat/util/ekat_math_utils.hpp>
 
 #include <numeric>
 
@@ -33,8 +34,21 @@ VerticalRemapper (const grid_ptr_type& src_grid,
                   const Field& pmid_src,
                   const Field& pint_src,
                   const Real mask_val)
+  : VerticalRemapper(src_grid,map_file,pmid_src,pint_src,mask_val,VerticalRemapType::Linear)
+{
+  // Nothing to do here
+}
+
+VerticalRemapper::
+VerticalRemapper (const grid_ptr_type& src_grid,
+                  const std::string& map_file,
+                  const Field& pmid_src,
+                  const Field& pint_src,
+                  const Real mask_val,
+                  const VerticalRemapType type)
  : AbstractRemapper()
  , m_comm (src_grid->get_comm())
+ , m_type (type)
  , m_mask_val(mask_val)
 {
   using namespace ShortFieldTagsNames;
@@ -55,8 +69,17 @@ VerticalRemapper (const grid_ptr_type& src_grid,
   // remapping the target field will be defined on the same DOFs
   // as the source field, but will have a different number of 
   // vertical levels.
+  // For PPM, the map file specifies the interfaces of the tgt layers
   scorpio::register_file(map_file,scorpio::FileMode::Read);
-  auto nlevs_tgt = scorpio::get_dimlen(map_file,"lev");
+  int nlevs_tgt;
+  if (m_type==VerticalRemapType::PPM) {
+    EKAT_REQUIRE_MSG (scorpio::has_var(map_file,"p_ilevs"),
+        "Error! PPM vertical remap requires the 'p_ilevs' variable in the map file.\n"
+        "  - map file: " + map_file + "\n");
+    nlevs_tgt = scorpio::get_dimlen(map_file,"ilev") - 1;
+  } else {
+    nlevs_tgt = scorpio::get_dimlen(map_file,"lev");
+  }
 
   auto tgt_grid = src_grid->clone("vertical_remap_tgt_grid",true);
   tgt_grid->reset_num_vertical_lev(nlevs_tgt);
@@ -152,8 +175,31 @@ set_pressure_levels(const std::string& map_file)
   m_tgt_pressure.get_header().get_alloc_properties().request_allocation(SCREAM_PACK_SIZE);
   m_tgt_pressure.allocate_view();
 
-  auto remap_pres_data = m_tgt_pressure.get_view<Real*,Host>().data();
-  scorpio::read_var(map_file,"p_levs",remap_pres_data);
+  if (m_type==VerticalRemapType::PPM) {
+    // Read the tgt layers interfaces, and set the tgt pressure to the layers midpoints
+    FieldIdentifier ifid("p_ilevs",m_tgt_grid->get_vertical_layout(false),ekat::units::Pa,m_tgt_grid->name());
+    m_tgt_pint = Field(ifid);
+    m_tgt_pint.allocate_view();
+
+    auto pint_h = m_tgt_pint.get_view<Real*,Host>();
+    auto pmid_h = m_tgt_pressure.get_view<Real*,Host>();
+    scorpio::read_var(map_file,"p_ilevs",pint_h.data());
+
+    const int nlevs_tgt = m_tgt_grid->get_num_vertical_levels();
+    for (int k=0; k<nlevs_tgt; ++k) {
+      EKAT_REQUIRE_MSG (pint_h(k+1)>pint_h(k),
+          "Error! Target interface pressures must be strictly increasing.\n"
+          "  - map file: " + map_file + "\n"
+          "  - p_ilevs(" + std::to_string(k) + "): " + std::to_string(pint_h(k)) + "\n"
+          "  - p_ilevs(" + std::to_string(k+1) + "): " + std::to_string(pint_h(k+1)) + "\n");
+      pmid_h(k) = 0.5*(pint_h(k)+pint_h(k+1));
+    }
+
+    m_tgt_pint.sync_to_dev();
+  } else {
+    auto remap_pres_data = m_tgt_pressure.get_view<Real*,Host>().data();
+    scorpio::read_var(map_file,"p_levs",remap_pres_data);
+  }
 
   m_tgt_pressure.sync_to_dev();
 }
@@ -226,6 +272,11 @@ do_bind_field (const int ifield, const field_type& src, const field_type& tgt)
     // Determine if this field can be handled with packs, and whether it's at midpoints
     // Add mask tracking to the target field. The mask tracks location of tgt pressure levs that are outside the
     // bounds of the src pressure field, and hence cannot be recovered by interpolation
+    EKAT_REQUIRE_MSG (m_type!=VerticalRemapType::PPM or src_layout.has_tag(LEV),
+        "[VerticalRemapper::do_bind_field] Error! PPM remap only supports midpoint fields.\n"
+        " - src field name: " + src.name() + "\n"
+        " - src field layout: " + src_layout.to_string() + "\n");
+
     auto& ft = m_field2type[src.name()];
     ft.midpoints = src.get_header().get_identifier().get_layout().has_tag(LEV);
     ft.packed    = src.get_header().get_alloc_properties().is_compatible<PackT>() and
@@ -300,14 +351,22 @@ do_bind_field (const int ifield, const field_type& src, const field_type& tgt)
   }
 
   if (this->m_num_bound_fields==this->m_num_registered_fields) {
-    create_lin_interp ();
+    if (m_type==VerticalRemapType::PPM) {
+      create_ppm_remap_data ();
+    } else {
+      create_lin_interp ();
+    }
   }
 }
 
 void VerticalRemapper::do_registration_ends ()
 {
   if (this->m_num_bound_fields==this->m_num_registered_fields) {
-    create_lin_interp ();
+    if (m_type==VerticalRemapType::PPM) {
+      create_ppm_remap_data ();
+    } else {
+      create_lin_interp ();
+    }
   }
 }
 
@@ -361,30 +420,116 @@ void VerticalRemapper::create_lin_interp()
   }
 }
 
-void VerticalRemapper::do_remap_fwd ()
+void VerticalRemapper::create_ppm_remap_data()
 {
-  // 1. Setup any interp object that was created (if nullptr, no fields need it)
-  if (m_lin_interp_mid_packed) {
-    setup_lin_interp(*m_lin_interp_mid_packed,m_src_pmid);
+  using namespace ShortFieldTagsNames;
+
+  const int ncols     = m_src_grid->get_num_local_dofs();
+  const int nlevs_src = m_src_grid->get_num_vertical_levels();
+  const int nlevs_tgt = m_tgt_grid->get_num_vertical_levels();
+
+  // All vertical fields are remapped in one kernel, so flatten each
+  // (field,component) pair into a slice, storing ptrs/strides of its data.
+  // Masks are remapped like any other field, but with mask value 0.
+  std::vector<PPMSlice> slices;
+  auto add_slices = [&](const Field& src, const Field& tgt, const Real mask_val) {
+    switch (src.rank()) {
+      case 2:
+      {
+        auto src_v = src.get_view<const Real**>();
+        auto tgt_v = tgt.get_view<      Real**>();
+        slices.push_back({src_v.data(),tgt_v.data(),
+                          static_cast<int>(src_v.stride(0)),
+                          static_cast<int>(tgt_v.stride(0)),
+                          mask_val});
+        break;
+      }
+      case 3:
+      {
+        auto src_v = src.get_view<const Real***>();
+        auto tgt_v = tgt.get_view<      Real***>();
+        const int ncomps = src_v.extent_int(1);
+        for (int icmp=0; icmp<ncomps; ++icmp) {
+          slices.push_back({src_v.data()+icmp*src_v.stride(1),
+                            tgt_v.data()+icmp*tgt_v.stride(1),
+                            static_cast<int>(src_v.stride(0)),
+                            static_cast<int>(tgt_v.stride(0)),
+                            mask_val});
+        }
+        break;
+      }
+      default:
+        EKAT_ERROR_MSG (
+            "[VerticalRemapper::create_ppm_remap_data] Error! Unsupported field rank.\n"
+            " - src field name: " + src.name() + "\n"
+            " - src field rank: " + std::to_string(src.rank()) + "\n");
+    }
+  };
+
+  for (int i=0; i<m_num_fields; ++i) {
+    const auto& tgt_layout = m_tgt_fields[i].get_header().get_identifier().get_layout();
+    if (tgt_layout.has_tag(LEV)) {
+      add_slices(m_src_fields[i],m_tgt_fields[i],m_mask_val);
+    }
   }
-  if (m_lin_interp_int_packed) {
-    setup_lin_interp(*m_lin_interp_int_packed,m_src_pint);
+  for (size_t i=0; i<m_tgt_masks.size(); ++i) {
+    add_slices(m_src_masks[i],m_tgt_masks[i],0);
   }
-  if (m_lin_interp_mid_scalar) {
-    setup_lin_interp(*m_lin_interp_mid_scalar,m_src_pmid);
+
+  m_ppm_slices = view_1d<PPMSlice>("ppm_slices",slices.size());
+  auto slices_h = Kokkos::create_mirror_view(m_ppm_slices);
+  for (size_t i=0; i<slices.size(); ++i) {
+    slices_h(i) = slices[i];
   }
-  if (m_lin_interp_int_scalar) {
-    setup_lin_interp(*m_lin_interp_int_scalar,m_src_pint);
+  Kokkos::deep_copy(m_ppm_slices,slices_h);
+
+  // Work arrays, allocated only once
+  if (m_ppm_idx.size()==0) {
+    m_ppm_idx   = view_2d<int> ("ppm_idx",  ncols,nlevs_tgt+1);
+    m_ppm_xi    = view_2d<Real>("ppm_xi",   ncols,nlevs_tgt+1);
+    m_ppm_slope = view_2d<Real>("ppm_slope",ncols,nlevs_src);
+    m_ppm_edge  = view_2d<Real>("ppm_edge", ncols,nlevs_src+1);
+    m_ppm_left  = view_2d<Real>("ppm_left", ncols,nlevs_src);
+    m_ppm_right = view_2d<Real>("ppm_right",ncols,nlevs_src);
+    m_ppm_mass  = view_2d<Real>("ppm_mass", ncols,nlevs_src+1);
   }
+}
 
+void VerticalRemapper::do_remap_fwd ()
+{
   using namespace ShortFieldTagsNames;
 
+  const bool ppm = m_type==VerticalRemapType::PPM;
+
+  // 1. For PPM, remap all vertical fields (and masks) at once. Otherwise,
+  //    setup any interp object that was created (if nullptr, no fields need it)
+  if (ppm) {
+    apply_ppm_remap ();
+  } else {
+    if (m_lin_interp_mid_packed) {
+      setup_lin_interp(*m_lin_interp_mid_packed,m_src_pmid);
+    }
+    if (m_lin_interp_int_packed) {
+      setup_lin_interp(*m_lin_interp_int_packed,m_src_pint);
+    }
+    if (m_lin_interp_mid_scalar) {
+      setup_lin_interp(*m_lin_interp_mid_scalar,m_src_pmid);
+    }
+    if (m_lin_interp_int_scalar) {
+      setup_lin_interp(*m_lin_interp_int_scalar,m_src_pint);
+    }
+  }
+
   // 2. Interpolate the fields
   for (int i=0; i<m_num_fields; ++i) {
     const auto& f_src    = m_src_fields[i];
           auto& f_tgt    = m_tgt_fields[i];
     const auto& tgt_layout   = f_tgt.get_header().get_identifier().get_layout();
     if (tgt_layout.has_tag(LEV)) {
+      if (ppm) {
+        // Already remapped above
+        continue;
+      }
       const auto& type = m_field2type.at(f_src.name());
       // Dispatch interpolation to the proper lin interp object
       if (type.midpoints) {
@@ -413,7 +558,10 @@ void VerticalRemapper::do_remap_fwd ()
     }
   }
 
-  // 3. Interpolate the mask fields
+  // 3. Interpolate the mask fields (for PPM, this was already done)
+  if (ppm) {
+    return;
+  }
   for (unsigned i=0; i<m_tgt_masks.size(); ++i) {
           auto& f_src = m_src_masks[i];
           auto& f_tgt = m_tgt_masks[i];
@@ -557,4 +705,166 @@ apply_vertical_interpolation(const ekat::LinInterp<Real,Packsize>& lin_interp,
   }
 }
 
+void VerticalRemapper::apply_ppm_remap () const
+{
+  // Conservative, monotone PPM remap (Colella-Woodward 1984, with non-uniform
+  // cells), treating src fields as layer averages in pressure coordinate.
+  // Tgt layers that are not fully contained in the src column are masked.
+  using TeamMember = typename KT::MemberType;
+  using ESU = ekat::ExeSpaceUtils<KT::ExeSpace>;
+
+  const int ncols     = m_src_grid->get_num_local_dofs();
+  const int nlevs_src = m_src_grid->get_num_vertical_levels();
+  const int nlevs_tgt = m_tgt_grid->get_num_vertical_levels();
+  const int nslices   = m_ppm_slices.extent_int(0);
+
+  auto p_src  = m_src_pint.get_view<const Real**>();
+  auto p_tgt  = m_tgt_pint.get_view<const Real*>();
+  auto slices = m_ppm_slices;
+  auto idx    = m_ppm_idx;
+  auto xi     = m_ppm_xi;
+  auto slope  = m_ppm_slope;
+  auto edge   = m_ppm_edge;
+  auto left   = m_ppm_left;
+  auto right  = m_ppm_right;
+  auto mass   = m_ppm_mass;
+
+  auto lambda = KOKKOS_LAMBDA(const TeamMember& team) {
+    const int icol = team.league_rank();
+    auto dp = [&](const int k) {
+      return p_src(icol,k+1) - p_src(icol,k);
+    };
+
+    // 1. Find the src layer containing each tgt interface (or -1 if out of bounds)
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team,nlevs_tgt+1),
+                         [&](const int i) {
+      const Real p = p_tgt(i);
+      if (p<p_src(icol,0) or p>p_src(icol,nlevs_src)) {
+        idx(icol,i) = -1;
+        return;
+      }
+      int lo = 0, hi = nlevs_src;
+      while (hi-lo>1) {
+        const int mid = (lo+hi)/2;
+        if (p_src(icol,mid)<=p) {
+          lo = mid;
+        } else {
+          hi = mid;
+        }
+      }
+      idx(icol,i) = lo;
+      xi(icol,i) = (p - p_src(icol,lo)) / dp(lo);
+    });
+    team.team_barrier();
+
+    // 2. Remap each slice, reusing the partition computed above
+    for (int is=0; is<nslices; ++is) {
+      const auto& s = slices(is);
+      auto q = [&](const int k) {
+        return s.src[icol*s.src_col_stride+k];
+      };
+
+      // 2.1 Monotonized slopes (zero in the boundary layers)
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team,nlevs_src),
+                           [&](const int k) {
+        Real dm = 0;
+        if (k>0 and k<nlevs_src-1) {
+          const Real dqm = q(k)-q(k-1);
+          const Real dqp = q(k+1)-q(k);
+          if (dqm*dqp>0) {
+            const Real dxm = dp(k-1), dx = dp(k), dxp = dp(k+1);
+            const Real da = dx/(dxm+dx+dxp) * ( (2*dxm+dx)/(dxp+dx)*dqp
+                                              + (dx+2*dxp)/(dxm+dx)*dqm );
+            // Since dqm and dqp have the same sign, so does da
+            if (dqm>0) {
+              dm = ekat::impl::min(da,ekat::impl::min(2*dqm,2*dqp));
+            } else {
+              dm = ekat::impl::max(da,ekat::impl::max(2*dqm,2*dqp));
+            }
+          }
+        }
+        slope(icol,k) = dm;
+      });
+      team.team_barrier();
+
+      // 2.2 Values at src interfaces (4th order in the interior)
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team,nlevs_src+1),
+                           [&](const int i) {
+        if (i==0) {
+          edge(icol,i) = q(0);
+        } else if (i==nlevs_src) {
+          edge(icol,i) = q(nlevs_src-1);
+        } else {
+          const int k = i-1;
+          const Real dx = dp(k), dxp = dp(k+1);
+          const Real dq = q(k+1)-q(k);
+          Real e = q(k) + dx/(dx+dxp)*dq;
+          if (k>0 and k<nlevs_src-2) {
+            const Real dxm = dp(k-1), dxpp = dp(k+2);
+            e += 1/(dxm+dx+dxp+dxpp) *
+                 ( 2*dxp*dx/(dx+dxp) * ((dxm+dx)/(2*dx+dxp) - (dxpp+dxp)/(2*dxp+dx)) * dq
+                   - dx*(dxm+dx)/(2*dx+dxp) * slope(icol,k+1)
+                   + dxp*(dxp+dxpp)/(dx+2*dxp) * slope(icol,k) );
+          }
+          edge(icol,i) = e;
+        }
+      });
+      team.team_barrier();
+
+      // 2.3 Limit the parabolas, so that they are monotone within each layer,
+      //     and compute the cumulative mass at src interfaces
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team,nlevs_src),
+                           [&](const int k) {
+        const Real a = q(k);
+        Real aL = edge(icol,k);
+        Real aR = edge(icol,k+1);
+        const Real da = aR-aL;
+        if ((aR-a)*(a-aL)<=0) {
+          aL = aR = a;
+        } else if (da*(a-(aL+aR)/2) > da*da/6) {
+          aL = 3*a - 2*aR;
+        } else if (-da*da/6 > da*(a-(aL+aR)/2)) {
+          aR = 3*a - 2*aL;
+        }
+        left(icol,k)  = aL;
+        right(icol,k) = aR;
+      });
+      Kokkos::single(Kokkos::PerTeam(team),[&](){
+        mass(icol,0) = 0;
+      });
+      Kokkos::parallel_scan(Kokkos::TeamThreadRange(team,nlevs_src),
+                            [&](const int k, Real& accumulator, const bool last) {
+        accumulator += q(k)*dp(k);
+        if (last) {
+          mass(icol,k+1) = accumulator;
+        }
+      });
+      team.team_barrier();
+
+      // 2.4 Tgt values are the mass between tgt interfaces divided by tgt thickness
+      auto cum_mass = [&](const int i) {
+        const int  k = idx(icol,i);
+        const Real x = xi(icol,i);
+        const Real aL = left(icol,k);
+        const Real aR = right(icol,k);
+        const Real a6 = 6*(q(k) - (aL+aR)/2);
+        return mass(icol,k) + dp(k)*x*(aL + x*((aR-aL)/2 + a6*(Real(0.5) - x/3)));
+      };
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team,nlevs_tgt),
+                           [&](const int k) {
+        auto& y = s.tgt[icol*s.tgt_col_stride+k];
+        if (idx(icol,k)<0 or idx(icol,k+1)<0) {
+          y = s.mask_val;
+        } else {
+          y = (cum_mass(k+1) - cum_mass(k)) / (p_tgt(k+1)-p_tgt(k));
+        }
+      });
+      team.team_barrier();
+    }
+  };
+
+  auto policy = ESU::get_default_team_policy(ncols,nlevs_src);
+  Kokkos::parallel_for("VerticalRemapper::apply_ppm_remap",policy,lambda);
+}
+
 } // namespace scream
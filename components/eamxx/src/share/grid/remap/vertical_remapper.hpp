@@ -8,6 +8,44 @@
 namespace scream
 {
 
+/*
+ * The type of vertical remap to perform:
+ *  - Linear: linear interpolation in pressure onto a set of target
+ *    midpoint pressures (read from the 'p_levs' variable of the map file)
+ *  - PPM: mass-conservative, monotone piecewise-parabolic remap onto a set
+ *    of target layers, defined by their interface pressures (read from the
+ *    'p_ilevs' variable of the map file). Only midpoint fields are supported.
+ */
+enum class VerticalRemapType {
+  Linear,
+  PPM
+};
+
+inline std::string e2str (const VerticalRemapType type) {
+  std::string str;
+  switch (type) {
+    case VerticalRemapType::Linear:
+      str = "linear";
+      break;
+    case VerticalRemapType::PPM:
+      str = "ppm";
+      break;
+    default:
+      str = "INVALID";
+      break;
+  }
+
+  return str;
+}
+
+inline VerticalRemapType str2vertical_remap_type (const std::string& s) {
+  EKAT_REQUIRE_MSG (s=="linear" or s=="ppm",
+      "Error! Unrecognized vertical remap type.\n"
+      "  - input value: " + s + "\n"
+      "  - valid values: linear, ppm\n");
+  return s=="ppm" ? VerticalRemapType::PPM : VerticalRemapType::Linear;
+}
+
 /*
  * A remapper to interpolate fields on a separate vertical grid
  */
@@ -16,6 +54,14 @@ class VerticalRemapper : public AbstractRemapper
 {
 public:
 
+  VerticalRemapper (const grid_ptr_type& src_grid,
+                    const std::string& map_file,
+                    const Field& lev_prof,
+                    const Field& ilev_prof,
+                    const Real mask_val,
+                    const VerticalRemapType type);
+
+  // Calls the above one, with type=Linear
   VerticalRemapper (const grid_ptr_type& src_grid,
                     const std::string& map_file,
                     const Field& lev_prof,
@@ -30,6 +76,8 @@ public:
 
   ~VerticalRemapper () = default;
 
+  VerticalRemapType get_remap_type () const { return m_type; }
+
   FieldLayout create_src_layout (const FieldLayout& tgt_layout) const override;
   FieldLayout create_tgt_layout (const FieldLayout& src_layout) const override;
 
@@ -105,10 +153,23 @@ public:
   template<int N>
   void setup_lin_interp (const ekat::LinInterp<Real,N>& lin_interp,
                          const Field& p_src) const;
+
+  void apply_ppm_remap () const;
+
+  // A single column-slice of a (field,component) pair. Since all fields
+  // are remapped in the same kernel, we store raw pointers and strides.
+  struct PPMSlice {
+    const Real* src;
+    Real*       tgt;
+    int         src_col_stride;
+    int         tgt_col_stride;
+    Real        mask_val;
+  };
 protected:
 
   void set_source_pressure_fields(const Field& pmid, const Field& pint);
   void create_lin_interp ();
+  void create_ppm_remap_data ();
   
   using KT = KokkosTypes<DefaultDevice>;
 
@@ -119,6 +180,8 @@ protected:
 
   ekat::Comm            m_comm;
 
+  VerticalRemapType     m_type;
+
   // Source and target fields
   std::vector<Field>    m_src_fields;
   std::vector<Field>    m_tgt_fields;
@@ -128,6 +191,7 @@ protected:
   // Vertical profile fields, both for source and target
   Real                  m_mask_val;
   Field                 m_tgt_pressure;
+  Field                 m_tgt_pint;  // Tgt layers interfaces (PPM only)
   Field                 m_src_pmid;  // Src vertical profile for LEV layouts
   Field                 m_src_pint;  // Src vertical profile for ILEV layouts
 
@@ -145,6 +209,18 @@ protected:
   std::shared_ptr<ekat::LinInterp<Real,SCREAM_PACK_SIZE>> m_lin_interp_int_packed;
   std::shared_ptr<ekat::LinInterp<Real,1>>                m_lin_interp_mid_scalar;
   std::shared_ptr<ekat::LinInterp<Real,1>>                m_lin_interp_int_scalar;
+
+  // PPM remap data. The src/tgt partition (the src layer containing each tgt
+  // interface, and the normalized position within it) is computed once per
+  // column, and reused for all fields.
+  view_1d<PPMSlice>     m_ppm_slices;
+  view_2d<int>          m_ppm_idx;
+  view_2d<Real>         m_ppm_xi;
+  view_2d<Real>         m_ppm_slope;
+  view_2d<Real>         m_ppm_edge;
+  view_2d<Real>         m_ppm_left;
+  view_2d<Real>         m_ppm_right;
+  view_2d<Real>         m_ppm_mass;
 };
 
 } // namespace scream
@@ -12,10 +12,32 @@
 
 #include <numeric>
 #include <fstream>
+#include <type_traits>
 
 namespace scream
 {
 
+namespace {
+
+// Fields can be stored with a floating point type other than Real (see FieldRequest).
+// We don't need to handle their data in full generality: such fields are never
+// subfields of other fields, and they have no padding, so we can use their flattened data.
+using OtherReal = std::conditional<std::is_same<Real,double>::value,float,double>::type;
+const OtherReal* get_other_real_data (const Field& f)
+{
+  EKAT_REQUIRE_MSG (f.data_type()==get_data_type<OtherReal>(),
+      "Error! I/O supports only floating point data.\n"
+      " - field name: " + f.name() + "\n"
+      " - data type : " + e2str(f.data_type()) + "\n");
+  EKAT_REQUIRE_MSG (f.get_header().get_alloc_properties().get_padding()==0 and
+                    f.get_header().get_parent().expired(),
+      "Error! I/O of non-Real fields requires the field to be a non-padded, non-subfield.\n"
+      " - field name: " + f.name() + "\n");
+  return f.get_internal_view_data<const OtherReal,Device>();
+}
+
+} // anonymous namespace
+
 // This helper function updates the current output val with a new one,
 // according to the "averaging" type, and according to the number of
 // model time steps since the last output step.
@@ -188,6 +210,26 @@ AtmosphereOutput (const ekat::Comm& comm, const ekat::ParameterList& params,
   // Register any diagnostics needed by this output stream
   set_diagnostics();
 
+  // Remappers only handle Real data. Non-Real fields (see FieldRequest) can only be
+  // output on the native grid, so check it now, rather than failing inside the remap.
+  if (use_vertical_remap_from_file or use_horiz_remap_from_file or use_online_remapper) {
+    for (const auto& fname : m_fields_names) {
+      const auto f = get_field(fname,"sim");
+      const auto& fid = f.get_header().get_identifier();
+      EKAT_REQUIRE_MSG (fid.data_type()==DataType::RealType,
+          "Error! Remapped output only supports fields with Real data type.\n"
+          "  - field name: " + fname + "\n"
+          "  - data type : " + e2str(fid.data_type()) + "\n"
+          "  - layout    : " + fid.get_layout().to_string() + "\n"
+          "  - sim grid  : " + fm_grid->name() + "\n"
+          "  - io grid   : " + io_grid->name() + "\n"
+          "  - remap     : " + (use_vertical_remap_from_file ? "vertical " : "")
+                               + (use_horiz_remap_from_file ? "horizontal " : "")
+                               + (use_online_remapper ? "online" : "") + "\n"
+          "Either output this field without remapping, or request it with Real data type.\n");
+    }
+  }
+
   // Avg count only makes sense if we have
   //  - non-instant output
   //  - we have one between:
@@ -229,7 +271,11 @@ AtmosphereOutput (const ekat::Comm& comm, const ekat::ParameterList& params,
     auto vert_remap_file   = params.get<std::string>("vertical_remap_file");
     auto f_lev = get_field("p_mid","sim");
     auto f_ilev = get_field("p_int","sim");
-    m_vert_remapper = std::make_shared<VerticalRemapper>(io_grid,vert_remap_file,f_lev,f_ilev,m_fill_value);
+    auto vert_remap_type   = VerticalRemapType::Linear;
+    if (params.isParameter("vertical_remap_type")) {
+      vert_remap_type = str2vertical_remap_type(params.get<std::string>("vertical_remap_type"));
+    }
+    m_vert_remapper = std::make_shared<VerticalRemapper>(io_grid,vert_remap_file,f_lev,f_ilev,m_fill_value,vert_remap_type);
     io_grid = m_vert_remapper->get_tgt_grid();
     set_grid(io_grid);
 
@@ -484,6 +530,7 @@ run (const std::string& filename,
     const bool is_diagnostic = (m_diagnostics.find(name) != m_diagnostics.end());
     const bool is_aliasing_field_view =
         m_avg_type==OutputAvgType::Instant &&
+        field.data_type()==DataType::RealType &&
         field.get_header().get_alloc_properties().get_padding()==0 &&
         field.get_header().get_parent().expired() &&
         not is_diagnostic;
@@ -498,7 +545,21 @@ run (const std::string& filename,
 
     // If the dev_view_1d is aliasing the field device view (must be Instant output),
     // then there's no point in copying from the field's view to dev_view
-    if (not is_aliasing_field_view) {
+    if (field.data_type()!=DataType::RealType) {
+      // The field is stored with a different precision: convert on the fly.
+      // Note: fill_value may not be representable in the field precision
+      const auto src_data = get_other_real_data(field);
+      const OtherReal src_fill_value = fill_value;
+      auto avg_view_1d = view_Nd_dev<1>(data,layout.size());
+      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int i) {
+        const Real new_val = src_data[i]==src_fill_value ? fill_value : Real(src_data[i]);
+        if (do_avg_cnt) {
+          combine_and_fill(new_val,avg_view_1d(i),avg_type,fill_value);
+        } else {
+          combine(new_val,avg_view_1d(i),avg_type);
+        }
+      });
+    } else if (not is_aliasing_field_view) {
       switch (rank) {
         case 1:
         {
@@ -681,6 +742,7 @@ res_dep_memory_footprint () const {
     bool is_diagnostic = (m_diagnostics.find(fn) != m_diagnostics.end());
     bool can_alias_field_view =
         m_avg_type==OutputAvgType::Instant && not is_diagnostic &&
+        io_field_mgr->get_field(fn).data_type()==DataType::RealType &&
         io_field_mgr->get_field(fn).get_header().get_alloc_properties().get_padding()==0 &&
         io_field_mgr->get_field(fn).get_header().get_parent().expired();
 
@@ -808,6 +870,7 @@ void AtmosphereOutput::register_views()
     // with another diagnostic.
     bool can_alias_field_view =
         m_avg_type==OutputAvgType::Instant &&
+        field.data_type()==DataType::RealType &&
         field.get_header().get_alloc_properties().get_padding()==0 &&
         field.get_header().get_parent().expired() &&
         not is_diagnostic;
@@ -1316,124 +1379,14 @@ AtmosphereOutput::create_diagnostic (const std::string& diag_field_name) {
 
   // Construct a diagnostic by this name
   ekat::ParameterList params;
-  std::string diag_name;
   std::string diag_avg_cnt_name = "";
+  const auto& grid_name = get_field_manager("sim")->get_grid()->name();
+  const auto diag_name = get_diagnostic_params(diag_field_name,grid_name,m_fill_value,params,diag_avg_cnt_name);
 
-  if (diag_field_name.find("_at_")!=std::string::npos) {
-    // The diagnostic must be one of
-    //  - ${field_name}_at_lev_${N}     <- interface fields still use "_lev_"
-    //  - ${field_name}_at_model_bot
-    //  - ${field_name}_at_model_top
-    //  - ${field_name}_at_${M}X
-    // where M/N are numbers (N integer), X=Pa, hPa, mb, or m
-    auto tokens = ekat::split(diag_field_name,"_at_");
-    EKAT_REQUIRE_MSG (tokens.size()==2,
-        "Error! Unexpected diagnostic name: " + diag_field_name + "\n");
-
-    const auto& fname = tokens.front();
-    params.set("field_name",fname);
-    params.set("grid_name",get_field_manager("sim")->get_grid()->name());
-
-    params.set("vertical_location", tokens[1]);
-    params.set<double>("mask_value",m_fill_value);
-
-    // Conventions on notation (N=any integer):
-    // FieldAtLevel        : var_at_lev_N, var_at_model_top, var_at_model_bot
-    // FieldAtPressureLevel: var_at_Nx, with x=mb,Pa,hPa
-    // FieldAtHeight       : var_at_Nm_above_Y (Y=sealevel or surface)
-    if (tokens[1].find_first_of("0123456789.")==0) {
-      auto units_start = tokens[1].find_first_not_of("0123456789.");
-      auto units = tokens[1].substr(units_start);
-      if (units.find("_above_") != std::string::npos) {
-        // The field is at a height above a specific reference.
-        // Currently we only support FieldAtHeight above "sealevel" or "surface"
-        auto subtokens = ekat::split(units,"_above_");
-        params.set("surface_reference",subtokens[1]);
-        units = subtokens[0];
-        // Need to reset the vertical location to strip the "_above_" part of the string.
-              params.set("vertical_location", tokens[1].substr(0,units_start)+subtokens[0]);
-        // If the slice is "above_sealevel" then we need to track the avg cnt uniquely.
-        // Note, "above_surface" is expected to never have masking and can thus use
-        // the typical 2d layout avg cnt.
-        if (subtokens[1]=="sealevel") {
-                diag_avg_cnt_name = "_" + tokens[1]; // Set avg_cnt tracking for this specific slice
-                // If we have 2D slices we need to be tracking the average count,
-                // if m_avg_type is not Instant
-                m_track_avg_cnt = m_track_avg_cnt || m_avg_type!=OutputAvgType::Instant;
-        }
-      }
-      if (units=="m") {
-        diag_name = "FieldAtHeight";
-        EKAT_REQUIRE_MSG(params.isParameter("surface_reference"),"Error! Output field request for " + diag_field_name + " is missing a surface reference."
-            "  Please add either '_above_sealevel' or '_above_surface' to the field name");
-      } else if (units=="mb" or units=="Pa" or units=="hPa") {
-        diag_name = "FieldAtPressureLevel";
-        diag_avg_cnt_name = "_" + tokens[1]; // Set avg_cnt tracking for this specific slice
-        // If we have 2D slices we need to be tracking the average count,
-        // if m_avg_type is not Instant
-        m_track_avg_cnt = m_track_avg_cnt || m_avg_type!=OutputAvgType::Instant;
-      } else {
-        EKAT_ERROR_MSG ("Error! Invalid units x for 'field_at_Nx' diagnostic.\n");
-      }
-    } else {
-      diag_name = "FieldAtLevel";
-    }
-  } else if (diag_field_name=="precip_liq_surf_mass_flux" or
-             diag_field_name=="precip_ice_surf_mass_flux" or
-             diag_field_name=="precip_total_surf_mass_flux") {
-    diag_name = "precip_surf_mass_flux";
-    // split will return [X, ''], with X being whatever is before '_surf_mass_flux'
-    auto type = ekat::split(diag_field_name.substr(7),"_surf_mass_flux").front();
-    params.set<std::string>("precip_type",type);
-  } else if (diag_field_name=="IceWaterPath" or
-             diag_field_name=="LiqWaterPath" or
-             diag_field_name=="RainWaterPath" or
-             diag_field_name=="RimeWaterPath" or
-             diag_field_name=="VapWaterPath") {
-    diag_name = "WaterPath";
-    // split will return the list [X, ''], with X being whatever is before 'WaterPath'
-    params.set<std::string>("Water Kind",ekat::split(diag_field_name,"WaterPath").front());
-  } else if (diag_field_name=="IceNumberPath" or
-             diag_field_name=="LiqNumberPath" or
-             diag_field_name=="RainNumberPath") {
-    diag_name = "NumberPath";
-    // split will return the list [X, ''], with X being whatever is before 'NumberPath'
-    params.set<std::string>("Number Kind",ekat::split(diag_field_name,"NumberPath").front());
-  } else if (diag_field_name=="AeroComCldTop" or
-             diag_field_name=="AeroComCldBot") {
-    diag_name = "AeroComCld";
-    // split will return the list ['', X], with X being whatever is after 'AeroComCld'
-    params.set<std::string>("AeroComCld Kind",ekat::split(diag_field_name,"AeroComCld").back());
-  } else if (diag_field_name=="MeridionalVapFlux" or
-             diag_field_name=="ZonalVapFlux") {
-    diag_name = "VaporFlux";
-    // split will return the list [X, ''], with X being whatever is before 'VapFlux'
-    params.set<std::string>("Wind Component",ekat::split(diag_field_name,"VapFlux").front());
-  } else if (diag_field_name.find("_atm_backtend")!=std::string::npos) {
-    diag_name = "AtmBackTendDiag";
-    // Set the grid_name
-    params.set("grid_name",get_field_manager("sim")->get_grid()->name());
-    // split will return [X, ''], with X being whatever is before '_atm_tend'
-    params.set<std::string>("Tendency Name",ekat::split(diag_field_name,"_atm_backtend").front());
-  } else if (diag_field_name=="PotentialTemperature" or
-             diag_field_name=="LiqPotentialTemperature") {
-    diag_name = "PotentialTemperature";
-    if (diag_field_name == "LiqPotentialTemperature") {
-      params.set<std::string>("Temperature Kind", "Liq");
-    } else {
-      params.set<std::string>("Temperature Kind", "Tot");
-    }
-  } else {
-    diag_name = diag_field_name;
-  }
-
-  // These fields are special case of VerticalLayer diagnostic.
-  // The diagnostics requires the name to be given as param value.
-  if (diag_name == "z_int"            or diag_name == "z_mid"            or
-      diag_name == "geopotential_int" or diag_name == "geopotential_mid" or
-      diag_name == "height_int"       or diag_name == "height_mid"     or
-      diag_name == "dz") {
-    params.set<std::string>("diag_name", diag_name);
+  // If we have 2D slices we need to be tracking the average count,
+  // if m_avg_type is not Instant
+  if (diag_avg_cnt_name!="") {
+    m_track_avg_cnt = m_track_avg_cnt || m_avg_type!=OutputAvgType::Instant;
   }
 
   // Create the diagnostic
@@ -1479,6 +1432,18 @@ update_avg_cnt_view(const Field& field, view_1d_dev& dev_view) {
 
   KT::RangePolicy policy(0,layout.size());
   const auto extents = layout.extents();
+  if (field.data_type()!=DataType::RealType) {
+    // The field is stored with a different precision: work on its flattened data
+    const auto src_data = get_other_real_data(field);
+    const OtherReal src_fill_value = fill_value;
+    auto tgt_view_1d = view_Nd_dev<1>(data,layout.size());
+    Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int i) {
+      if (src_data[i]!=src_fill_value) {
+        tgt_view_1d(i) += 1;
+      }
+    });
+    return;
+  }
   switch (layout.rank()) {
     case 1:
     {
@@ -5,6 +5,7 @@
 
 #include <ekat/util/ekat_string_utils.hpp>
 #include <ekat/mpi/ekat_comm.hpp>
+#include <ekat/ekat_parameter_list.hpp>
 
 #include <string>
 
@@ -65,6 +66,16 @@ std::string find_filename_in_rpointer (
     const ekat::Comm& comm,
     const util::TimeStamp& run_t0);
 
+// Given the name of an output field that is not in the field manager, find the name
+// of the diagnostic computing it (as registered in the AtmosphereDiagnosticFactory),
+// and set the params needed to create it. If the diagnostic output needs its own
+// average count, avg_cnt_suffix is set to the suffix to use for it (empty otherwise).
+std::string get_diagnostic_params (const std::string& diag_field_name,
+                                   const std::string& grid_name,
+                                   const double fill_value,
+                                   ekat::ParameterList& params,
+                                   std::string& avg_cnt_suffix);
+
 struct LongNames {
 
   std::string get_longname (const std::string& name) {
@@ -115,6 +115,11 @@ public:
 
   void init_timestep (const util::TimeStamp& start_of_step, const Real dt);
   void run (const util::TimeStamp& current_ts);
+
+  // Whether this OM writes a model restart file when run at the given time stamp
+  bool is_model_restart_write_step (const util::TimeStamp& ts) const {
+    return m_is_model_restart_output and m_output_control.is_write_step(ts);
+  }
   void finalize();
 
   long long res_dep_memory_footprint () const;
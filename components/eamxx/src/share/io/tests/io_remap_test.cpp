@@ -267,6 +267,28 @@ TEST_CASE("io_remap_test","io_remap_test")
   om_vert_horiz.run(t0+dt);
   om_vert_horiz.finalize();
   print ("    -> vertical-horizontal remap ... done\n",io_comm);
+
+  // Remappers only handle Real fields, so streams with a non-Real field must error out at setup
+  print ("    -> non-Real field ... \n",io_comm);
+  {
+    using OtherReal = std::conditional<std::is_same<Real,double>::value,float,double>::type;
+    const auto& fid_pm = field_manager->get_field("p_mid").get_header().get_identifier();
+    const auto& fid_pi = field_manager->get_field("p_int").get_header().get_identifier();
+    auto fm_other = std::make_shared<FieldManager>(grid);
+    fm_other->registration_begins();
+    fm_other->register_field(FieldRequest(fid_pm,"output",Pack::n));
+    fm_other->register_field(FieldRequest(fid_pi,"output",Pack::n));
+    fm_other->register_field(FieldRequest("Y_other",fid_pm.get_layout(),ekat::units::m,grid->name(),
+                                          get_data_type<OtherReal>()));
+    fm_other->registration_ends();
+
+    for (const bool vert : {true,false}) {
+      auto params = set_output_params("remap_other_real",remap_filename,-1,vert,not vert);
+      params.set<std::vector<std::string>>("Field Names",{"Y_other"});
+      REQUIRE_THROWS (AtmosphereOutput(io_comm,params,fm_other,gm));
+    }
+  }
+  print ("    -> non-Real field ... done\n",io_comm);
   print (" -> Create output ... done\n",io_comm);
 
 
@@ -731,6 +731,251 @@ TEST_CASE("multiple_bundles") {
   }
 }
 
+TEST_CASE("auto_bundle") {
+  using namespace scream;
+  using namespace ekat::units;
+  using namespace ShortFieldTagsNames;
+  using SL = std::list<std::string>;
+
+  const int ncols = 4;
+  const int nlevs = 7;
+
+  const auto nondim = Units::nondimensional();
+
+  const std::string grid_name = "physics";
+  ekat::Comm comm(MPI_COMM_WORLD);
+  auto pg = create_point_grid(grid_name,ncols*comm.size(),nlevs,comm);
+
+  auto lay3d = pg->get_3d_scalar_layout(true);
+  auto lay2d = pg->get_2d_scalar_layout();
+  FieldIdentifier a_id("a", lay3d, nondim, grid_name);
+  FieldIdentifier b_id("b", lay3d, nondim, grid_name);
+  FieldIdentifier c_id("c", lay3d, nondim, grid_name);
+  FieldIdentifier d_id("d", lay3d, nondim, grid_name);
+  FieldIdentifier e_id("e", lay2d, nondim, grid_name);
+
+  // group1 and group2 can be bundled, group3 cannot (mixed layouts)
+  auto create_fm = [&](const bool auto_bundle) {
+    auto fm = std::make_shared<FieldManager>(pg);
+    fm->set_auto_bundle_groups(auto_bundle);
+    fm->registration_begins();
+    fm->register_field(FieldRequest(a_id,SL{"group1","group3"}));
+    fm->register_field(FieldRequest(b_id,SL{"group1"}));
+    fm->register_field(FieldRequest(c_id,SL{"group1","group2"}));
+    fm->register_field(FieldRequest(d_id,SL{"group2"}));
+    fm->register_field(FieldRequest(e_id,SL{"group3"}));
+    fm->register_group(GroupRequest("group1",grid_name));
+    fm->register_group(GroupRequest("group2",grid_name));
+    fm->register_group(GroupRequest("group3",grid_name));
+    fm->registration_ends();
+    return fm;
+  };
+
+  auto fm_ref = create_fm(false);
+  auto fm     = create_fm(true);
+  REQUIRE_THROWS (fm->set_auto_bundle_groups(false));
+
+  auto g1_ref = fm_ref->get_field_group("group1");
+  auto g1 = fm->get_field_group("group1");
+  auto g2 = fm->get_field_group("group2");
+  auto g3 = fm->get_field_group("group3");
+  REQUIRE (not g1_ref.m_info->m_bundled);
+  REQUIRE (g1.m_info->m_bundled);
+  REQUIRE (g2.m_info->m_bundled);
+  REQUIRE (not g3.m_info->m_bundled);
+
+  // The bundled field spans exactly the fields of the group
+  auto b1 = g1.get_bundled_field();
+  auto b2 = g2.get_bundled_field();
+  REQUIRE (b1.get_header().get_identifier().get_layout().dim(CMP)==3);
+  REQUIRE (b2.get_header().get_identifier().get_layout().dim(CMP)==2);
+
+  // Multi-field ops must give the same result whether bundled or not
+  auto engine = setup_random_test(&comm);
+  using RPDF = std::uniform_real_distribution<Real>;
+  RPDF pdf(0.0,1.0);
+  for (const auto& fn : {"a","b","c","d","e"}) {
+    auto f_ref = fm_ref->get_field(fn);
+    auto f     = fm->get_field(fn);
+    randomize(f_ref,engine,pdf);
+    f.deep_copy(f_ref);
+  }
+
+  auto check_groups = [&](const FieldGroup& ref, const FieldGroup& tst) {
+    for (const auto& it : ref.m_fields) {
+      REQUIRE (views_are_equal(*it.second,*tst.m_fields.at(it.first)));
+    }
+  };
+
+  auto g2_ref = fm_ref->get_field_group("group2");
+  g1_ref.scale(2.0);
+  g1.scale(2.0);
+  check_groups(g1_ref,g1);
+  check_groups(g2_ref,g2);
+
+  g1_ref.update(g1_ref,1.0,0.5);
+  g1.update(g1,1.0,0.5);
+  check_groups(g1_ref,g1);
+
+  // group2 is a subset of the bundle of group1, so only c,d should change
+  g2_ref.deep_copy(3.0);
+  g2.deep_copy(3.0);
+  check_groups(g1_ref,g1);
+  check_groups(g2_ref,g2);
+  REQUIRE (field_max<Real>(fm->get_field("c"))==3.0);
+  REQUIRE (field_max<Real>(fm->get_field("a"))<3.0);
+
+  auto g3_ref = fm_ref->get_field_group("group3");
+  g3_ref.deep_copy(g3);
+  check_groups(g3_ref,g3);
+
+  // If the bundling fails, the groups added by auto-bundling are dropped first,
+  // and the groups whose bundling was requested are kept bundled. Here, tracers,
+  // zgroup1 and zgroup2 cannot be all bundled, but tracers and zgroup2 can.
+  auto fm_fail = std::make_shared<FieldManager>(pg);
+  fm_fail->set_auto_bundle_groups(true);
+  fm_fail->registration_begins();
+  fm_fail->register_field(FieldRequest(a_id,SL{"tracers","zgroup1"}));
+  fm_fail->register_field(FieldRequest(b_id,SL{"tracers"}));
+  fm_fail->register_field(FieldRequest(c_id,SL{"tracers","zgroup2"}));
+  fm_fail->register_field(FieldRequest(d_id,SL{"zgroup1","zgroup2"}));
+  fm_fail->register_group(GroupRequest("tracers",grid_name,Bundling::Preferred));
+  fm_fail->register_group(GroupRequest("zgroup1",grid_name));
+  fm_fail->register_group(GroupRequest("zgroup2",grid_name));
+  fm_fail->registration_ends();
+
+  REQUIRE (fm_fail->get_field_group("tracers").m_info->m_bundled);
+  REQUIRE (not fm_fail->get_field_group("zgroup1").m_info->m_bundled);
+  REQUIRE (fm_fail->get_field_group("zgroup2").m_info->m_bundled);
+}
+
+TEST_CASE("transient_fields") {
+  using namespace scream;
+  using namespace ekat::units;
+  using namespace ShortFieldTagsNames;
+  using SL = std::list<std::string>;
+
+  const int ncols = 4;
+  const int nlevs = 7;
+
+  const auto nondim = Units::nondimensional();
+
+  const std::string grid_name = "physics";
+  ekat::Comm comm(MPI_COMM_WORLD);
+  auto pg = create_point_grid(grid_name,ncols*comm.size(),nlevs,comm);
+
+  auto lay3d = pg->get_3d_scalar_layout(true);
+  auto lay2d = pg->get_2d_scalar_layout();
+  FieldIdentifier a_id("a", lay3d, nondim, grid_name);
+  FieldIdentifier b_id("b", lay3d, nondim, grid_name);
+  FieldIdentifier c_id("c", lay2d, nondim, grid_name);
+  FieldIdentifier d_id("d", lay3d, nondim, grid_name);
+  FieldIdentifier e_id("e", lay3d, nondim, grid_name);
+
+  auto fm = std::make_shared<FieldManager>(pg);
+  fm->registration_begins();
+  fm->register_field(FieldRequest(a_id));
+  fm->register_field(FieldRequest(b_id));
+  fm->register_field(FieldRequest(c_id));
+  fm->register_field(FieldRequest(d_id,SL{"group"}));
+  fm->register_field(FieldRequest(e_id));
+
+  // a, b, and c have disjoint live ranges; e overlaps with a and b;
+  // d is in a group, so it cannot share memory
+  fm->set_transient_field("a",0,1);
+  fm->set_transient_field("b",2,3);
+  fm->set_transient_field("c",4,5);
+  fm->set_transient_field("d",0,5);
+  fm->set_transient_field("e",1,2);
+  REQUIRE_THROWS (fm->set_transient_field("e",2,1));
+  fm->registration_ends();
+  REQUIRE_THROWS (fm->set_transient_field("e",1,2));
+
+  const auto& shared = fm->get_shared_memory_fields();
+  REQUIRE (shared.size()==3);
+  REQUIRE (shared.count("a")==1);
+  REQUIRE (shared.count("b")==1);
+  REQUIRE (shared.count("c")==1);
+
+  auto a = fm->get_field("a");
+  auto b = fm->get_field("b");
+  auto c = fm->get_field("c");
+  auto d = fm->get_field("d");
+  auto e = fm->get_field("e");
+  auto a_data = a.get_internal_view_data<Real>();
+  REQUIRE (b.get_internal_view_data<Real>()==a_data);
+  REQUIRE (c.get_internal_view_data<Real>()==a_data);
+  REQUIRE (d.get_internal_view_data<Real>()!=a_data);
+  REQUIRE (e.get_internal_view_data<Real>()!=a_data);
+
+  const auto size3d = a.get_header().get_alloc_properties().get_alloc_size();
+  const auto size2d = c.get_header().get_alloc_properties().get_alloc_size();
+  REQUIRE (fm->get_shared_memory_savings()==size3d+size2d);
+
+  // Fields sharing memory see each other's data
+  b.deep_copy(2.0);
+  REQUIRE (field_min<Real>(a)==2.0);
+  e.deep_copy(3.0);
+  REQUIRE (field_max<Real>(a)==2.0);
+}
+
+TEST_CASE("reduced_precision") {
+  using namespace scream;
+  using namespace ekat::units;
+  using namespace ShortFieldTagsNames;
+
+  const int ncols = 4;
+  const int nlevs = 7;
+
+  const auto nondim = Units::nondimensional();
+
+  const std::string grid_name = "physics";
+  ekat::Comm comm(MPI_COMM_WORLD);
+  auto pg = create_point_grid(grid_name,ncols*comm.size(),nlevs,comm);
+
+  // Store b with the floating point type that is not Real
+  using OtherReal = std::conditional<std::is_same<Real,double>::value,float,double>::type;
+  const auto other_dt = get_data_type<OtherReal>();
+
+  auto lay3d = pg->get_3d_scalar_layout(true);
+  auto fm = std::make_shared<FieldManager>(pg);
+  fm->registration_begins();
+  fm->register_field(FieldRequest("a",lay3d,nondim,grid_name));
+  fm->register_field(FieldRequest("b",lay3d,nondim,grid_name,other_dt));
+  fm->register_field(FieldRequest("c",lay3d,nondim,grid_name));
+
+  // Inconsistent data type, or non-Real fields in groups, are not allowed
+  REQUIRE_THROWS (fm->register_field(FieldRequest("b",lay3d,nondim,grid_name)));
+  REQUIRE_THROWS (fm->register_field(FieldRequest(FieldIdentifier("b",lay3d,nondim,grid_name,other_dt),"group")));
+  REQUIRE_THROWS (fm->register_field(FieldRequest("d",lay3d,nondim,grid_name,DataType::IntType)));
+  fm->registration_ends();
+
+  auto a = fm->get_field("a");
+  auto b = fm->get_field("b");
+  auto c = fm->get_field("c");
+  REQUIRE (b.data_type()==other_dt);
+  REQUIRE (b.get_header().get_alloc_properties().get_alloc_size()==lay3d.size()*static_cast<long long>(sizeof(OtherReal)));
+
+  // Mixed precision copies, round trip
+  auto engine = setup_random_test(&comm);
+  using RPDF = std::uniform_real_distribution<Real>;
+  RPDF pdf(0.0,1.0);
+  randomize(a,engine,pdf);
+  b.deep_copy(a);
+  c.deep_copy(b);
+  a.sync_to_host();
+  c.sync_to_host();
+
+  const Real tol = std::numeric_limits<float>::epsilon();
+  auto a_h = a.get_view<const Real**,Host>();
+  auto c_h = c.get_view<const Real**,Host>();
+  for (int i=0; i<ncols; ++i) {
+    for (int k=0; k<nlevs; ++k) {
+      REQUIRE (std::abs(a_h(i,k)-c_h(i,k))<=tol*std::abs(a_h(i,k)));
+    }
+  }
+}
+
 TEST_CASE ("update") {
   using namespace scream;
   using namespace ekat::units;
@@ -173,6 +173,52 @@ TEST_CASE("utils") {
     REQUIRE(field_min<Real>(f1,&comm)==gmin);
   }
 
+  SECTION ("multi_field") {
+    // Mix a padded field, an unpadded 3d field, and a (strided) subfield
+    FieldIdentifier fid3 ("field_3", {{COL,CMP,LEV},{3,2,24}}, m/s,"some_grid");
+    Field f2 = f1.clone();
+    Field f3(fid3);
+    f3.allocate_view();
+    Field f3_sub = f3.subfield(1,1);
+
+    auto v1 = f1.get_strided_view<Real**>();
+    auto v2 = f2.get_strided_view<Real**>();
+    auto v3 = f3.get_view<Real***>();
+    auto dim0 = fid.get_layout().dim(0);
+    auto dim1 = fid.get_layout().dim(1);
+    auto rank = comm.rank();
+    Kokkos::parallel_for(kt::RangePolicy(0,dim0*dim1),
+                         KOKKOS_LAMBDA(int idx) {
+      int i = idx / dim1;
+      int j = idx % dim1;
+      v1(i,j) = rank + idx + 1;
+      v2(i,j) = -(rank + idx + 1);
+      v3(i,0,j) = 2*(rank + idx + 1);
+      v3(i,1,j) = 3*(rank + idx + 1);
+    });
+    Kokkos::fence();
+
+    std::vector<Field> fields = {f1,f2,f3,f3_sub};
+    for (const ekat::Comm* c : {static_cast<const ekat::Comm*>(nullptr),&comm}) {
+      auto sums  = field_sum<Real>(fields,c);
+      auto maxs  = field_max<Real>(fields,c);
+      auto mins  = field_min<Real>(fields,c);
+      auto norms = frobenius_norm<Real>(fields,c);
+      REQUIRE (sums.size()==fields.size());
+      for (size_t i=0; i<fields.size(); ++i) {
+        REQUIRE (sums[i]==field_sum<Real>(fields[i],c));
+        REQUIRE (maxs[i]==field_max<Real>(fields[i],c));
+        REQUIRE (mins[i]==field_min<Real>(fields[i],c));
+        REQUIRE (norms[i]==Approx(frobenius_norm<Real>(fields[i],c)));
+      }
+    }
+
+    // All fields must store ST
+    Field fi(FieldIdentifier("fi", FieldLayout({COL},{3}), Units::nondimensional(), "", DataType::IntType));
+    fi.allocate_view();
+    REQUIRE_THROWS(field_max<Real>(std::vector<Field>{f1,fi}));
+  }
+
   SECTION ("perturb") {
     using namespace ShortFieldTagsNames;
     using RPDF = std::uniform_real_distribution<Real>;
@@ -204,6 +204,9 @@ TEST_CASE ("refining_remapper") {
   auto r = std::make_shared<RefiningRemapperP2PTester>(tgt_grid,filename);
   auto src_grid = r->get_src_grid();
 
+  // Added dofs are averaged from their neighbors, so this is not an injection
+  REQUIRE (not r->is_injection());
+
   auto bundle_src = create_field("bundle3d_src",LayoutType::Vector3D,*src_grid,engine);
   auto s2d_src   = create_field("s2d_src",LayoutType::Scalar2D,*src_grid,engine);
   auto v2d_src   = create_field("v2d_src",LayoutType::Vector2D,*src_grid,engine);
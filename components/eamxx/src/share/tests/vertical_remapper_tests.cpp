@@ -359,4 +359,180 @@ TEST_CASE ("vertical_remap") {
   scorpio::finalize_subsystem();
 }
 
+TEST_CASE ("vertical_remap_ppm") {
+  using namespace ShortFieldTagsNames;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  scorpio::init_subsystem(comm);
+
+  const int nlevs_src  = 2*SCREAM_PACK_SIZE + 2;
+  const int nlevs_tgt  = nlevs_src/2 + 2;
+  const int nldofs_src = 10;
+  constexpr int vec_dim = 3;
+  const Real mask_val = -99999.0;
+  const Real tol = 1000*std::numeric_limits<Real>::epsilon();
+
+  // Non-uniform src layers
+  std::vector<Real> pint_src(nlevs_src+1);
+  pint_src[0] = 10;
+  for (int k=0; k<nlevs_src; ++k) {
+    pint_src[k+1] = pint_src[k] + 1 + 0.5*(k%3);
+  }
+
+  // Tgt layers: the first and last one stick out of the src column, while
+  // the others span exactly the src column, with uniform thickness
+  std::vector<Real> pint_tgt(nlevs_tgt+1);
+  pint_tgt[0] = pint_src[0] - 1;
+  pint_tgt[nlevs_tgt] = pint_src[nlevs_src] + 1;
+  const Real dp_tgt = (pint_src[nlevs_src]-pint_src[0]) / (nlevs_tgt-2);
+  for (int k=1; k<nlevs_tgt; ++k) {
+    pint_tgt[k] = pint_src[0] + (k-1)*dp_tgt;
+  }
+  pint_tgt[nlevs_tgt-1] = pint_src[nlevs_src];
+
+  print (" -> creating map file ...\n",comm);
+  std::string filename = "vertical_map_file_ppm_np" + std::to_string(comm.size()) + ".nc";
+  scorpio::register_file(filename, scorpio::FileMode::Write);
+  scorpio::define_dim(filename,"ilev",nlevs_tgt+1);
+  scorpio::define_var(filename,"p_ilevs",{"ilev"},"real");
+  scorpio::enddef(filename);
+  scorpio::write_var(filename,"p_ilevs",pint_tgt.data());
+  scorpio::release_file(filename);
+  print (" -> creating map file ... done!\n",comm);
+
+  print (" -> creating grid and remapper ...\n",comm);
+  auto src_grid = build_src_grid(comm, nldofs_src, nlevs_src);
+  auto pmid = create_field("p_mid", src_grid, false, false, true,  SCREAM_PACK_SIZE);
+  auto pint = create_field("p_int", src_grid, false, false, false, SCREAM_PACK_SIZE);
+  {
+    auto pmid_h = pmid.get_view<Real**,Host>();
+    auto pint_h = pint.get_view<Real**,Host>();
+    for (int i=0; i<nldofs_src; ++i) {
+      for (int k=0; k<=nlevs_src; ++k) {
+        pint_h(i,k) = pint_src[k];
+      }
+      for (int k=0; k<nlevs_src; ++k) {
+        pmid_h(i,k) = 0.5*(pint_src[k]+pint_src[k+1]);
+      }
+    }
+    pmid.sync_to_dev();
+    pint.sync_to_dev();
+  }
+  auto remap = std::make_shared<VerticalRemapper>(src_grid,filename,pmid,pint,mask_val,VerticalRemapType::PPM);
+  auto tgt_grid = remap->get_tgt_grid();
+  REQUIRE(tgt_grid->get_num_vertical_levels()==nlevs_tgt);
+  print (" -> creating grid and remapper ... done!\n",comm);
+
+  // Interface fields are not supported by PPM remap
+  {
+    auto src_i = create_field("s3d_i",src_grid,false,false,false);
+    auto tgt_i = create_field("s3d_i",tgt_grid,false,false,true);
+    auto bad_remap = std::make_shared<VerticalRemapper>(src_grid,filename,pmid,pint,mask_val,VerticalRemapType::PPM);
+    bad_remap->registration_begins();
+    REQUIRE_THROWS (bad_remap->register_field(src_i,tgt_i));
+  }
+
+  print (" -> creating fields ...\n",comm);
+  auto src_s2d = create_field("s2d",  src_grid,true,false);
+  auto src_s3d = create_field("s3d",  src_grid,false,false,true,1);
+  auto src_v3d = create_field("v3d",  src_grid,false,true, true,SCREAM_PACK_SIZE);
+  auto src_c3d = create_field("c3d",  src_grid,false,false,true,SCREAM_PACK_SIZE);
+  auto tgt_s2d = create_field("s2d",  tgt_grid,true,false);
+  auto tgt_s3d = create_field("s3d",  tgt_grid,false,false,true,1);
+  auto tgt_v3d = create_field("v3d",  tgt_grid,false,true, true,SCREAM_PACK_SIZE);
+  auto tgt_c3d = create_field("c3d",  tgt_grid,false,false,true,SCREAM_PACK_SIZE);
+
+  // A non-monotone profile, varying across cols and components
+  auto q = [](const int i, const int j, const int k) {
+    return i + j*10 + std::sin(Real(0.7)*k);
+  };
+  {
+    auto s2d = src_s2d.get_view<Real*,Host>();
+    auto s3d = src_s3d.get_view<Real**,Host>();
+    auto v3d = src_v3d.get_view<Real***,Host>();
+    auto c3d = src_c3d.get_view<Real**,Host>();
+    for (int i=0; i<nldofs_src; ++i) {
+      s2d(i) = i;
+      for (int k=0; k<nlevs_src; ++k) {
+        s3d(i,k) = q(i,0,k);
+        c3d(i,k) = 2.5;
+        for (int j=0; j<vec_dim; ++j) {
+          v3d(i,j,k) = q(i,j+1,k);
+        }
+      }
+    }
+    src_s2d.sync_to_dev();
+    src_s3d.sync_to_dev();
+    src_v3d.sync_to_dev();
+    src_c3d.sync_to_dev();
+  }
+  print (" -> creating fields ... done!\n",comm);
+
+  remap->registration_begins();
+  remap->register_field(src_s2d,tgt_s2d);
+  remap->register_field(src_s3d,tgt_s3d);
+  remap->register_field(src_v3d,tgt_v3d);
+  remap->register_field(src_c3d,tgt_c3d);
+  remap->registration_ends();
+
+  print (" -> run remap ...\n",comm);
+  remap->remap(true);
+  print (" -> run remap ... done!\n",comm);
+
+  print (" -> check tgt fields ...\n",comm);
+  tgt_s2d.sync_to_host();
+  tgt_s3d.sync_to_host();
+  tgt_v3d.sync_to_host();
+  tgt_c3d.sync_to_host();
+
+  // Check masking, conservation, monotonicity (and exactness for constants)
+  auto check_col = [&](auto y, auto x, auto mask) {
+    Real mass_src = 0, mass_tgt = 0;
+    Real qmin = x(0), qmax = x(0);
+    for (int k=0; k<nlevs_src; ++k) {
+      mass_src += x(k)*(pint_src[k+1]-pint_src[k]);
+      qmin = std::min(qmin,x(k));
+      qmax = std::max(qmax,x(k));
+    }
+    REQUIRE (y(0)==mask_val);
+    REQUIRE (y(nlevs_tgt-1)==mask_val);
+    REQUIRE (mask(0)==0);
+    REQUIRE (mask(nlevs_tgt-1)==0);
+    for (int k=1; k<nlevs_tgt-1; ++k) {
+      REQUIRE (std::abs(mask(k)-1)<tol);
+      REQUIRE (y(k)>=qmin-tol*std::abs(qmin));
+      REQUIRE (y(k)<=qmax+tol*std::abs(qmax));
+      mass_tgt += y(k)*(pint_tgt[k+1]-pint_tgt[k]);
+    }
+    REQUIRE (std::abs(mass_tgt-mass_src)<=tol*std::abs(mass_src));
+  };
+
+  auto s2d = tgt_s2d.get_view<const Real*,Host>();
+  auto s3d = tgt_s3d.get_view<const Real**,Host>();
+  auto v3d = tgt_v3d.get_view<const Real***,Host>();
+  auto c3d = tgt_c3d.get_view<const Real**,Host>();
+  auto s3d_src = src_s3d.get_view<const Real**,Host>();
+  auto v3d_src = src_v3d.get_view<const Real***,Host>();
+  auto c3d_src = src_c3d.get_view<const Real**,Host>();
+  auto mask_f = tgt_s3d.get_header().get_extra_data<Field>("mask_data");
+  mask_f.sync_to_host();
+  auto mask = mask_f.get_view<const Real**,Host>();
+  for (int i=0; i<nldofs_src; ++i) {
+    REQUIRE (s2d(i)==i);
+    auto mask_i = ekat::subview(mask,i);
+    check_col(ekat::subview(s3d,i),ekat::subview(s3d_src,i),mask_i);
+    check_col(ekat::subview(c3d,i),ekat::subview(c3d_src,i),mask_i);
+    for (int j=0; j<vec_dim; ++j) {
+      check_col(ekat::subview(v3d,i,j),ekat::subview(v3d_src,i,j),mask_i);
+    }
+    for (int k=1; k<nlevs_tgt-1; ++k) {
+      REQUIRE (std::abs(c3d(i,k)-2.5)<tol);
+    }
+  }
+  print (" -> check tgt fields ... done!\n",comm);
+
+  scorpio::finalize_subsystem();
+}
+
 } // namespace scream
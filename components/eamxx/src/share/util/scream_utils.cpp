@@ -7,6 +7,14 @@
 #include <sys/resource.h>
 #endif
 
+#if defined(KOKKOS_ENABLE_CUDA)
+#include <cuda_runtime.h>
+#elif defined(KOKKOS_ENABLE_HIP)
+#include <hip/hip_runtime.h>
+#endif
+#include <cstdio>
+#include <fstream>
+
 namespace scream {
 
 long long get_mem_usage (const MemoryUnits u) {
@@ -44,6 +52,52 @@ long long get_mem_usage (const MemoryUnits u) {
   return mem;
 }
 
+long long get_available_mem (const MemoryUnits u) {
+
+  long long bytes = -1;
+
+#if defined(KOKKOS_ENABLE_CUDA)
+  size_t free, total;
+  if (cudaMemGetInfo(&free,&total)==cudaSuccess) {
+    bytes = free;
+  }
+#elif defined(KOKKOS_ENABLE_HIP)
+  size_t free, total;
+  if (hipMemGetInfo(&free,&total)==hipSuccess) {
+    bytes = free;
+  }
+#elif defined(SCREAM_ENABLE_STATM)
+  // If statm is available, so is /proc/meminfo
+  std::ifstream meminfo("/proc/meminfo");
+  std::string line;
+  while (std::getline(meminfo,line)) {
+    long long kb;
+    if (std::sscanf(line.c_str(),"MemAvailable: %lld kB",&kb)==1) {
+      bytes = kb*1024;
+      break;
+    }
+  }
+#endif
+
+  if (bytes<0) {
+    return bytes;
+  }
+
+  switch (u) {
+    case B  :                      break;
+    case KB : bytes /= 1000;       break;
+    case MB : bytes /= 1000*1000;  break;
+    case GB : bytes /= 1000*1000*1000; break;
+    case KiB: bytes /= 1024;       break;
+    case MiB: bytes /= 1024*1024;  break;
+    case GiB: bytes /= 1024*1024*1024; break;
+    default:
+      EKAT_ERROR_MSG ("Invalid choice for memory units: " + std::to_string(u) + "\n");
+  }
+
+  return bytes;
+}
+
 std::vector<std::string> filename_glob(const std::vector<std::string>& patterns) {
   std::vector<std::string> all_files;
   for (const auto& pattern : patterns) {
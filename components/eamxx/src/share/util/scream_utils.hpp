@@ -37,6 +37,11 @@ cmvdc (const VT& v)
 // Gets current memory (RAM) usage by current process.
 long long get_mem_usage (const MemoryUnits u);
 
+// Gets the memory currently available to the default execution space: free
+// device memory on GPU builds, available RAM otherwise. Returns -1 if it
+// cannot be queried on this system.
+long long get_available_mem (const MemoryUnits u);
+
 // Micro-utility, that given an enum returns the underlying int.
 // The only use of this is if you need to sort scoped enums.
 template<typename EnumT>
@@ -0,0 +1,260 @@
+#include <catch2/catch.hpp>
+
+#include "control/atmosphere_driver.hpp"
+#include "physics/ml_correction/ml_correction_native.hpp"
+#include "physics/register_physics.hpp"
+#include "share/grid/mesh_free_grids_manager.hpp"
+#include "share/util/scream_setup_random_test.hpp"
+
+#include <ekat/ekat_parse_yaml_file.hpp>
+
+#include <pybind11/embed.h>
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <random>
+
+namespace scream {
+
+struct MLPVariable {
+  std::string name;
+  int size;
+  Real mean;
+  Real std;
+};
+
+// Write a random MLP with the given inputs/outputs, and one hidden tanh layer.
+// The input/output normalization comes from the (physically sensible) mean/std
+// of each variable, so that all backends see O(1) normalized values.
+void write_random_mlp (const std::string& filename,
+                       const std::vector<MLPVariable>& inputs,
+                       const std::vector<MLPVariable>& outputs,
+                       std::mt19937_64& engine)
+{
+  std::uniform_real_distribution<Real> pdf(-1,1);
+  auto write_vars = [&](std::ofstream& ofs, const std::vector<MLPVariable>& vars) {
+    ofs << vars.size() << "\n";
+    for (const auto& v : vars) {
+      ofs << v.name << " " << v.size << "\n";
+    }
+  };
+  auto write_stats = [&](std::ofstream& ofs, const std::vector<MLPVariable>& vars, const bool mean) {
+    for (const auto& v : vars) {
+      for (int i=0; i<v.size; ++i) {
+        ofs << " " << std::setprecision(17) << (mean ? v.mean : v.std);
+      }
+    }
+    ofs << "\n";
+  };
+  auto write_random = [&](std::ofstream& ofs, const int n) {
+    for (int i=0; i<n; ++i) {
+      ofs << " " << std::setprecision(17) << pdf(engine);
+    }
+    ofs << "\n";
+  };
+  auto total_size = [](const std::vector<MLPVariable>& vars) {
+    int n = 0;
+    for (const auto& v : vars) {
+      n += v.size;
+    }
+    return n;
+  };
+
+  const int nin    = total_size(inputs);
+  const int nout   = total_size(outputs);
+  const int hidden = 8;
+  std::ofstream ofs(filename);
+  ofs << "eamxx_native_mlp 1  # test model\n";
+  ofs << "inputs ";  write_vars(ofs,inputs);
+  ofs << "outputs "; write_vars(ofs,outputs);
+  ofs << "input_mean";  write_stats(ofs,inputs,true);
+  ofs << "input_std";   write_stats(ofs,inputs,false);
+  ofs << "output_mean"; write_stats(ofs,outputs,true);
+  ofs << "output_std";  write_stats(ofs,outputs,false);
+  // Scale the weights of the first layer, so that the activations are O(1)
+  ofs << "layers 2\n";
+  ofs << "dense " << nin << " " << hidden << " tanh\n";
+  for (int i=0; i<hidden*nin; ++i) {
+    ofs << " " << std::setprecision(17) << pdf(engine)/std::sqrt(Real(nin));
+  }
+  write_random(ofs,hidden);
+  ofs << "dense " << hidden << " " << nout << " linear\n";
+  write_random(ofs,nout*hidden+nout);
+}
+
+// Host copy of a field (of rank 1, 2, or 3), without padding
+std::vector<Real> get_values (const Field& f_in)
+{
+  auto f = f_in;
+  f.sync_to_host();
+  const auto& fl = f.get_header().get_identifier().get_layout();
+  std::vector<Real> vals;
+  switch (fl.rank()) {
+    case 1:
+    {
+      auto v = f.get_view<const Real*,Host>();
+      for (int i=0; i<fl.dim(0); ++i) vals.push_back(v(i));
+      break;
+    }
+    case 2:
+    {
+      auto v = f.get_view<const Real**,Host>();
+      for (int i=0; i<fl.dim(0); ++i)
+        for (int j=0; j<fl.dim(1); ++j) vals.push_back(v(i,j));
+      break;
+    }
+    case 3:
+    {
+      auto v = f.get_view<const Real***,Host>();
+      for (int i=0; i<fl.dim(0); ++i)
+        for (int j=0; j<fl.dim(1); ++j)
+          for (int k=0; k<fl.dim(2); ++k) vals.push_back(v(i,j,k));
+      break;
+    }
+    default:
+      EKAT_ERROR_MSG ("Unexpected rank in ml_correction_backends test.\n");
+  }
+  return vals;
+}
+
+TEST_CASE("ml_correction_backends") {
+  using namespace scream::control;
+  namespace py = pybind11;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+  auto engine = setup_random_test(&comm);
+
+  ekat::ParameterList ad_params("Atmosphere Driver");
+  parse_yaml_file("input_backends.yaml", ad_params);
+
+  const auto& ts     = ad_params.sublist("time_stepping");
+  const auto  dt     = ts.get<int>("time_step");
+  const auto  t0     = util::str_to_time_stamp(ts.get<std::string>("run_t0"));
+  const int   nlev   = ad_params.sublist("grids_manager").sublist("Physics").get<int>("number_of_vertical_levels");
+  const auto& ml     = ad_params.sublist("atmosphere_processes").sublist("MLCorrection");
+
+  // The same models are run by both backends. The uv and sfc fluxes models use the
+  // T_mid/qv updated by the tq model, so the order in which the models run matters.
+  if (comm.am_i_root()) {
+    write_random_mlp(ml.get<std::string>("ML_model_path_tq"),
+        {{"T_mid",nlev,250,30}, {"qv",nlev,5e-3,5e-3}, {"cos_zenith_angle",1,0,1},
+         {"lat",1,0,60}, {"surface_geopotential",1,5e3,1e4}},
+        {{"dQ1",nlev,0,1e-4}, {"dQ2",nlev,0,1e-9}},
+        engine);
+    write_random_mlp(ml.get<std::string>("ML_model_path_uv"),
+        {{"U",nlev,0,20}, {"V",nlev,0,20}, {"T_mid",nlev,250,30}, {"qv",nlev,5e-3,5e-3}},
+        {{"dQxwind",nlev,0,1e-4}, {"dQywind",nlev,0,1e-4}},
+        engine);
+    write_random_mlp(ml.get<std::string>("ML_model_path_sfc_fluxes"),
+        {{"T_mid",nlev,250,30}, {"qv",nlev,5e-3,5e-3}, {"cos_zenith_angle",1,0,1},
+         {"surface_diffused_shortwave_albedo",1,0.1,0.1},
+         {"total_sky_downward_shortwave_flux_at_top_of_atmosphere",1,500,500}},
+        {{"net_shortwave_sfc_flux_via_transmissivity",1,300,50},
+         {"override_for_time_adjusted_total_sky_downward_longwave_flux_at_surface",1,350,30}},
+        engine);
+  }
+  comm.barrier();
+
+  register_physics();
+  register_mesh_free_grids_manager();
+
+  const std::vector<std::string> checked_fields = {
+    "T_mid", "qv", "horiz_winds", "sfc_flux_sw_net", "sfc_flux_lw_dn",
+    "precip_liq_surf_mass", "precip_ice_surf_mass"
+  };
+
+  // Run one step with the given backend, and return the initial and final values of the fields
+  using values_t = std::map<std::string,std::vector<Real>>;
+  auto run = [&](const std::string& backend, values_t& before, values_t& after,
+                 std::vector<Real>& lat, std::vector<Real>& lon) {
+    auto params = ad_params;
+    params.sublist("atmosphere_processes").sublist("MLCorrection").set<std::string>("ML_inference_backend",backend);
+
+    AtmosphereDriver ad;
+    ad.initialize(comm, params, t0);
+
+    const auto& grid = ad.get_grids_manager()->get_grid("Physics");
+    const auto& fm   = *ad.get_field_mgr(grid->name());
+    const int ncols  = grid->get_num_local_dofs();
+
+    // Make the 2d inputs vary across columns, and set precipitation so that the adjustment
+    // goes through all its branches (liq+ice, and, with no precip, either phase by temperature)
+    auto phis   = fm.get_field("phis").get_view<Real*,Host>();
+    auto alb    = fm.get_field("sfc_alb_dif_vis").get_view<Real*,Host>();
+    auto sw_dn  = fm.get_field("SW_flux_dn").get_view<Real**,Host>();
+    auto liq    = fm.get_field("precip_liq_surf_mass").get_view<Real*,Host>();
+    auto ice    = fm.get_field("precip_ice_surf_mass").get_view<Real*,Host>();
+    for (int i=0; i<ncols; ++i) {
+      phis(i)    = 1e3*(i%7);
+      alb(i)     = 0.05 + 0.02*(i%5);
+      sw_dn(i,0) = 100*(i%13);
+      liq(i)     = (i%3==0) ? 0 : 1e-2*(i%3);
+      ice(i)     = (i%4==0) ? 0 : 1e-2*(i%4);
+    }
+    for (const auto& name : {"phis","sfc_alb_dif_vis","SW_flux_dn","precip_liq_surf_mass","precip_ice_surf_mass"}) {
+      fm.get_field(name).sync_to_dev();
+    }
+
+    for (const auto& name : checked_fields) {
+      before[name] = get_values(fm.get_field(name));
+    }
+    ad.run(dt);
+    for (const auto& name : checked_fields) {
+      after[name] = get_values(fm.get_field(name));
+    }
+    lat = get_values(grid->get_geometry_data("lat"));
+    lon = get_values(grid->get_geometry_data("lon"));
+
+    ad.finalize();
+  };
+
+  values_t py_before, py_after, native_before, native_after;
+  std::vector<Real> lat, lon;
+  run("python",py_before,py_after,lat,lon);
+  run("native",native_before,native_after,lat,lon);
+
+  const Real tol = std::is_same<Real,float>::value ? 1e-4 : 1e-8;
+  for (const auto& name : checked_fields) {
+    const auto& py     = py_after.at(name);
+    const auto& native = native_after.at(name);
+    REQUIRE (py_before.at(name)==native_before.at(name));
+    REQUIRE (py.size()==native.size());
+
+    // The models must have done something
+    REQUIRE (py!=py_before.at(name));
+    for (size_t i=0; i<py.size(); ++i) {
+      REQUIRE (std::abs(py[i]-native[i]) <= tol*std::max(Real(1),std::abs(py[i])));
+    }
+  }
+
+  // Check the native solar zenith angle against the one used by the python backend
+  const Real days = days_from_2000(t0);
+  int fpe_mask = ekat::get_enabled_fpes();
+  ekat::disable_all_fpes();  // required for importing numpy
+  if ( Py_IsInitialized() == 0 ) {
+    py::initialize_interpreter();
+  }
+  {
+    auto datetime = py::module::import("datetime").attr("datetime")(
+        t0.get_year(),t0.get_month(),t0.get_day(),t0.get_hours(),t0.get_minutes(),t0.get_seconds());
+    const int ncols = lat.size();
+    py::array_t<double> lat_py(ncols), lon_py(ncols);
+    for (int i=0; i<ncols; ++i) {
+      lat_py.mutable_at(i) = lat[i];
+      lon_py.mutable_at(i) = lon[i];
+    }
+    auto cosz = py::module::import("vcm").attr("cos_zenith_angle")(datetime,lon_py,lat_py)
+                  .cast<py::array_t<double>>();
+    for (int i=0; i<ncols; ++i) {
+      REQUIRE (std::abs(cos_zenith_angle(days,lon[i],lat[i])-cosz.at(i)) <= 1e-5);
+    }
+  }
+  ekat::enable_fpes(fpe_mask);
+}
+
+} // namespace scream
@@ -0,0 +1,129 @@
+#include <catch2/catch.hpp>
+
+#include "physics/ml_correction/ml_correction_native.hpp"
+#include "share/util/scream_setup_random_test.hpp"
+
+#include <ekat/util/ekat_test_utils.hpp>
+
+#include <pybind11/embed.h>
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <random>
+
+namespace scream {
+
+// Write a random MLP with the given input/output sizes and hidden layers
+void write_random_mlp (const std::string& filename, const int nlev,
+                       const std::vector<std::pair<int,std::string>>& hidden,
+                       std::mt19937_64& engine)
+{
+  std::uniform_real_distribution<Real> pdf(-1,1), pdf_pos(0.5,2);
+  auto write_values = [&](std::ofstream& ofs, const int n, std::uniform_real_distribution<Real>& d) {
+    for (int i=0; i<n; ++i) {
+      ofs << " " << std::setprecision(17) << d(engine);
+    }
+    ofs << "\n";
+  };
+
+  const int nin  = nlev+1;
+  const int nout = nlev;
+  std::ofstream ofs(filename);
+  ofs << "eamxx_native_mlp 1  # test model\n";
+  ofs << "inputs 2\nT_mid " << nlev << "\nlat 1\n";
+  ofs << "outputs 1\ndQ1 " << nlev << "\n";
+  ofs << "input_mean";  write_values(ofs,nin,pdf);
+  ofs << "input_std";   write_values(ofs,nin,pdf_pos);
+  ofs << "output_mean"; write_values(ofs,nout,pdf);
+  ofs << "output_std";  write_values(ofs,nout,pdf_pos);
+  ofs << "layers " << hidden.size()+1 << "\n";
+  int width = nin;
+  for (const auto& l : hidden) {
+    ofs << "dense " << width << " " << l.first << " " << l.second << "\n";
+    write_values(ofs,l.first*width+l.first,pdf);
+    width = l.first;
+  }
+  ofs << "dense " << width << " " << nout << " linear\n";
+  write_values(ofs,nout*width+nout,pdf);
+}
+
+TEST_CASE("ml_correction_native") {
+  namespace py = pybind11;
+  using view_2d = NativeMLModel::view_2d;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+  auto engine = setup_random_test(&comm);
+
+  const int ncols = 7;
+  const int nlev  = 12;
+  const std::string filename = "ml_correction_native_mlp.txt";
+  write_random_mlp(filename,nlev,{{16,"tanh"},{9,"relu"}},engine);
+
+  NativeMLModel model(filename,ncols);
+  REQUIRE (model.num_inputs()==nlev+1);
+  REQUIRE (model.num_outputs()==nlev);
+  REQUIRE (model.inputs().size()==2);
+  REQUIRE (model.inputs()[1].name=="lat");
+  REQUIRE (model.inputs()[1].offset==nlev);
+
+  view_2d x("x",ncols,model.num_inputs());
+  view_2d y("y",ncols,model.num_outputs());
+  auto x_h = Kokkos::create_mirror_view(x);
+  std::uniform_real_distribution<Real> pdf(-2,2);
+  for (int icol=0; icol<ncols; ++icol) {
+    for (int i=0; i<model.num_inputs(); ++i) {
+      x_h(icol,i) = pdf(engine);
+    }
+  }
+  Kokkos::deep_copy(x,x_h);
+
+  model.predict(x,y);
+  auto y_h = Kokkos::create_mirror_view(y);
+  Kokkos::deep_copy(y_h,y);
+
+  // Compare with the numpy implementation
+  int fpe_mask = ekat::get_enabled_fpes();
+  ekat::disable_all_fpes();  // required for importing numpy
+  if ( Py_IsInitialized() == 0 ) {
+    py::initialize_interpreter();
+  }
+  {
+    py::module sys = py::module::import("sys");
+    sys.attr("path").attr("insert")(1, ML_CORRECTION_PY_PATH);
+    auto native_mlp = py::module::import("native_mlp");
+    REQUIRE (native_mlp.attr("is_native_mlp_file")(filename).cast<bool>());
+    auto py_model = native_mlp.attr("NativeMLP")(filename);
+    py::array_t<double> x_py({ncols,model.num_inputs()});
+    for (int icol=0; icol<ncols; ++icol) {
+      for (int i=0; i<model.num_inputs(); ++i) {
+        x_py.mutable_at(icol,i) = x_h(icol,i);
+      }
+    }
+    auto y_py = py_model.attr("predict_array")(x_py).cast<py::array_t<double>>();
+    REQUIRE (y_py.shape(0)==ncols);
+    REQUIRE (y_py.shape(1)==model.num_outputs());
+
+    const Real tol = std::is_same<Real,float>::value ? 1e-4 : 1e-10;
+    for (int icol=0; icol<ncols; ++icol) {
+      for (int i=0; i<model.num_outputs(); ++i) {
+        const Real ref = y_py.at(icol,i);
+        REQUIRE (std::abs(y_h(icol,i)-ref) <= tol*std::max(Real(1),std::abs(ref)));
+      }
+    }
+  }
+  ekat::enable_fpes(fpe_mask);
+
+  // Time/solar angle utilities
+  REQUIRE (days_from_2000(util::TimeStamp(2000,1,1,12,0,0))==0);
+  REQUIRE (days_from_2000(util::TimeStamp(2001,3,1,0,0,0))==424.5);
+  // Around noon at the spring equinox, the sun is almost at the zenith over the equator
+  const Real equinox = days_from_2000(util::TimeStamp(2021,3,20,12,0,0));
+  REQUIRE (cos_zenith_angle(equinox,0,0)>0.99);
+  REQUIRE (cos_zenith_angle(equinox,180,0)<-0.99);
+}
+
+} // namespace scream
@@ -0,0 +1,199 @@
+#include <catch2/catch.hpp>
+
+#include "control/atmosphere_driver.hpp"
+#include "diagnostics/register_diagnostics.hpp"
+#include "physics/rrtmgp/eamxx_rrtmgp_process_interface.hpp"
+#include "share/atm_process/atmosphere_process.hpp"
+#include "share/grid/mesh_free_grids_manager.hpp"
+#include "share/io/scream_scorpio_interface.hpp"
+
+#include "ekat/ekat_parse_yaml_file.hpp"
+#include "ekat/util/ekat_test_utils.hpp"
+
+#include <functional>
+#include <iomanip>
+
+namespace scream {
+
+// Gives access to the fields on the radiation (coarse) grid
+class RRTMGPCoarseTester : public RRTMGPRadiation {
+public:
+  RRTMGPCoarseTester (const ekat::Comm& comm, const ekat::ParameterList& params)
+   : RRTMGPRadiation(comm,params) {}
+
+  Field get_coarse_field (const std::string& name) const {
+    auto f = m_coarse_fields.at(name);
+    f.sync_to_host();
+    return f;
+  }
+};
+
+// Write a map file. Each of the n_b rows gets the average of the n_a/n_b cols in
+// group(row), or, if n_a<n_b, the value of the col of group(row)
+void write_map_file (const std::string& filename, const int n_a, const int n_b,
+                     const std::function<int(int)>& group)
+{
+  const int nnz = std::max(n_a,n_b);
+  const double w = n_a>n_b ? double(n_b)/n_a : 1.0;
+
+  scorpio::register_file(filename, scorpio::FileMode::Write);
+
+  scorpio::define_dim(filename, "n_a", n_a);
+  scorpio::define_dim(filename, "n_b", n_b);
+  scorpio::define_dim(filename, "n_s", nnz);
+
+  scorpio::define_var(filename, "col", {"n_s"}, "int");
+  scorpio::define_var(filename, "row", {"n_s"}, "int");
+  scorpio::define_var(filename, "S",   {"n_s"}, "double");
+
+  scorpio::enddef(filename);
+
+  // Note: map files use 1-based indices
+  std::vector<int> col(nnz), row(nnz);
+  std::vector<double> S(nnz,w);
+  for (int i=0; i<nnz; ++i) {
+    if (n_a>n_b) {
+      col[i] = i + 1;
+      row[i] = group(i) + 1;
+    } else {
+      col[i] = group(i) + 1;
+      row[i] = i + 1;
+    }
+  }
+
+  scorpio::write_var(filename,"row",row.data());
+  scorpio::write_var(filename,"col",col.data());
+  scorpio::write_var(filename,"S",  S.data());
+
+  scorpio::release_file(filename);
+}
+
+TEST_CASE("rrtmgp-stand-alone-coarse", "") {
+  using namespace scream;
+  using namespace scream::control;
+
+  // Create a comm. Note: the test checks the fine columns of each coarse column
+  // together, so it runs on a single rank
+  ekat::Comm atm_comm (MPI_COMM_WORLD);
+  REQUIRE (atm_comm.size()==1);
+
+  // Load ad parameter list
+  std::string inputfile = ekat::TestSession::get().params.at("inputfile");
+  ekat::ParameterList ad_params("Atmosphere Driver");
+  parse_yaml_file(inputfile,ad_params);
+
+  // Time stepping parameters
+  const auto& ts     = ad_params.sublist("time_stepping");
+  const auto  dt     = ts.get<int>("time_step");
+  const auto  nsteps = ts.get<int>("number_of_steps");
+  const auto  t0_str = ts.get<std::string>("run_t0");
+  const auto  t0     = util::str_to_time_stamp(t0_str);
+
+  EKAT_ASSERT_MSG (dt>0, "Error! Time step must be positive.\n");
+
+  // The coarse grid averages pairs of consecutive physics columns
+  const auto& rad_params = ad_params.sublist("atmosphere_processes").sublist("rrtmgp");
+  const int ncol_fine   = ad_params.sublist("grids_manager").sublist("Physics").get<int>("number_of_global_columns");
+  const int ncol_coarse = ncol_fine / 2;
+  REQUIRE (ncol_fine==2*ncol_coarse);
+  auto pair = [](const int i) { return i / 2; };
+  scorpio::init_subsystem(atm_comm);
+  write_map_file(rad_params.get<std::string>("coarsening_map_file"),ncol_fine,ncol_coarse,pair);
+  write_map_file(rad_params.get<std::string>("refining_map_file"),ncol_coarse,ncol_fine,pair);
+  scorpio::finalize_subsystem();
+
+  // Need to register products in the factory *before* we create any atm process or grids manager.
+  auto& proc_factory = AtmosphereProcessFactory::instance();
+  proc_factory.register_product("RRTMGP",&create_atmosphere_process<RRTMGPCoarseTester>);
+  register_mesh_free_grids_manager();
+  register_diagnostics();
+
+  // Create the driver
+  AtmosphereDriver ad;
+
+  // Init and run
+  ad.initialize(atm_comm,ad_params,t0);
+  if (atm_comm.am_i_root()) {
+    printf("Start time stepping loop...       [  0%%]\n");
+  }
+  for (int i=0; i<nsteps; ++i) {
+    ad.run(dt);
+    if (atm_comm.am_i_root()) {
+      std::cout << "  - Iteration " << std::setfill(' ') << std::setw(3) << i+1 << " completed";
+      std::cout << "       [" << std::setfill(' ') << std::setw(3) << 100*(i+1)/nsteps << "%]\n";
+    }
+  }
+
+  // Radiation runs at every step, so the fields of both grids are from the last step
+  auto rad = std::dynamic_pointer_cast<const RRTMGPCoarseTester>(ad.get_atm_processes()->get_process(0));
+  REQUIRE (rad!=nullptr);
+
+  const auto& grid = ad.get_grids_manager()->get_grid("Physics");
+  const auto& fm = *ad.get_field_mgr(grid->name());
+  auto get_fine = [&](const std::string& name) {
+    auto f = fm.get_field(name);
+    f.sync_to_host();
+    return f;
+  };
+  const int nlay = grid->get_num_vertical_levels();
+  auto gids = grid->get_dofs_gids().get_view<const AbstractGrid::gid_type*,Host>();
+  const auto min_gid = grid->get_global_min_dof_gid();
+  std::vector<int> gid2lid(ncol_fine);
+  for (int i=0; i<ncol_fine; ++i) {
+    gid2lid[gids(i)-min_gid] = i;
+  }
+
+  const Real tol = std::is_same<Real,float>::value ? 1e-4 : 1e-10;
+  auto check = [&](const Real fine, const Real coarse, const Real scale) {
+    REQUIRE (std::abs(fine-coarse) <= tol*std::max(scale,Real(1)));
+  };
+
+  // 1. The column integrated heating, averaged over the physics columns of a coarse column,
+  //    matches the one of the coarse column. Note: the coarse rad_heating_pdel holds the
+  //    heating rate, which is the same in all the physics columns of a coarse column
+  {
+    auto pdel_f = get_fine("pseudo_density").get_view<const Real**,Host>();
+    auto heat_f = get_fine("rad_heating_pdel").get_view<const Real**,Host>();
+    auto pdel_c = rad->get_coarse_field("pseudo_density").get_view<const Real**,Host>();
+    auto heat_c = rad->get_coarse_field("rad_heating_pdel").get_view<const Real**,Host>();
+    for (int ic=0; ic<ncol_coarse; ++ic) {
+      const int i0 = gid2lid[2*ic];
+      const int i1 = gid2lid[2*ic+1];
+      Real avg_f = 0, int_c = 0, scale = 0;
+      for (int k=0; k<nlay; ++k) {
+        check(heat_f(i0,k)/pdel_f(i0,k),heat_c(ic,k),std::abs(heat_c(ic,k)));
+        check(heat_f(i1,k)/pdel_f(i1,k),heat_c(ic,k),std::abs(heat_c(ic,k)));
+        avg_f += (heat_f(i0,k) + heat_f(i1,k)) / 2;
+        int_c += heat_c(ic,k)*pdel_c(ic,k);
+        scale += std::abs(heat_c(ic,k)*pdel_c(ic,k));
+      }
+      check(avg_f,int_c,scale);
+    }
+  }
+
+  // 2. The surface fluxes, averaged over the physics columns of a coarse column, match the ones
+  //    of the coarse column (the upwelling ones are downscaled with the local surface state)
+  for (const auto& name : {"sfc_flux_sw_net", "sfc_flux_lw_dn"}) {
+    auto f = get_fine(name).get_view<const Real*,Host>();
+    auto c = rad->get_coarse_field(name).get_view<const Real*,Host>();
+    for (int ic=0; ic<ncol_coarse; ++ic) {
+      const Real avg_f = (f(gid2lid[2*ic]) + f(gid2lid[2*ic+1])) / 2;
+      check(avg_f,c(ic),std::abs(c(ic)));
+    }
+  }
+  for (const auto& name : {"SW_flux_up", "SW_flux_dn", "LW_flux_up", "LW_flux_dn"}) {
+    auto f = get_fine(name).get_view<const Real**,Host>();
+    auto c = rad->get_coarse_field(name).get_view<const Real**,Host>();
+    for (int ic=0; ic<ncol_coarse; ++ic) {
+      for (int k : {0,nlay}) {
+        const Real avg_f = (f(gid2lid[2*ic],k) + f(gid2lid[2*ic+1],k)) / 2;
+        check(avg_f,c(ic,k),std::abs(c(ic,k)));
+      }
+    }
+  }
+
+  // Finalize
+  ad.finalize();
+}
+
+} // namespace scream
@@ -0,0 +1,155 @@
+#include <catch2/catch.hpp>
+
+#include "control/atmosphere_driver.hpp"
+#include "diagnostics/register_diagnostics.hpp"
+#include "physics/register_physics.hpp"
+#include "physics/share/physics_constants.hpp"
+#include "share/grid/mesh_free_grids_manager.hpp"
+
+#include "ekat/ekat_parse_yaml_file.hpp"
+#include "ekat/util/ekat_test_utils.hpp"
+
+#include <cmath>
+#include <map>
+
+namespace scream {
+
+// Compare the incremental updates in between radiation steps with calling radiation at every step.
+// The tolerances are based on what the incremental updates do:
+//  - the TOA downwelling SW flux is the insolation, so it scales exactly with cos(zenith angle);
+//  - the bottom upwelling LW flux is shifted by the change of surf_lw_flux_up, while RRTMGP
+//    recomputes the surface emission (a bit less than surf_lw_flux_up) and its reflected part;
+//  - the SW transmissivity depends on the zenith angle, and the column LW heating on how much
+//    of the change of the surface emission escapes to space. We require the (global mean)
+//    errors to be a fraction of the insolation and of the surface emission change.
+TEST_CASE("rrtmgp-stand-alone-incremental", "") {
+  using namespace scream::control;
+  using PC = scream::physics::Constants<Real>;
+  using values_t = std::map<std::string,std::vector<std::vector<Real>>>;
+
+  ekat::Comm atm_comm (MPI_COMM_WORLD);
+
+  // Load ad parameter list
+  std::string inputfile = ekat::TestSession::get().params.at("inputfile");
+  ekat::ParameterList ad_params("Atmosphere Driver");
+  parse_yaml_file(inputfile,ad_params);
+
+  // Time stepping parameters
+  const auto& ts     = ad_params.sublist("time_stepping");
+  const auto  dt     = ts.get<int>("time_step");
+  const auto  nsteps = ts.get<int>("number_of_steps");
+  const auto  t0     = util::str_to_time_stamp(ts.get<std::string>("run_t0"));
+  const int   rad_freq = ad_params.sublist("atmosphere_processes").sublist("rrtmgp").get<int>("rad_frequency");
+  REQUIRE (rad_freq>1);
+  REQUIRE (nsteps>1);
+
+  register_physics();
+  register_mesh_free_grids_manager();
+  register_diagnostics();
+
+  // Increase of surf_lw_flux_up after the first step, to exercise the LW update
+  const Real lw_delta = 10;
+
+  // Run with the given radiation frequency, and store the fields of each step (as [step][col*nlev+k])
+  int nlay = 0, ncols = 0;
+  auto run = [&](const int freq, const bool incremental, values_t& values) {
+    auto params = ad_params;
+    auto& rad_params = params.sublist("atmosphere_processes").sublist("rrtmgp");
+    rad_params.set<int>("rad_frequency",freq);
+    rad_params.set<bool>("rad_incremental_update",incremental);
+
+    AtmosphereDriver ad;
+    ad.initialize(atm_comm,params,t0);
+
+    const auto& grid = ad.get_grids_manager()->get_grid("Point Grid");
+    const auto& fm   = *ad.get_field_mgr(grid->name());
+    nlay  = grid->get_num_vertical_levels();
+    ncols = grid->get_num_local_dofs();
+
+    for (int i=0; i<nsteps; ++i) {
+      if (i==1) {
+        auto f = fm.get_field("surf_lw_flux_up");
+        f.sync_to_host();
+        auto v = f.get_view<Real*,Host>();
+        for (int icol=0; icol<ncols; ++icol) {
+          v(icol) += lw_delta;
+        }
+        f.sync_to_dev();
+      }
+      ad.run(dt);
+
+      for (const std::string name : {"SW_flux_dn", "LW_flux_up", "rad_heating_pdel"}) {
+        auto f = fm.get_field(name);
+        f.sync_to_host();
+        const int nk = name=="rad_heating_pdel" ? nlay : nlay+1;
+        auto v = f.get_view<const Real**,Host>();
+        std::vector<Real> vals;
+        for (int icol=0; icol<ncols; ++icol) {
+          for (int k=0; k<nk; ++k) {
+            vals.push_back(v(icol,k));
+          }
+        }
+        values[name].push_back(vals);
+      }
+      auto f = fm.get_field("sfc_flux_sw_net");
+      f.sync_to_host();
+      auto v = f.get_view<const Real*,Host>();
+      values["sfc_flux_sw_net"].push_back(std::vector<Real>(v.data(),v.data()+ncols));
+    }
+    ad.finalize();
+  };
+
+  values_t full, incr;
+  run(1,false,full);
+  run(rad_freq,true,incr);
+
+  auto global_sum = [&](Real val) {
+    Real sum;
+    atm_comm.all_reduce(&val,&sum,1,MPI_SUM);
+    return sum;
+  };
+  const Real tol = std::is_same<Real,float>::value ? 1e-4 : 1e-8;
+  for (int i=1; i<nsteps; ++i) {
+    if (i % rad_freq == 0) {
+      // Radiation step
+      continue;
+    }
+
+    const auto& sw_dn_full = full["SW_flux_dn"][i];
+    const auto& sw_dn_incr = incr["SW_flux_dn"][i];
+    const auto& lw_up_full = full["LW_flux_up"][i];
+    const auto& lw_up_incr = incr["LW_flux_up"][i];
+    const auto& heat_full  = full["rad_heating_pdel"][i];
+    const auto& heat_incr  = incr["rad_heating_pdel"][i];
+    const auto& sfc_full   = full["sfc_flux_sw_net"][i];
+    const auto& sfc_incr   = incr["sfc_flux_sw_net"][i];
+
+    Real toa_sw = 0, sfc_sw_err = 0, heat_err = 0;
+    for (int icol=0; icol<ncols; ++icol) {
+      const int top = icol*(nlay+1);
+      const int bot = icol*(nlay+1) + nlay;
+      REQUIRE (std::abs(sw_dn_incr[top]-sw_dn_full[top]) <= tol*std::max(Real(1),sw_dn_full[top]));
+      REQUIRE (std::abs(lw_up_incr[bot]-lw_up_full[bot]) <= 0.1*lw_delta);
+
+      // Column integrated heating, in W/m2
+      Real col_heat_full = 0, col_heat_incr = 0;
+      for (int k=0; k<nlay; ++k) {
+        col_heat_full += heat_full[icol*nlay+k]*PC::Cpair/PC::gravit;
+        col_heat_incr += heat_incr[icol*nlay+k]*PC::Cpair/PC::gravit;
+      }
+      toa_sw     += sw_dn_full[top];
+      sfc_sw_err += std::abs(sfc_incr[icol]-sfc_full[icol]);
+      heat_err   += std::abs(col_heat_incr-col_heat_full);
+    }
+    toa_sw     = global_sum(toa_sw);
+    sfc_sw_err = global_sum(sfc_sw_err);
+    heat_err   = global_sum(heat_err);
+    const Real ncols_global = global_sum(ncols);
+
+    REQUIRE (toa_sw>0);
+    REQUIRE (sfc_sw_err <= 0.1*toa_sw);
+    REQUIRE (heat_err <= 0.1*toa_sw + lw_delta*ncols_global);
+  }
+}
+
+} // namespace scream